@@ -0,0 +1,198 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "AnimNotifies/ANS_PRMeleeHitWindow.h"
+#include "Characters/PRBaseCharacter.h"
+#include "Components/PRWeaponSystemComponent.h"
+#include "Components/StaticMeshComponent.h"
+#include "Common/PRSocketTransformCache.h"
+#include "Subsystems/PRDamageableSpatialHashSubsystem.h"
+#include "Weapons/PRBaseWeapon.h"
+
+UANS_PRMeleeHitWindow::UANS_PRMeleeHitWindow(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	WeaponStartSocketName = FName("WeaponStart");
+	WeaponEndSocketName = FName("WeaponEnd");
+	WeaponRadius = 10.0f;
+	MaxSubstepDistance = 20.0f;
+	MaxSubsteps = 8;
+	HitWindowStatesPurgeThreshold = 16;
+}
+
+void UANS_PRMeleeHitWindow::NotifyBegin(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, float TotalDuration, const FAnimNotifyEventReference& EventReference)
+{
+	Super::NotifyBegin(MeshComp, Animation, TotalDuration, EventReference);
+
+	// 새로운 휘두르기가 시작되므로 이전 자세와 맞은 대상을 초기화합니다.
+	PurgeStaleAnimNotifyInstances(HitWindowStates, HitWindowStatesPurgeThreshold);
+	HitWindowStates.Add(FPRAnimNotifyInstanceKey(MeshComp, EventReference), FPRMeleeHitWindowState());
+
+#if WITH_EDITOR
+	// 충돌 형태가 없으면 매 Tick이 아니라 히트 윈도우마다 한 번만 경고합니다.
+	FVector WeaponStart;
+	FVector WeaponEnd;
+	if(MeshComp && !GetWeaponShape(MeshComp, WeaponStart, WeaponEnd))
+	{
+		PR_LOG_WARNING("%s has no weapon shape. Check %s and %s sockets.", *GetNameSafe(MeshComp->GetOwner()), *WeaponStartSocketName.ToString(), *WeaponEndSocketName.ToString());
+	}
+#endif
+
+	// 히트 윈도우가 시작하는 자세에서도 판정합니다.
+	SweepWeapon(MeshComp, EventReference);
+}
+
+void UANS_PRMeleeHitWindow::NotifyTick(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, float FrameDeltaTime, const FAnimNotifyEventReference& EventReference)
+{
+	Super::NotifyTick(MeshComp, Animation, FrameDeltaTime, EventReference);
+
+	SweepWeapon(MeshComp, EventReference);
+}
+
+void UANS_PRMeleeHitWindow::NotifyEnd(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, const FAnimNotifyEventReference& EventReference)
+{
+	HitWindowStates.Remove(FPRAnimNotifyInstanceKey(MeshComp, EventReference));
+
+	Super::NotifyEnd(MeshComp, Animation, EventReference);
+}
+
+void UANS_PRMeleeHitWindow::SweepWeapon(USkeletalMeshComponent* MeshComp, const FAnimNotifyEventReference& EventReference)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UANS_PRMeleeHitWindow::SweepWeapon);
+
+	APRBaseCharacter* PROwner = MeshComp ? Cast<APRBaseCharacter>(MeshComp->GetOwner()) : nullptr;
+	if(!IsValid(PROwner) || PROwner->IsDead() || !PROwner->GetWorld())
+	{
+		return;
+	}
+
+	UPRDamageableSpatialHashSubsystem* DamageableSpatialHash = PROwner->GetWorld()->GetSubsystem<UPRDamageableSpatialHashSubsystem>();
+	if(!DamageableSpatialHash)
+	{
+		return;
+	}
+
+	FVector CurrentStart;
+	FVector CurrentEnd;
+	if(!GetWeaponShape(MeshComp, CurrentStart, CurrentEnd))
+	{
+		return;
+	}
+
+	FPRMeleeHitWindowState& HitWindowState = HitWindowStates.FindOrAdd(FPRAnimNotifyInstanceKey(MeshComp, EventReference));
+	if(!HitWindowState.bHasPreviousPose)
+	{
+		HitWindowState.PreviousWeaponStart = CurrentStart;
+		HitWindowState.PreviousWeaponEnd = CurrentEnd;
+		HitWindowState.bHasPreviousPose = true;
+	}
+
+	// 무기의 양 끝 중 더 많이 이동한 거리를 기준으로 Sweep을 나눌 수를 계산합니다.
+	const FVector PreviousStart = HitWindowState.PreviousWeaponStart;
+	const FVector PreviousEnd = HitWindowState.PreviousWeaponEnd;
+	const float MoveDistance = FMath::Max(FVector::Dist(PreviousStart, CurrentStart), FVector::Dist(PreviousEnd, CurrentEnd));
+	const int32 SubstepCount = FMath::Clamp(FMath::CeilToInt(MoveDistance / FMath::Max(MaxSubstepDistance, 1.0f)), 1, FMath::Max(MaxSubsteps, 1));
+
+	// 시작 위치를 축으로 무기의 방향을 구면 보간하기 위해 이전 자세와 현재 자세의 방향과 길이를 계산합니다.
+	const FVector PreviousDirection = (PreviousEnd - PreviousStart).GetSafeNormal();
+	const FVector CurrentDirection = (CurrentEnd - CurrentStart).GetSafeNormal();
+	const float PreviousLength = FVector::Dist(PreviousStart, PreviousEnd);
+	const float CurrentLength = FVector::Dist(CurrentStart, CurrentEnd);
+	const bool bSwingWeapon = !PreviousDirection.IsNearlyZero() && !CurrentDirection.IsNearlyZero();
+	const FQuat SwingRotation = bSwingWeapon ? FQuat::FindBetweenNormals(PreviousDirection, CurrentDirection) : FQuat::Identity;
+
+	TArray<FPRDamageableQueryResult> QueryResults;
+	TArray<FPRDamageableQueryResult, TInlineAllocator<8>> NewHitResults;
+	for(int32 SubstepIndex = 1; SubstepIndex <= SubstepCount; SubstepIndex++)
+	{
+		// 시작 위치는 선형 보간하고 방향은 구면 보간하여 애니메이션에서 무기가 그리는 호를 따라 Sweep합니다.
+		const float Alpha = static_cast<float>(SubstepIndex) / static_cast<float>(SubstepCount);
+		FVector SweepStart;
+		FVector SweepEnd;
+		if(SubstepIndex == SubstepCount)
+		{
+			SweepStart = CurrentStart;
+			SweepEnd = CurrentEnd;
+		}
+		else if(bSwingWeapon)
+		{
+			const FVector SubstepDirection = FQuat::Slerp(FQuat::Identity, SwingRotation, Alpha).RotateVector(PreviousDirection);
+			SweepStart = FMath::Lerp(PreviousStart, CurrentStart, Alpha);
+			SweepEnd = SweepStart + SubstepDirection * FMath::Lerp(PreviousLength, CurrentLength, Alpha);
+		}
+		else
+		{
+			SweepStart = FMath::Lerp(PreviousStart, CurrentStart, Alpha);
+			SweepEnd = FMath::Lerp(PreviousEnd, CurrentEnd, Alpha);
+		}
+
+		if(PROwner->IsDamageSystemDebug())
+		{
+			DrawDebugCapsule(PROwner->GetWorld(), (SweepStart + SweepEnd) * 0.5f, (SweepEnd - SweepStart).Size() * 0.5f + WeaponRadius,
+								WeaponRadius, FRotationMatrix::MakeFromZ(SweepEnd - SweepStart).ToQuat(), FColor::Red, false, 1.0f);
+		}
+
+		QueryResults.Reset();
+		DamageableSpatialHash->QueryCapsule(SweepStart, SweepEnd, WeaponRadius, PROwner, QueryResults);
+		for(const FPRDamageableQueryResult& QueryResult : QueryResults)
+		{
+			// 이번 휘두르기에서 이미 맞은 대상은 제외합니다.
+			const FObjectKey ActorKey(QueryResult.Actor);
+			if(!HitWindowState.HitActors.Contains(ActorKey))
+			{
+				HitWindowState.HitActors.Add(ActorKey);
+				NewHitResults.Add(QueryResult);
+			}
+		}
+	}
+
+	HitWindowState.PreviousWeaponStart = CurrentStart;
+	HitWindowState.PreviousWeaponEnd = CurrentEnd;
+
+	// 이번 Tick에 새로 맞은 대상에게 한 번에 대미지를 줍니다.
+	if(NewHitResults.Num() > 0)
+	{
+		PROwner->ApplyMeleeDamage(NewHitResults);
+	}
+}
+
+bool UANS_PRMeleeHitWindow::GetWeaponShape(USkeletalMeshComponent* MeshComp, FVector& OutStart, FVector& OutEnd) const
+{
+	const APRBaseCharacter* PROwner = Cast<APRBaseCharacter>(MeshComp->GetOwner());
+	APRBaseWeapon* EquippedWeapon = PROwner && PROwner->GetWeaponSystem() ? PROwner->GetWeaponSystem()->GetEquippedWeapon() : nullptr;
+	UStaticMeshComponent* WeaponMesh = IsValid(EquippedWeapon) ? EquippedWeapon->GetMainWeaponMesh() : nullptr;
+
+	// 무기 메시의 Socket을 사용합니다.
+	if(IsValid(WeaponMesh) && WeaponMesh->DoesSocketExist(WeaponStartSocketName) && WeaponMesh->DoesSocketExist(WeaponEndSocketName))
+	{
+		OutStart = FPRSocketTransformCache::GetSocketLocation(WeaponMesh, WeaponStartSocketName);
+		OutEnd = FPRSocketTransformCache::GetSocketLocation(WeaponMesh, WeaponEndSocketName);
+		return true;
+	}
+
+	// 무기가 없거나 무기 메시에 Socket이 없을 경우 캐릭터 메시의 Socket을 사용합니다.
+	if(MeshComp->DoesSocketExist(WeaponStartSocketName) && MeshComp->DoesSocketExist(WeaponEndSocketName))
+	{
+		OutStart = FPRSocketTransformCache::GetSocketLocation(MeshComp, WeaponStartSocketName);
+		OutEnd = FPRSocketTransformCache::GetSocketLocation(MeshComp, WeaponEndSocketName);
+		return true;
+	}
+
+	// Socket이 없을 경우 무기 메시의 Bounds에서 가장 긴 축을 무기의 충돌 형태로 사용합니다.
+	if(IsValid(WeaponMesh) && WeaponMesh->GetStaticMesh())
+	{
+		const FBox LocalBounds = WeaponMesh->GetStaticMesh()->GetBoundingBox();
+		const FVector Center = LocalBounds.GetCenter();
+		const FVector Extent = LocalBounds.GetExtent();
+		const int32 LongestAxis = Extent.X >= Extent.Y ? (Extent.X >= Extent.Z ? 0 : 2) : (Extent.Y >= Extent.Z ? 1 : 2);
+		FVector AxisExtent = FVector::ZeroVector;
+		AxisExtent[LongestAxis] = Extent[LongestAxis];
+
+		const FTransform& WeaponTransform = WeaponMesh->GetComponentTransform();
+		OutStart = WeaponTransform.TransformPosition(Center - AxisExtent);
+		OutEnd = WeaponTransform.TransformPosition(Center + AxisExtent);
+		return true;
+	}
+
+	return false;
+}
@@ -4,7 +4,47 @@
 #include "AnimNotifies/ANS_PRNiagaraEffectTrail.h"
 #include "Characters/PRBaseCharacter.h"
 #include "Components/PREffectSystemComponent.h"
+#include "Common/PRSocketTransformCache.h"
+#include "Effects/PRNiagaraEffect.h"
 #include "NiagaraComponent.h"
+#include "NiagaraDataInterfaceArrayFunctionLibrary.h"
+#include "Engine/SkeletalMeshSocket.h"
+#include "Engine/SkinnedAsset.h"
+
+void FPRTrailSocketBinding::Bind(const USkeletalMeshComponent* MeshComp, FName NewSocketName)
+{
+	SocketName = NewSocketName;
+	BoneIndex = INDEX_NONE;
+	LocalTransform = FTransform::Identity;
+
+	if(!MeshComp || NewSocketName == NAME_None)
+	{
+		return;
+	}
+
+	const USkeletalMeshSocket* Socket = MeshComp->GetSocketByName(NewSocketName);
+	if(Socket)
+	{
+		BoneIndex = MeshComp->GetBoneIndex(Socket->BoneName);
+		LocalTransform = Socket->GetSocketLocalTransform();
+	}
+	else
+	{
+		BoneIndex = MeshComp->GetBoneIndex(NewSocketName);
+	}
+}
+
+FVector FPRTrailSocketBinding::GetComponentSpaceLocation(USkeletalMeshComponent* MeshComp) const
+{
+	// LeaderPose를 따르는 Mesh는 자신의 ComponentSpace Transform을 가지지 않으므로 이름으로 계산합니다.
+	const TArray<FTransform>& ComponentSpaceTransforms = MeshComp->GetComponentSpaceTransforms();
+	if(ComponentSpaceTransforms.IsValidIndex(BoneIndex))
+	{
+		return ComponentSpaceTransforms[BoneIndex].TransformPosition(LocalTransform.GetLocation());
+	}
+
+	return FPRSocketTransformCache::GetSocketTransform(MeshComp, SocketName, RTS_Component).GetLocation();
+}
 
 UANS_PRNiagaraEffectTrail::UANS_PRNiagaraEffectTrail(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
@@ -12,31 +52,148 @@ UANS_PRNiagaraEffectTrail::UANS_PRNiagaraEffectTrail(const FObjectInitializer& O
 	SocketName = TEXT("root");
 	StartSocket = NAME_None;
 	EndSocket =	NAME_None;
+
+	// SubFrameSampling
+	bUseSubFrameSampling = true;
+	SubFrameSampleRate = 120.0f;
+	MaxSamplesPerTick = 8;
+	StartSocketSamplesParameterName = FName("StartSocketSamples");
+	EndSocketSamplesParameterName = FName("EndSocketSamples");
+	StartSocketParameterName = FName("StartSocket");
+	EndSocketParameterName = FName("EndSocket");
+	TrailSamplerStatesPurgeThreshold = 16;
+}
+
+void UANS_PRNiagaraEffectTrail::NotifyBegin(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, float TotalDuration, const FAnimNotifyEventReference& EventReference)
+{
+	// 새로운 Trail이 시작되므로 이전 샘플을 초기화합니다.
+	PurgeStaleAnimNotifyInstances(TrailSamplerStates, TrailSamplerStatesPurgeThreshold);
+	FPRTrailSamplerState& SamplerState = TrailSamplerStates.Add(FPRAnimNotifyInstanceKey(MeshComp, EventReference), FPRTrailSamplerState());
+	BindTrailSockets(MeshComp, SamplerState);
+	
+	Super::NotifyBegin(MeshComp, Animation, TotalDuration, EventReference);
 }
 
 void UANS_PRNiagaraEffectTrail::NotifyTick(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, float FrameDeltaTime, const FAnimNotifyEventReference& EventReference)
 {
 	if(MeshComp)
 	{
-		if(IsValid(NiagaraEffect))
+		UNiagaraComponent* TrailComponent = GetTrailNiagaraComponent(MeshComp, EventReference);
+		if(IsValid(TrailComponent))
 		{
-			NiagaraEffect->GetNiagaraEffect()->SetVectorParameter(TEXT("StartSocket"), MeshComp->GetSocketLocation(StartSocket));
-			NiagaraEffect->GetNiagaraEffect()->SetVectorParameter(TEXT("EndSocket"), MeshComp->GetSocketLocation(EndSocket));
+			UpdateTrailSamples(MeshComp, EventReference, TrailComponent, FrameDeltaTime);
 		}
-		else
-		{
+	}
+	
+	Super::NotifyTick(MeshComp, Animation, FrameDeltaTime, EventReference);
+}
+
+void UANS_PRNiagaraEffectTrail::NotifyEnd(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, const FAnimNotifyEventReference& EventReference)
+{
+	TrailSamplerStates.Remove(FPRAnimNotifyInstanceKey(MeshComp, EventReference));
+
+	Super::NotifyEnd(MeshComp, Animation, EventReference);
+}
+
+#pragma region SubFrameSampling
+UNiagaraComponent* UANS_PRNiagaraEffectTrail::GetTrailNiagaraComponent(USkeletalMeshComponent* MeshComp, const FAnimNotifyEventReference& EventReference)
+{
+	APRNiagaraEffect* SpawnedNiagaraEffect = FindSpawnedNiagaraEffect(MeshComp, EventReference);
+	if(IsValid(SpawnedNiagaraEffect))
+	{
+		return SpawnedNiagaraEffect->GetNiagaraEffect();
+	}
+
 #if WITH_EDITOR
-			PR_LOG_SCREEN_INFO(0, "%s NiagaraEffect does not exist in the EffectSystem", *Template.GetName());
+	PR_LOG_SCREEN_INFO(0, "%s NiagaraEffect does not exist in the EffectSystem", *Template.GetName());
 #endif
-			
-			UFXSystemComponent* FXComponent = GetSpawnedEffect(MeshComp);
-			if(IsValid(FXComponent))
-			{
-				FXComponent->SetVectorParameter(TEXT("StartSocket"), MeshComp->GetSocketLocation(StartSocket));
-				FXComponent->SetVectorParameter(TEXT("EndSocket"), MeshComp->GetSocketLocation(EndSocket));
-			}
-		}
+
+	return Cast<UNiagaraComponent>(GetSpawnedEffect(MeshComp));
+}
+
+void UANS_PRNiagaraEffectTrail::BindTrailSockets(const USkeletalMeshComponent* MeshComp, FPRTrailSamplerState& SamplerState) const
+{
+	const USkinnedAsset* SkinnedAsset = MeshComp ? MeshComp->GetSkinnedAsset() : nullptr;
+	if(SamplerState.BoundSkinnedAsset == SkinnedAsset
+		&& SamplerState.StartSocketBinding.SocketName == StartSocket
+		&& SamplerState.EndSocketBinding.SocketName == EndSocket)
+	{
+		return;
 	}
+
+	SamplerState.StartSocketBinding.Bind(MeshComp, StartSocket);
+	SamplerState.EndSocketBinding.Bind(MeshComp, EndSocket);
+	SamplerState.BoundSkinnedAsset = SkinnedAsset;
+}
+
+void UANS_PRNiagaraEffectTrail::UpdateTrailSamples(USkeletalMeshComponent* MeshComp, const FAnimNotifyEventReference& EventReference, UNiagaraComponent* TrailComponent, float FrameDeltaTime)
+{
+	// NotifyBegin에서 찾은 Bone Index로 Socket의 위치를 계산합니다.
+	FPRTrailSamplerState& SamplerState = TrailSamplerStates.FindOrAdd(FPRAnimNotifyInstanceKey(MeshComp, EventReference));
+	BindTrailSockets(MeshComp, SamplerState);
+
+	// Socket의 위치는 ComponentSpace에서 보간합니다.
+	// 캐릭터가 이동하는 중에도 Socket이 그리는 호를 유지하기 위해 현재 Component의 Transform으로 WorldSpace로 변환합니다.
+	const FTransform& ComponentTransform = MeshComp->GetComponentTransform();
+	const FVector CurrentStartLocation = SamplerState.StartSocketBinding.GetComponentSpaceLocation(MeshComp);
+	const FVector CurrentEndLocation = SamplerState.EndSocketBinding.GetComponentSpaceLocation(MeshComp);
+
+	// 기존 파라미터는 최신 Socket의 위치로 갱신합니다.
+	TrailComponent->SetVariableVec3(StartSocketParameterName, ComponentTransform.TransformPosition(CurrentStartLocation));
+	TrailComponent->SetVariableVec3(EndSocketParameterName, ComponentTransform.TransformPosition(CurrentEndLocation));
 	
-	Super::NotifyTick(MeshComp, Animation, FrameDeltaTime, EventReference);
+	if(!bUseSubFrameSampling)
+	{
+		return;
+	}
+
+	// 첫 샘플은 이전 구간이 없으므로 다음 Tick에서 Older 샘플로 사용하지 않습니다.
+	const bool bHadPreviousSample = SamplerState.bHasPreviousSample;
+	if(!SamplerState.bHasPreviousSample)
+	{
+		SamplerState.PreviousStartLocation = CurrentStartLocation;
+		SamplerState.PreviousEndLocation = CurrentEndLocation;
+		SamplerState.bHasPreviousSample = true;
+	}
+
+	// 이번 Tick 동안 생성할 샘플의 수를 계산합니다.
+	const float SampleInterval = 1.0f / FMath::Max(SubFrameSampleRate, 1.0f);
+	SamplerState.AccumulatedTime += FrameDeltaTime;
+	const int32 SampleCount = FMath::Clamp(FMath::FloorToInt(SamplerState.AccumulatedTime / SampleInterval), 1, FMath::Max(MaxSamplesPerTick, 1));
+	SamplerState.AccumulatedTime = FMath::Max(SamplerState.AccumulatedTime - SampleCount * SampleInterval, 0.0f);
+
+	// Previous에서 Current까지의 구간을 Hermite 곡선으로 보간합니다.
+	// Previous의 접선은 Older, Previous, Current의 속도 평균(Catmull-Rom)이고, 다음 샘플을 알 수 없는 Current의 접선은 마지막 구간의 방향입니다.
+	// Tick 간격이 달라도 접선의 크기가 맞도록 속도에 이번 구간의 시간을 곱합니다. Older 샘플이 없으면 직선으로 보간합니다.
+	const FVector StartSegment = CurrentStartLocation - SamplerState.PreviousStartLocation;
+	const FVector EndSegment = CurrentEndLocation - SamplerState.PreviousEndLocation;
+	FVector PreviousStartTangent = StartSegment;
+	FVector PreviousEndTangent = EndSegment;
+	if(SamplerState.bHasOlderSample && SamplerState.PreviousDeltaTime > UE_KINDA_SMALL_NUMBER && FrameDeltaTime > UE_KINDA_SMALL_NUMBER)
+	{
+		const float TimeRatio = FrameDeltaTime / SamplerState.PreviousDeltaTime;
+		PreviousStartTangent = 0.5f * ((SamplerState.PreviousStartLocation - SamplerState.OlderStartLocation) * TimeRatio + StartSegment);
+		PreviousEndTangent = 0.5f * ((SamplerState.PreviousEndLocation - SamplerState.OlderEndLocation) * TimeRatio + EndSegment);
+	}
+
+	StartSocketSamples.Reset(SampleCount);
+	EndSocketSamples.Reset(SampleCount);
+	for(int32 SampleIndex = 1; SampleIndex <= SampleCount; SampleIndex++)
+	{
+		const float Alpha = static_cast<float>(SampleIndex) / static_cast<float>(SampleCount);
+		StartSocketSamples.Add(ComponentTransform.TransformPosition(FMath::CubicInterp(SamplerState.PreviousStartLocation, PreviousStartTangent, CurrentStartLocation, StartSegment, Alpha)));
+		EndSocketSamples.Add(ComponentTransform.TransformPosition(FMath::CubicInterp(SamplerState.PreviousEndLocation, PreviousEndTangent, CurrentEndLocation, EndSegment, Alpha)));
+	}
+
+	// 샘플을 한 번의 Array 쓰기로 업로드합니다.
+	UNiagaraDataInterfaceArrayFunctionLibrary::SetNiagaraArrayVector(TrailComponent, StartSocketSamplesParameterName, StartSocketSamples);
+	UNiagaraDataInterfaceArrayFunctionLibrary::SetNiagaraArrayVector(TrailComponent, EndSocketSamplesParameterName, EndSocketSamples);
+
+	SamplerState.OlderStartLocation = SamplerState.PreviousStartLocation;
+	SamplerState.OlderEndLocation = SamplerState.PreviousEndLocation;
+	SamplerState.PreviousStartLocation = CurrentStartLocation;
+	SamplerState.PreviousEndLocation = CurrentEndLocation;
+	SamplerState.PreviousDeltaTime = FrameDeltaTime;
+	SamplerState.bHasOlderSample = bHadPreviousSample;
 }
+#pragma endregion 
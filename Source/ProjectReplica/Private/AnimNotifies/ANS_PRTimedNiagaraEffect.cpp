@@ -4,39 +4,62 @@
 #include "AnimNotifies/ANS_PRTimedNiagaraEffect.h"
 #include "Characters/PRBaseCharacter.h"
 #include "Components/PREffectSystemComponent.h"
+#include "Effects/PRNiagaraEffect.h"
 
 UANS_PRTimedNiagaraEffect::UANS_PRTimedNiagaraEffect(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 {
-	NiagaraEffect = nullptr;
+	SpawnedNiagaraEffectsPurgeThreshold = 16;
+	bAllowSpawnCulling = false;
 }
 
 void UANS_PRTimedNiagaraEffect::NotifyBegin(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation,	float TotalDuration, const FAnimNotifyEventReference& EventReference)
 {
-	NiagaraEffect = SpawnNiagaraEffect(MeshComp);
-	if(IsValid(NiagaraEffect))
+	PurgeStaleAnimNotifyInstances(SpawnedNiagaraEffects, SpawnedNiagaraEffectsPurgeThreshold);
+	
+	APRNiagaraEffect* SpawnedNiagaraEffect = SpawnNiagaraEffect(MeshComp);
+	if(IsValid(SpawnedNiagaraEffect))
 	{
+		SpawnedNiagaraEffects.Add(FPRAnimNotifyInstanceKey(MeshComp, EventReference), SpawnedNiagaraEffect);
+
+		// 이전 버전의 블루프린트가 사용할 수 있도록 마지막으로 Spawn한 NiagaraEffect를 기록합니다.
+		NiagaraEffect = SpawnedNiagaraEffect;
 		UAnimNotifyState::NotifyBegin(MeshComp, Animation, TotalDuration, EventReference);
+		return;
 	}
-	else
+
+	// EffectSystem에서 컬링된 Effect는 일반적인 방법으로도 Spawn하지 않습니다.
+	const APRBaseCharacter* PROwner = Cast<APRBaseCharacter>(MeshComp->GetOwner());
+	if(IsValid(PROwner) && PROwner->GetEffectSystem() && PROwner->GetEffectSystem()->WasLastSpawnCulled())
 	{
-		Super::NotifyBegin(MeshComp, Animation, TotalDuration, EventReference);
+		UAnimNotifyState::NotifyBegin(MeshComp, Animation, TotalDuration, EventReference);
+		return;
 	}
+
+	Super::NotifyBegin(MeshComp, Animation, TotalDuration, EventReference);
 }
 
 void UANS_PRTimedNiagaraEffect::NotifyEnd(class USkeletalMeshComponent* MeshComp, class UAnimSequenceBase* Animation, const FAnimNotifyEventReference& EventReference)
 {
-	if(IsValid(NiagaraEffect))
+	TPRSpawnedEffectHandle<APRNiagaraEffect> NiagaraEffectHandle;
+	if(SpawnedNiagaraEffects.RemoveAndCopyValue(FPRAnimNotifyInstanceKey(MeshComp, EventReference), NiagaraEffectHandle))
 	{
+		APRNiagaraEffect* SpawnedNiagaraEffect = NiagaraEffectHandle.Get();
 		APRBaseCharacter* PROwner = Cast<APRBaseCharacter>(MeshComp->GetOwner());
-		if(IsValid(PROwner))
+		if(IsValid(PROwner) && IsValid(SpawnedNiagaraEffect))
 		{
 			UPREffectSystemComponent* EffectSystem = PROwner->GetEffectSystem();
-			if(EffectSystem)
+			// Lifespan이 만료되어 이미 Pool로 돌아간 NiagaraEffect는 다른 인스턴스나 공유 Pool의 다른 Owner가 사용 중일 수 있으므로 비활성화하지 않습니다.
+			if(EffectSystem && EffectSystem->IsActivateNiagaraEffect(SpawnedNiagaraEffect))
 			{
-				EffectSystem->DeactivateObject(NiagaraEffect);
+				EffectSystem->DeactivateObject(SpawnedNiagaraEffect);
 			}
 		}
+
+		if(NiagaraEffect == SpawnedNiagaraEffect)
+		{
+			NiagaraEffect = nullptr;
+		}
 	}
 	else
 	{
@@ -54,10 +77,21 @@ APRNiagaraEffect* UANS_PRTimedNiagaraEffect::SpawnNiagaraEffect(USkeletalMeshCom
 			UPREffectSystemComponent* EffectSystem = PROwner->GetEffectSystem();
 			if(EffectSystem)
 			{
-				return EffectSystem->SpawnNiagaraEffectAttached(Template, MeshComp, SocketName, LocationOffset, RotationOffset);
+				return EffectSystem->SpawnNiagaraEffectAttached(Template, MeshComp, SocketName, LocationOffset, RotationOffset, FVector(1.0f), true, false, bAllowSpawnCulling);
 			}
 		}
 	}
 	
 	return nullptr;
 }
+
+APRNiagaraEffect* UANS_PRTimedNiagaraEffect::FindSpawnedNiagaraEffect(USkeletalMeshComponent* MeshComp, const FAnimNotifyEventReference& EventReference) const
+{
+	const TPRSpawnedEffectHandle<APRNiagaraEffect>* NiagaraEffectHandle = SpawnedNiagaraEffects.Find(FPRAnimNotifyInstanceKey(MeshComp, EventReference));
+	if(NiagaraEffectHandle)
+	{
+		return NiagaraEffectHandle->Get();
+	}
+
+	return nullptr;
+}
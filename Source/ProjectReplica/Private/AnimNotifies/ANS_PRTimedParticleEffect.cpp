@@ -4,39 +4,62 @@
 #include "AnimNotifies/ANS_PRTimedParticleEffect.h"
 #include "Characters/PRBaseCharacter.h"
 #include "Components/PREffectSystemComponent.h"
+#include "Effects/PRParticleEffect.h"
 
 UANS_PRTimedParticleEffect::UANS_PRTimedParticleEffect(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 {
-	ParticleEffect = nullptr;
+	SpawnedParticleEffectsPurgeThreshold = 16;
+	bAllowSpawnCulling = false;
 }
 
 void UANS_PRTimedParticleEffect::NotifyBegin(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, float TotalDuration, const FAnimNotifyEventReference& EventReference)
 {
-	ParticleEffect = SpawnParticleEffect(MeshComp);
-	if(IsValid(ParticleEffect))
+	PurgeStaleAnimNotifyInstances(SpawnedParticleEffects, SpawnedParticleEffectsPurgeThreshold);
+	
+	APRParticleEffect* SpawnedParticleEffect = SpawnParticleEffect(MeshComp);
+	if(IsValid(SpawnedParticleEffect))
 	{
+		SpawnedParticleEffects.Add(FPRAnimNotifyInstanceKey(MeshComp, EventReference), SpawnedParticleEffect);
+
+		// 이전 버전의 블루프린트가 사용할 수 있도록 마지막으로 Spawn한 ParticleEffect를 기록합니다.
+		ParticleEffect = SpawnedParticleEffect;
 		UAnimNotifyState::NotifyBegin(MeshComp, Animation, TotalDuration, EventReference);
+		return;
 	}
-	else
+
+	// EffectSystem에서 컬링된 Effect는 일반적인 방법으로도 Spawn하지 않습니다.
+	const APRBaseCharacter* PROwner = Cast<APRBaseCharacter>(MeshComp->GetOwner());
+	if(IsValid(PROwner) && PROwner->GetEffectSystem() && PROwner->GetEffectSystem()->WasLastSpawnCulled())
 	{
-		Super::NotifyBegin(MeshComp, Animation, TotalDuration, EventReference);
+		UAnimNotifyState::NotifyBegin(MeshComp, Animation, TotalDuration, EventReference);
+		return;
 	}
+
+	Super::NotifyBegin(MeshComp, Animation, TotalDuration, EventReference);
 }
 
 void UANS_PRTimedParticleEffect::NotifyEnd(class USkeletalMeshComponent* MeshComp, class UAnimSequenceBase* Animation, const FAnimNotifyEventReference& EventReference)
 {
-	if(IsValid(ParticleEffect))
+	TPRSpawnedEffectHandle<APRParticleEffect> ParticleEffectHandle;
+	if(SpawnedParticleEffects.RemoveAndCopyValue(FPRAnimNotifyInstanceKey(MeshComp, EventReference), ParticleEffectHandle))
 	{
+		APRParticleEffect* SpawnedParticleEffect = ParticleEffectHandle.Get();
 		APRBaseCharacter* PROwner = Cast<APRBaseCharacter>(MeshComp->GetOwner());
-		if(IsValid(PROwner))
+		if(IsValid(PROwner) && IsValid(SpawnedParticleEffect))
 		{
 			UPREffectSystemComponent* EffectSystem = PROwner->GetEffectSystem();
-			if(EffectSystem)
+			// Lifespan이 만료되어 이미 Pool로 돌아간 ParticleEffect는 다른 인스턴스가 사용 중일 수 있으므로 비활성화하지 않습니다.
+			if(EffectSystem && EffectSystem->IsActivateObject(SpawnedParticleEffect))
 			{
-				EffectSystem->DeactivateObject(ParticleEffect);
+				EffectSystem->DeactivateObject(SpawnedParticleEffect);
 			}
 		}
+
+		if(ParticleEffect == SpawnedParticleEffect)
+		{
+			ParticleEffect = nullptr;
+		}
 	}
 	else
 	{
@@ -54,10 +77,21 @@ APRParticleEffect* UANS_PRTimedParticleEffect::SpawnParticleEffect(USkeletalMesh
 			UPREffectSystemComponent* EffectSystem = PROwner->GetEffectSystem();
 			if(EffectSystem)
 			{
-				return EffectSystem->SpawnParticleEffectAttached(PSTemplate, MeshComp, SocketName, LocationOffset, RotationOffset);
+				return EffectSystem->SpawnParticleEffectAttached(PSTemplate, MeshComp, SocketName, LocationOffset, RotationOffset, FVector(1.0f), true, false, bAllowSpawnCulling);
 			}
 		}
 	}
 	
 	return nullptr;
 }
+
+APRParticleEffect* UANS_PRTimedParticleEffect::FindSpawnedParticleEffect(USkeletalMeshComponent* MeshComp, const FAnimNotifyEventReference& EventReference) const
+{
+	const TPRSpawnedEffectHandle<APRParticleEffect>* ParticleEffectHandle = SpawnedParticleEffects.Find(FPRAnimNotifyInstanceKey(MeshComp, EventReference));
+	if(ParticleEffectHandle)
+	{
+		return ParticleEffectHandle->Get();
+	}
+
+	return nullptr;
+}
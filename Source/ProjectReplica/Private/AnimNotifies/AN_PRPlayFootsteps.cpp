@@ -5,6 +5,7 @@
 #include "Characters/PRBaseCharacter.h"
 #include "Components/AudioComponent.h"
 #include "Kismet/GameplayStatics.h"
+#include "Subsystems/PRAsyncTraceSubsystem.h"
 
 UAN_PRPlayFootsteps::UAN_PRPlayFootsteps(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
@@ -29,33 +30,35 @@ void UAN_PRPlayFootsteps::PlayFootsteps(USkeletalMeshComponent* MeshComp)
 		APRBaseCharacter* PROwner = Cast<APRBaseCharacter>(MeshComp->GetOwner());
 		if(IsValid(PROwner) && PROwner->GetFootstepsSound())
 		{
-			FHitResult HitResult;
-			const FVector TraceStart = MeshComp->GetOwner()->GetActorLocation();
-			const FVector TraceEnd = TraceStart - FVector(0.0f, 0.0f, TraceDistance);
-			TArray<AActor*> ActorsToIgnore;
-			ActorsToIgnore.Add(MeshComp->GetOwner());
-
-			EDrawDebugTrace::Type DebugType = EDrawDebugTrace::None;
-			if(bDebug)
+			UPRAsyncTraceSubsystem* AsyncTrace = MeshComp->GetWorld()->GetSubsystem<UPRAsyncTraceSubsystem>();
+			if(!AsyncTrace)
 			{
-				DebugType = EDrawDebugTrace::ForDuration;
+				return;
 			}
+			
+			const FVector TraceStart = MeshComp->GetOwner()->GetActorLocation();
+			const FVector TraceEnd = TraceStart - FVector(0.0f, 0.0f, TraceDistance);
 
-			bool bIsHit = UKismetSystemLibrary::LineTraceSingle(MeshComp->GetWorld(), TraceStart, TraceEnd, UEngineTypes::ConvertToTraceType(ECC_Visibility),
-																true, ActorsToIgnore, DebugType, HitResult, true);
-			if(bIsHit)
+			// 발소리를 출력할 표면의 피직스 머테리얼을 비동기 Trace로 탐색하고 다음 프레임에 발소리를 재생합니다.
+			const FPRAsyncTraceRequest Request(TraceStart, TraceEnd, 0.0f, PROwner, true, true, bDebug);
+			AsyncTrace->RequestTrace(EPRAsyncTraceFeature::AsyncTraceFeature_Footsteps, Request,
+									FPRAsyncTraceBatchDelegate::CreateWeakLambda(PROwner, [PROwner](TConstArrayView<FHitResult> HitResults)
 			{
-				UAudioComponent* FootstepsAudioComp = UGameplayStatics::SpawnSoundAtLocation(MeshComp->GetWorld(), PROwner->GetFootstepsSound(), HitResult.Location);
-				if(IsValid(FootstepsAudioComp))
+				const FHitResult& HitResult = HitResults[0];
+				if(HitResult.bBlockingHit && PROwner->GetFootstepsSound())
 				{
-					FootstepsAudioComp->Play();
-					FootstepsAudioComp->SetIntParameter(TEXT("Gender"), static_cast<int32>(PROwner->GetGender()));
-					FootstepsAudioComp->SetIntParameter(TEXT("SurfaceType"), static_cast<int32>(UGameplayStatics::GetSurfaceType(HitResult)));
-					// FootstepAudioComp->SetFloatParameter(TEXT("VolumeMultiplier"), VolumeMultiplier);
-					// FootstepAudioComp->SetFloatParameter(TEXT("PitchMultiplier"), PitchMultiplier);
-					// FootstepAudioComp->SetBoolParameter(TEXT("PlayFootstep"), bPlayFootstep);
+					UAudioComponent* FootstepsAudioComp = UGameplayStatics::SpawnSoundAtLocation(PROwner->GetWorld(), PROwner->GetFootstepsSound(), HitResult.Location);
+					if(IsValid(FootstepsAudioComp))
+					{
+						FootstepsAudioComp->Play();
+						FootstepsAudioComp->SetIntParameter(TEXT("Gender"), static_cast<int32>(PROwner->GetGender()));
+						FootstepsAudioComp->SetIntParameter(TEXT("SurfaceType"), static_cast<int32>(UGameplayStatics::GetSurfaceType(HitResult)));
+						// FootstepAudioComp->SetFloatParameter(TEXT("VolumeMultiplier"), VolumeMultiplier);
+						// FootstepAudioComp->SetFloatParameter(TEXT("PitchMultiplier"), PitchMultiplier);
+						// FootstepAudioComp->SetBoolParameter(TEXT("PlayFootstep"), bPlayFootstep);
+					}
 				}
-			}
+			}));
 		}
 	}
 }
@@ -2,12 +2,23 @@
 
 
 #include "AnimNotifies/AN_PRPlayNiagaraEffect.h"
+#include "AnimNotifies/PRAnimNotifyInstanceKey.h"
 #include "Characters/PRBaseCharacter.h"
 #include "Components/PREffectSystemComponent.h"
+#include "Common/PRSocketTransformCache.h"
 #include "NiagaraComponent.h"
 #include "NiagaraFunctionLibrary.h"
 #include "Effects/PRNiagaraEffect.h"
 
+UAN_PRPlayNiagaraEffect::UAN_PRPlayNiagaraEffect()
+{
+	LoopingEffectLifespan = -1.0f;
+	LoopingEffectName = NAME_None;
+	bStopPreviousLoopingEffect = true;
+	bAllowSpawnCulling = false;
+	LoopingEffectHandlesPurgeThreshold = 16;
+}
+
 UFXSystemComponent* UAN_PRPlayNiagaraEffect::SpawnEffect(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation)
 {
 	UFXSystemComponent* ReturnComp = nullptr;
@@ -15,44 +26,86 @@ UFXSystemComponent* UAN_PRPlayNiagaraEffect::SpawnEffect(USkeletalMeshComponent*
 	// Template이 유효한지 확인합니다.
 	if(Template)
 	{
-		// Template이 루프되는지 확인하고, 루프되면 Spawn하지 않습니다.
-		if(Template->IsLooping())
-		{
-			return ReturnComp;
-		}
-
 		// EffectSystem에 Effect가 존재할 경우 EffectSystem에서 Effect를 가져와 Spawn합니다.
 		APRBaseCharacter* PROwner = Cast<APRBaseCharacter>(MeshComp->GetOwner());
-		if(IsValid(PROwner))
+		UPREffectSystemComponent* EffectSystem = IsValid(PROwner) ? PROwner->GetEffectSystem() : nullptr;
+
+		// Template이 루프되는지 확인하고, 루프되면 EffectSystem의 반복 재생 목록에 등록하여 Spawn합니다.
+		// EffectSystem이 없으면 정지할 수 없으므로 Spawn하지 않습니다.
+		if(Template->IsLooping())
 		{
-			UPREffectSystemComponent* EffectSystem = PROwner->GetEffectSystem();
 			if(EffectSystem)
 			{
-				APRNiagaraEffect* SpawnNiagaraEffect = nullptr;
-				// Attached가 true이면 특정 소켓에 연결된 위치에 Effect를 Spawn합니다.
+				if(bStopPreviousLoopingEffect)
+				{
+					StopLoopingEffect(MeshComp);
+				}
+
+				FPRLoopingEffectHandle LoopingEffectHandle;
 				if(Attached)
 				{
-					SpawnNiagaraEffect = EffectSystem->SpawnNiagaraEffectAttached(Template, MeshComp, SocketName, LocationOffset, RotationOffset, Scale, true);
+					LoopingEffectHandle = EffectSystem->SpawnLoopingNiagaraEffectAttached(Template, MeshComp, SocketName, LocationOffset, RotationOffset, Scale, LoopingEffectLifespan, LoopingEffectName);
 				}
 				else
 				{
-					// 특정 위치에 Effect를 Spawn합니다.
-					const FTransform MeshTransform = MeshComp->GetSocketTransform(SocketName);
-					SpawnNiagaraEffect = EffectSystem->SpawnNiagaraEffectAtLocation(Template, MeshTransform.TransformPosition(LocationOffset), (MeshTransform.GetRotation() * RotationOffsetQuat).Rotator(), Scale, true);
+					const FTransform MeshTransform = FPRSocketTransformCache::GetSocketTransform(MeshComp, SocketName);
+					LoopingEffectHandle = EffectSystem->SpawnLoopingNiagaraEffectAtLocation(Template, MeshTransform.TransformPosition(LocationOffset), (MeshTransform.GetRotation() * RotationOffsetQuat).Rotator(), Scale, LoopingEffectLifespan, LoopingEffectName);
+				}
+
+				// 정지할 수 있도록 MeshComponent별로 Handle을 보관합니다.
+				if(LoopingEffectHandle.IsValid())
+				{
+					PurgeStaleAnimNotifyInstances(LoopingEffectHandles, LoopingEffectHandlesPurgeThreshold);
+					LoopingEffectHandles.Add(MeshComp, LoopingEffectHandle);
 				}
 
-				if(IsValid(SpawnNiagaraEffect))
+				APRNiagaraEffect* LoopingNiagaraEffect = EffectSystem->GetLoopingNiagaraEffect(LoopingEffectHandle);
+				if(IsValid(LoopingNiagaraEffect))
 				{
-					ReturnComp = SpawnNiagaraEffect->GetFXSystemComponent();
+					ReturnComp = LoopingNiagaraEffect->GetFXSystemComponent();
 					if(ReturnComp)
 					{
 						ReturnComp->SetUsingAbsoluteScale(bAbsoluteScale);
 						ReturnComp->SetRelativeScale3D_Direct(Scale);
-
-						return ReturnComp;
 					}
 				}
 			}
+			
+			return ReturnComp;
+		}
+
+		if(EffectSystem)
+		{
+			APRNiagaraEffect* SpawnNiagaraEffect = nullptr;
+			// Attached가 true이면 특정 소켓에 연결된 위치에 Effect를 Spawn합니다.
+			if(Attached)
+			{
+				SpawnNiagaraEffect = EffectSystem->SpawnNiagaraEffectAttached(Template, MeshComp, SocketName, LocationOffset, RotationOffset, Scale, true, false, bAllowSpawnCulling);
+			}
+			else
+			{
+				// 특정 위치에 Effect를 Spawn합니다.
+				const FTransform MeshTransform = FPRSocketTransformCache::GetSocketTransform(MeshComp, SocketName);
+				SpawnNiagaraEffect = EffectSystem->SpawnNiagaraEffectAtLocation(Template, MeshTransform.TransformPosition(LocationOffset), (MeshTransform.GetRotation() * RotationOffsetQuat).Rotator(), Scale, true, false, bAllowSpawnCulling);
+			}
+
+			if(IsValid(SpawnNiagaraEffect))
+			{
+				ReturnComp = SpawnNiagaraEffect->GetFXSystemComponent();
+				if(ReturnComp)
+				{
+					ReturnComp->SetUsingAbsoluteScale(bAbsoluteScale);
+					ReturnComp->SetRelativeScale3D_Direct(Scale);
+
+					return ReturnComp;
+				}
+			}
+			
+			// EffectSystem에서 컬링된 Effect는 일반적인 방법으로도 Spawn하지 않습니다.
+			if(EffectSystem->WasLastSpawnCulled())
+			{
+				return nullptr;
+			}
 		}
 
 		// EffectSystem이 없거나 Effect가 존재하지 않을 경우 일반적인 방법으로 Effect를 Spawn합니다.
@@ -62,7 +115,7 @@ UFXSystemComponent* UAN_PRPlayNiagaraEffect::SpawnEffect(USkeletalMeshComponent*
 		}
 		else
 		{
-			const FTransform MeshTransform = MeshComp->GetSocketTransform(SocketName);
+			const FTransform MeshTransform = FPRSocketTransformCache::GetSocketTransform(MeshComp, SocketName);
 			ReturnComp = UNiagaraFunctionLibrary::SpawnSystemAtLocation(MeshComp->GetWorld(), Template, MeshTransform.TransformPosition(LocationOffset), (MeshTransform.GetRotation() * RotationOffsetQuat).Rotator(), FVector(1.0f),true);
 		}
 
@@ -75,3 +128,18 @@ UFXSystemComponent* UAN_PRPlayNiagaraEffect::SpawnEffect(USkeletalMeshComponent*
 	
 	return ReturnComp;
 }
+
+bool UAN_PRPlayNiagaraEffect::StopLoopingEffect(USkeletalMeshComponent* MeshComp)
+{
+	FPRLoopingEffectHandle LoopingEffectHandle;
+	if(!LoopingEffectHandles.RemoveAndCopyValue(MeshComp, LoopingEffectHandle))
+	{
+		return false;
+	}
+
+	// 수명이 끝나 이미 정지된 NiagaraEffect의 Handle은 EffectSystem에서 무시합니다.
+	APRBaseCharacter* PROwner = IsValid(MeshComp) ? Cast<APRBaseCharacter>(MeshComp->GetOwner()) : nullptr;
+	UPREffectSystemComponent* EffectSystem = IsValid(PROwner) ? PROwner->GetEffectSystem() : nullptr;
+
+	return EffectSystem && EffectSystem->StopLoopingNiagaraEffect(LoopingEffectHandle);
+}
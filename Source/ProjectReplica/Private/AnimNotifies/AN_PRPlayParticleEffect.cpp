@@ -4,10 +4,16 @@
 #include "AnimNotifies/AN_PRPlayParticleEffect.h"
 #include "Characters/PRBaseCharacter.h"
 #include "Components/PREffectSystemComponent.h"
+#include "Common/PRSocketTransformCache.h"
 #include "Particles/ParticleSystem.h"
 #include "Effects/PRParticleEffect.h"
 #include "Kismet/GameplayStatics.h"
 
+UAN_PRPlayParticleEffect::UAN_PRPlayParticleEffect()
+{
+	bAllowSpawnCulling = false;
+}
+
 UParticleSystemComponent* UAN_PRPlayParticleEffect::SpawnParticleSystem(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation)
 {
 	UParticleSystemComponent* ReturnComp = nullptr;
@@ -32,13 +38,13 @@ UParticleSystemComponent* UAN_PRPlayParticleEffect::SpawnParticleSystem(USkeleta
 				// Attached가 true이면 특정 소켓에 연결된 위치에 Effect를 Spawn합니다.
 				if(Attached)
 				{
-					SpawnParticleEffect = EffectSystem->SpawnParticleEffectAttached(PSTemplate, MeshComp, SocketName, LocationOffset, RotationOffset, Scale, true);
+					SpawnParticleEffect = EffectSystem->SpawnParticleEffectAttached(PSTemplate, MeshComp, SocketName, LocationOffset, RotationOffset, Scale, true, false, bAllowSpawnCulling);
 				}
 				else
 				{
 					// 특정 위치에 Effect를 Spawn합니다.
-					const FTransform MeshTransform = MeshComp->GetSocketTransform(SocketName);
-					SpawnParticleEffect = EffectSystem->SpawnParticleEffectAtLocation(PSTemplate, MeshTransform.TransformPosition(LocationOffset), (MeshTransform.GetRotation() * FQuat(RotationOffset)).Rotator(), Scale, true);
+					const FTransform MeshTransform = FPRSocketTransformCache::GetSocketTransform(MeshComp, SocketName);
+					SpawnParticleEffect = EffectSystem->SpawnParticleEffectAtLocation(PSTemplate, MeshTransform.TransformPosition(LocationOffset), (MeshTransform.GetRotation() * FQuat(RotationOffset)).Rotator(), Scale, true, false, bAllowSpawnCulling);
 				}
 
 				if(IsValid(SpawnParticleEffect))
@@ -49,6 +55,12 @@ UParticleSystemComponent* UAN_PRPlayParticleEffect::SpawnParticleSystem(USkeleta
 						return ReturnComp;
 					}
 				}
+
+				// EffectSystem에서 컬링된 Effect는 일반적인 방법으로도 Spawn하지 않습니다.
+				if(EffectSystem->WasLastSpawnCulled())
+				{
+					return nullptr;
+				}
 			}
 		}
 
@@ -59,7 +71,7 @@ UParticleSystemComponent* UAN_PRPlayParticleEffect::SpawnParticleSystem(USkeleta
 		}
 		else
 		{
-			const FTransform MeshTransform = MeshComp->GetSocketTransform(SocketName);
+			const FTransform MeshTransform = FPRSocketTransformCache::GetSocketTransform(MeshComp, SocketName);
 			FTransform SpawnTransform;
 			SpawnTransform.SetLocation(MeshTransform.TransformPosition(LocationOffset));
 			SpawnTransform.SetRotation(MeshTransform.GetRotation() * FQuat(RotationOffset));
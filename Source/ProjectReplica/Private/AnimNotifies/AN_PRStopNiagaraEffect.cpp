@@ -0,0 +1,44 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "AnimNotifies/AN_PRStopNiagaraEffect.h"
+#include "AnimNotifies/AN_PRPlayNiagaraEffect.h"
+#include "Animation/AnimSequenceBase.h"
+
+UAN_PRStopNiagaraEffect::UAN_PRStopNiagaraEffect(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	LoopingEffectName = NAME_None;
+}
+
+void UAN_PRStopNiagaraEffect::Notify(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, const FAnimNotifyEventReference& EventReference)
+{
+	Super::Notify(MeshComp, Animation, EventReference);
+
+	if(!MeshComp || !Animation)
+	{
+		return;
+	}
+
+	// 같은 애니메이션에서 NiagaraEffect를 Spawn한 Notify를 찾아 이 MeshComponent에서 Spawn한 NiagaraEffect를 정지합니다.
+	for(const FAnimNotifyEvent& NotifyEvent : Animation->Notifies)
+	{
+		UAN_PRPlayNiagaraEffect* PlayNiagaraEffect = Cast<UAN_PRPlayNiagaraEffect>(NotifyEvent.Notify);
+		if(PlayNiagaraEffect
+			&& (LoopingEffectName == NAME_None || PlayNiagaraEffect->GetLoopingEffectName() == LoopingEffectName))
+		{
+			PlayNiagaraEffect->StopLoopingEffect(MeshComp);
+		}
+	}
+}
+
+FString UAN_PRStopNiagaraEffect::GetNotifyName_Implementation() const
+{
+	FString NewNotifyName = TEXT("Stop Niagara Effect");
+	if(LoopingEffectName != NAME_None)
+	{
+		NewNotifyName.Append(FString::Printf(TEXT(" (%s)"), *LoopingEffectName.ToString()));
+	}
+
+	return NewNotifyName;
+}
@@ -2,6 +2,7 @@
 
 
 #include "Characters/PRBaseCharacter.h"
+#include "ProjectReplicaGameInstance.h"
 #include "Components/CapsuleComponent.h"
 #include "Components/PRDamageSystemComponent.h"
 #include "Components/PRStatSystemComponent.h"
@@ -10,12 +11,15 @@
 #include "Components/PREffectSystemComponent.h"
 #include "Components/PRMovementSystemComponent.h"
 #include "Components/PRWeaponSystemComponent.h"
+#include "Subsystems/PRDamageQueueSubsystem.h"
+#include "Subsystems/PRDamageableSpatialHashSubsystem.h"
+#include "Interfaces/PRInterfaceDispatch.h"
+#include "Weapons/PRBaseWeapon.h"
 #include "MotionWarpingComponent.h"
 #include "GameFramework/CharacterMovementComponent.h"
 
 // 임시
 #include "NiagaraComponent.h"
-#include "NiagaraFunctionLibrary.h"
 
 APRBaseCharacter::APRBaseCharacter()
 {
@@ -54,6 +58,8 @@ APRBaseCharacter::APRBaseCharacter()
 
 	// DamageSystem
 	DamageSystem = CreateDefaultSubobject<UPRDamageSystemComponent>(TEXT("DamageSystem"));
+	CombatRandomSeed = 0;
+	bUseMeleeHitWindow = false;
 	
 	// StatSystem
 	StatSystem = CreateDefaultSubobject<UPRStatSystemComponent>(TEXT("StatSystem"));
@@ -86,9 +92,9 @@ void APRBaseCharacter::PostInitializeComponents()
 	Super::PostInitializeComponents();
 
 	// DamageSystem
-	GetDamageSystem()->OnDeathDelegate.AddDynamic(this, &APRBaseCharacter::Death);
-	GetDamageSystem()->OnBlockedDelegate.AddDynamic(this, &APRBaseCharacter::Blocked);
-	GetDamageSystem()->OnDamageResponseDelegate.AddDynamic(this, &APRBaseCharacter::DamageResponse);
+	GetDamageSystem()->OnDeathNativeDelegate.AddUObject(this, &APRBaseCharacter::Death);
+	GetDamageSystem()->OnBlockedNativeDelegate.AddUObject(this, &APRBaseCharacter::Blocked);
+	GetDamageSystem()->OnDamageResponseNativeDelegate.AddUObject(this, &APRBaseCharacter::DamageResponse);
 
 	// ObjectPoolSystem
 	GetObjectPoolSystem()->InitializeObjectPool();
@@ -104,6 +110,9 @@ void APRBaseCharacter::BeginPlay()
 {
 	Super::BeginPlay();
 
+	// DamageSystem
+	SetCombatRandomSeed(CombatRandomSeed);
+
 	// WeaponSystem
 	GetWeaponSystem()->InitializeWeaponSystem();
 }
@@ -163,6 +172,10 @@ void APRBaseCharacter::Death()
 	// Collision을 비활성화합니다.
 	SetActorEnableCollision(false);
 
+	// 반복 재생 중인 이펙트와 공유 Pool에서 가져온 이펙트를 Pool로 반환합니다.
+	GetEffectSystem()->StopAllLoopingNiagaraEffects();
+	GetEffectSystem()->ReleaseSharedNiagaraEffects();
+
 	// 사망 애니메이션 실행
 }
 
@@ -183,68 +196,124 @@ void APRBaseCharacter::DoDamage()
 		return;
 	}
 	
-	TArray<FHitResult> HitResults;
-	bool bIsHit = false;
 	const FVector TraceStart = GetActorLocation();
 	const FVector TraceEnd = TraceStart + GetActorForwardVector() * 100.0f;
-	TArray<TEnumAsByte<EObjectTypeQuery>> ObjectTypes;
-	
-	// ObjectTypeQuery3 = ObjectType Pawn
-	ObjectTypes.Emplace(EObjectTypeQuery::ObjectTypeQuery3);
-			
-	// 자신을 Trace 대상에서 제외합니다.
-	TArray<AActor*> ActorsToIgnore;
-	ActorsToIgnore.Emplace(this);
+	const float TraceRadius = 20.0f;
 
 	// Debug 실행을 설정합니다.
-	EDrawDebugTrace::Type DebugType = EDrawDebugTrace::None;
 	if(bDamageSystemDebug)
 	{
-		DebugType = EDrawDebugTrace::ForDuration;
+		DrawDebugCapsule(GetWorld(), (TraceStart + TraceEnd) * 0.5f, (TraceEnd - TraceStart).Size() * 0.5f + TraceRadius,
+							TraceRadius, FRotationMatrix::MakeFromZ(TraceEnd - TraceStart).ToQuat(), FColor::Red, false, 5.0f);
+	}
+
+	// 물리 Trace 대신 대미지를 받을 수 있는 액터의 공간 해시에서 자신을 제외한 대상을 검색합니다.
+	UPRDamageableSpatialHashSubsystem* DamageableSpatialHash = GetWorld()->GetSubsystem<UPRDamageableSpatialHashSubsystem>();
+	if(!DamageableSpatialHash)
+	{
+		return;
+	}
+
+	TArray<FPRDamageableQueryResult> QueryResults;
+	if(DamageableSpatialHash->QueryCapsule(TraceStart, TraceEnd, TraceRadius, this, QueryResults) > 0)
+	{
+		ApplyMeleeDamage(QueryResults);
+	}
+}
+
+void APRBaseCharacter::ApplyMeleeDamage(TConstArrayView<FPRDamageableQueryResult> HitResults)
+{
+	if(HitResults.Num() == 0 || IsDead() || !GetStatSystem())
+	{
+		return;
+	}
+
+	// 대미지는 대미지 큐에 추가하여 액터의 Tick이 끝난 후 대상별로 한 번에 처리합니다.
+	UPRDamageQueueSubsystem* DamageQueue = GetWorld()->GetSubsystem<UPRDamageQueueSubsystem>();
+
+	const FPRCharacterStat CharacterStat = GetStatSystem()->GetCharacterStat();
+	const FPRWeaponStat WeaponStat = GetWeaponSystem() && GetWeaponSystem()->GetEquippedWeapon()
+										? GetWeaponSystem()->GetEquippedWeapon()->GetWeaponStat()
+										: FPRWeaponStat();
+
+	// 능력치가 없는 대상은 방어력과 체력을 0으로 계산합니다.
+	const FPRCharacterStat EmptyTargetStat(0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f);
+
+	TArray<AActor*, TInlineAllocator<8>> HitActors;
+	TArray<FPRDamageInfo, TInlineAllocator<8>> DamageInfos;
+	TArray<FPRCharacterStat, TInlineAllocator<8>> TargetStats;
+	TArray<FPRDamageFormulaInputs, TInlineAllocator<8>> FormulaInputs;
+	for(const FPRDamageableQueryResult& HitResult : HitResults)
+	{
+		if(!IsValid(HitResult.Actor))
+		{
+			continue;
+		}
+		
+		FPRDamageInfo DamageInfo;
+		DamageInfo.DamageType = EPRDamageType::DamageType_Melee;
+		DamageInfo.DamageElementType = DamageElementType;
+		DamageInfo.DamageResponse = EPRDamageResponse::DamageResponse_HitReaction;
+		DamageInfo.ImpactLocation = HitResult.ImpactPoint;
+
+		const APRBaseCharacter* TargetCharacter = Cast<APRBaseCharacter>(HitResult.Actor);
+		HitActors.Emplace(HitResult.Actor);
+		DamageInfos.Emplace(DamageInfo);
+		TargetStats.Emplace(IsValid(TargetCharacter) && TargetCharacter->GetStatSystem()
+								? TargetCharacter->GetStatSystem()->GetCharacterStat()
+								: EmptyTargetStat);
 	}
 
-	TSet<AActor*> UniqueActors;
+	// 이번 공격에 맞은 모든 대상의 치명타 여부를 캐릭터의 난수 스트림으로 한 번에 판정합니다.
+	TArray<uint8, TInlineAllocator<8>> Criticals;
+	Criticals.SetNumUninitialized(HitActors.Num());
+	CombatRandomStream.RollCriticals(CharacterStat.CriticalRate, Criticals);
 
-	bIsHit = UKismetSystemLibrary::SphereTraceMultiForObjects(GetWorld(), TraceStart, TraceEnd, 20.0f, ObjectTypes, false, ActorsToIgnore, DebugType, HitResults, true);
-	if(bIsHit)
+	FormulaInputs.Reserve(HitActors.Num());
+	for(int32 Index = 0; Index < HitActors.Num(); Index++)
 	{
-		for(FHitResult HitResult : HitResults)
+		DamageInfos[Index].bIsCritical = Criticals[Index] != 0;
+		FormulaInputs.Emplace(FPRDamageFormulaInputs::Make(CharacterStat, WeaponStat, TargetStats[Index], DamageElementType, DamageInfos[Index].bIsCritical, DamageAmount));
+	}
+
+	// 이번 공격에 맞은 모든 대상의 대미지를 대미지 공식으로 한 번에 계산합니다.
+	TArray<float, TInlineAllocator<8>> Damages;
+	Damages.SetNumZeroed(FormulaInputs.Num());
+	const UProjectReplicaGameInstance* PRGameInstance = Cast<UProjectReplicaGameInstance>(GetGameInstance());
+	if(PRGameInstance)
+	{
+		PRGameInstance->GetDamageFormula(EPRDamageType::DamageType_Melee).EvaluateBatch(FormulaInputs, Damages);
+	}
+
+	for(int32 Index = 0; Index < HitActors.Num(); Index++)
+	{
+		DamageInfos[Index].Amount = Damages[Index];
+		if(DamageQueue)
 		{
-			if(IsValid(HitResult.GetActor())
-				&& HitResult.GetActor()->GetClass()->ImplementsInterface(UPRDamageableInterface::StaticClass())
-				&& UniqueActors.Find(HitResult.GetActor()) == nullptr)
-			{
-				UniqueActors.Emplace(HitResult.GetActor());
-				FPRDamageInfo DamageInfo;
-				DamageInfo.DamageType = EPRDamageType::DamageType_Melee;
-				DamageInfo.DamageElementType = DamageElementType;
-				DamageInfo.DamageResponse = EPRDamageResponse::DamageResponse_HitReaction;
-				DamageInfo.ImpactLocation = HitResult.ImpactPoint;
-
-				// 치명타 확률(%)
-				const float CriticalRate = GetStatSystem()->GetCharacterStat().CriticalRate;
-
-				// 확률을 나타내는 Rate 변수와 비교하여 치명타 또는 일반 공격을 판단합니다.
-				float Rate = FMath::FRand() * 100.0f; // 0.0f에서 100.0f 사이의 난수를 생성합니다.
-				if(Rate <= CriticalRate)
-				{
-					DamageInfo.Amount = DamageAmount * GetStatSystem()->GetCharacterStat().CriticalDamage * 0.01f;
-					DamageInfo.bIsCritical = true;
-				}
-				else
-				{
-					DamageInfo.bIsCritical = false;
-					DamageInfo.Amount = DamageAmount;
-				}
-				
-				bool bWasDamaged = IPRDamageableInterface::Execute_TakeDamage(HitResult.GetActor(), DamageInfo);
-				if(bWasDamaged)
-				{
-					// GetEffectSystem()->SpawnNiagaraEffectAtLocation(HitEffect,HitResult.Location);
-					UNiagaraFunctionLibrary::SpawnSystemAtLocation(GetWorld(), HitNiagaraEffect, HitResult.Location);
-				}
-			}
+			DamageQueue->QueueDamage(this, HitActors[Index], DamageInfos[Index]);
 		}
+		else if(FPRDamageableDispatch::TakeDamage(HitActors[Index], DamageInfos[Index], this))
+		{
+			OnDamageApplied(DamageInfos[Index].ImpactLocation);
+		}
+	}
+}
+
+void APRBaseCharacter::SetCombatRandomSeed(int32 NewSeed)
+{
+	CombatRandomSeed = NewSeed;
+
+	// 시드를 지정하지 않은 경우 레벨에서 같은 이름을 가지는 캐릭터가 같은 시드를 사용하도록 이름으로 시드를 만듭니다.
+	const uint32 Seed = NewSeed != 0 ? static_cast<uint32>(NewSeed) : GetTypeHash(GetName());
+	CombatRandomStream.Initialize(Seed);
+}
+
+void APRBaseCharacter::OnDamageApplied(const FVector& ImpactLocation)
+{
+	// 한 프레임에 여러 대상에 적중할 수 있으므로 적중 이펙트는 EffectSystem의 Pool에서 가져옵니다.
+	if(HitNiagaraEffect && GetEffectSystem())
+	{
+		GetEffectSystem()->SpawnNiagaraEffectAtLocation(HitNiagaraEffect, ImpactLocation);
 	}
 }
 #pragma endregion 
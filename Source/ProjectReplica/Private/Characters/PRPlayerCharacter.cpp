@@ -15,7 +15,9 @@
 #include "Components/PRMovementSystemComponent.h"
 #include "MotionWarpingComponent.h"
 #include "Components/PRWeaponSystemComponent.h"
+#include "Common/PRSocketTransformCache.h"
 #include "Controllers/PRPlayerController.h"
+#include "Subsystems/PRAsyncTraceSubsystem.h"
 
 APRPlayerCharacter::APRPlayerCharacter()
 {
@@ -74,6 +76,7 @@ APRPlayerCharacter::APRPlayerCharacter()
 	
 	// Vault
 	bVaultDebug = false;
+	bVaultTracePending = false;
 	bCanVaultWarp = false;
 	VaultStartName = FName("VaultStart");
 	VaultingName = FName("Vaulting");
@@ -508,9 +511,9 @@ void APRPlayerCharacter::DoubleJump()
 	// 더블점프 이펙트 생성
 	if(DoubleJumpNiagaraEffect)
 	{
-		const FVector CenterLocation = GetMesh()->GetSocketLocation(FName("root"));
-		const FVector LeftFootLocation = GetMesh()->GetSocketLocation(FName("foot_l"));
-		const FVector RightFootLocation = GetMesh()->GetSocketLocation(FName("foot_r"));
+		const FVector CenterLocation = FPRSocketTransformCache::GetSocketLocation(GetMesh(), FName("root"));
+		const FVector LeftFootLocation = FPRSocketTransformCache::GetSocketLocation(GetMesh(), FName("foot_l"));
+		const FVector RightFootLocation = FPRSocketTransformCache::GetSocketLocation(GetMesh(), FName("foot_r"));
 		const FVector NewSpawnEffectLocation = FVector(CenterLocation.X, CenterLocation.Y, UKismetMathLibrary::Min(LeftFootLocation.Z, RightFootLocation.Z));
 		// UNiagaraComponent* SpawnNiagaraComponent = UNiagaraFunctionLibrary::SpawnSystemAtLocation(GetWorld(), DoubleJumpNiagaraEffect, NewSpawnEffectLocation);
 		// SpawnNiagaraComponent->SetVariableLinearColor("EffectColor", SignatureEffectColor);
@@ -536,26 +539,36 @@ void APRPlayerCharacter::DoubleJump()
 #pragma region Vaulting
 void APRPlayerCharacter::ExecuteVault()
 {
-	// 뛰어넘을 오브젝트를 탐색합니다.
+	// 이전에 요청한 탐색의 결과를 기다리는 중이면 새로 탐색하지 않습니다.
+	UPRAsyncTraceSubsystem* AsyncTrace = GetWorld()->GetSubsystem<UPRAsyncTraceSubsystem>();
+	if(!AsyncTrace || bVaultTracePending)
+	{
+		return;
+	}
+	
+	// 뛰어넘을 오브젝트를 높이별로 탐색하는 Trace를 한 번에 요청합니다.
+	TArray<FPRAsyncTraceRequest> Requests;
+	Requests.Reserve(VaultableObjectTraceCount);
 	for(int Index = 0; Index < VaultableObjectTraceCount; Index++)
 	{
-		FHitResult HitResult;
 		const FVector TraceStart = GetActorLocation() + FVector(0.0f, 0.0f, Index * VaultableObjectTraceInterval);
 		const FVector TraceEnd = TraceStart + (GetActorForwardVector() * VaultableObjectDistance);
-		TArray<AActor*> ActorsToIgnore;
-		ActorsToIgnore.Add(this);
-
-		// 디버그 옵션을 설정합니다.
-		EDrawDebugTrace::Type DebugType = EDrawDebugTrace::None;
-		if(bVaultDebug)
-		{
-			DebugType = EDrawDebugTrace::ForDuration;
-		}
 
 		// 캐릭터가 뛰어넘을 수 있는 거리 안에 오브젝트가 존재하는 Trace를 실행합니다.
-		bool bIsHit = UKismetSystemLibrary::SphereTraceSingle(GetWorld(), TraceStart, TraceEnd, VaultableObjectTraceRadius, UEngineTypes::ConvertToTraceType(ECC_Visibility),
-																false, ActorsToIgnore, DebugType, HitResult, true);
-		if(bIsHit)
+		Requests.Emplace(TraceStart, TraceEnd, VaultableObjectTraceRadius, this, false, false, bVaultDebug);
+	}
+
+	bVaultTracePending = AsyncTrace->RequestTraceBatch(EPRAsyncTraceFeature::AsyncTraceFeature_Vault, MoveTemp(Requests),
+														FPRAsyncTraceBatchDelegate::CreateUObject(this, &APRPlayerCharacter::OnVaultableObjectTraceCompleted)) != INDEX_NONE;
+}
+
+void APRPlayerCharacter::OnVaultableObjectTraceCompleted(TConstArrayView<FHitResult> HitResults)
+{
+	bVaultTracePending = false;
+	
+	for(const FHitResult& HitResult : HitResults)
+	{
+		if(HitResult.bBlockingHit)
 		{
 			if(bVaultDebug)
 			{
@@ -594,28 +607,39 @@ void APRPlayerCharacter::ResetVaultState()
 
 void APRPlayerCharacter::CalculateVaultableObjectDepth(FVector TraceImpactPoint)
 {
-	// 뛰어넘을 오브젝트의 치수를 계산합니다.
+	UPRAsyncTraceSubsystem* AsyncTrace = GetWorld()->GetSubsystem<UPRAsyncTraceSubsystem>();
+	if(!AsyncTrace)
+	{
+		return;
+	}
+	
+	// 뛰어넘을 오브젝트의 치수를 계산하는 Trace를 거리별로 한 번에 요청합니다.
+	TArray<FPRAsyncTraceRequest> Requests;
+	Requests.Reserve(DepthTraceCount);
 	for(int Index = 0; Index < DepthTraceCount; Index++)
 	{
-		FHitResult HitResult;
 		const FVector TraceStart = TraceImpactPoint
 									+ FVector(0.0f, 0.0f, DepthTraceUpOffset)
 									+ (GetActorForwardVector() * Index * DepthTraceInterval);
 		const FVector TraceEnd = TraceStart - FVector(0.0f, 0.0f, DepthTraceDownOffset);
-		TArray<AActor*> ActorsToIgnore;
-		ActorsToIgnore.Add(this);
-
-		// 디버그 옵션을 설정합니다.
-		EDrawDebugTrace::Type DebugType = EDrawDebugTrace::None;
-		if(bVaultDebug)
-		{
-			DebugType = EDrawDebugTrace::ForDuration;
-		}
 
 		// 뛰어넘을 장애물과 캐릭터 사이의 거리를 측정합니다.
-		bool bIsHit = UKismetSystemLibrary::SphereTraceSingle(GetWorld(), TraceStart, TraceEnd, VaultableObjectTraceRadius, UEngineTypes::ConvertToTraceType(ECC_Visibility),
-																false, ActorsToIgnore, DebugType, HitResult, true);
-		if(bIsHit)
+		Requests.Emplace(TraceStart, TraceEnd, VaultableObjectTraceRadius, this, false, false, bVaultDebug);
+	}
+
+	bVaultTracePending = AsyncTrace->RequestTraceBatch(EPRAsyncTraceFeature::AsyncTraceFeature_Vault, MoveTemp(Requests),
+														FPRAsyncTraceBatchDelegate::CreateUObject(this, &APRPlayerCharacter::OnVaultableObjectDepthTraceCompleted)) != INDEX_NONE;
+}
+
+void APRPlayerCharacter::OnVaultableObjectDepthTraceCompleted(TConstArrayView<FHitResult> HitResults)
+{
+	bVaultTracePending = false;
+
+	// 뛰어넘을 오브젝트의 치수를 계산합니다.
+	for(int Index = 0; Index < HitResults.Num(); Index++)
+	{
+		const FHitResult& HitResult = HitResults[Index];
+		if(HitResult.bBlockingHit)
 		{
 			// HitResult.bStartPenetrating: Break Hit Result 블루프린트 노드에서 Initial Overlap 변수로 나타냅니다.
 			// Trace 시작 시 충돌이 발생했는지 여부를 나타내는 변수입니다.
@@ -649,9 +673,15 @@ void APRPlayerCharacter::CalculateVaultableObjectDepth(FVector TraceImpactPoint)
 		}
 		else
 		{
-			// 탐색을 마칠 경우 장애물을 넘어서 탐색한 것이므로 착지할 위치를 계산합니다.
-			CalculateVaultLandLocation(HitResult.TraceStart);
-			break;
+			// 탐색을 마칠 경우 장애물을 넘어서 탐색한 것이므로 이 위치에서 착지할 위치를 계산합니다.
+			// MotionWarp는 착지 Trace의 결과를 받은 후 실행합니다.
+			if(bVaultDebug && VaultingLocation != FVector::ZeroVector)
+			{
+				DrawDebugSphere(GetWorld(), VaultingLocation, 15.0f, 12, FColor::Purple, false, 5.0f);
+			}
+
+			RequestVaultLandTrace(HitResult.TraceStart);
+			return;
 		}
 	}
 
@@ -663,26 +693,38 @@ void APRPlayerCharacter::CalculateVaultableObjectDepth(FVector TraceImpactPoint)
 	ExecuteVaultMotionWarp();
 }
 
-void APRPlayerCharacter::CalculateVaultLandLocation(FVector TraceEndLocation)
+void APRPlayerCharacter::RequestVaultLandTrace(const FVector& DepthTraceStart)
 {
-	FHitResult HitResult;
-	const FVector TraceStart = TraceEndLocation + (GetActorForwardVector() * VaultLandDistance);
-	const FVector TraceEnd = TraceStart - FVector(0.0f, 0.0f, VaultLandDownOffset);
-	TArray<AActor*> ActorsToIgnore;
-	ActorsToIgnore.Add(this);
+	UPRAsyncTraceSubsystem* AsyncTrace = GetWorld()->GetSubsystem<UPRAsyncTraceSubsystem>();
+	if(!AsyncTrace)
+	{
+		ExecuteVaultMotionWarp();
+		return;
+	}
 
-	// 디버그 옵션을 설정합니다.
-	EDrawDebugTrace::Type DebugType = EDrawDebugTrace::None;
-	if(bVaultDebug)
+	const FVector LandTraceStart = DepthTraceStart + (GetActorForwardVector() * VaultLandDistance);
+	const FVector LandTraceEnd = LandTraceStart - FVector(0.0f, 0.0f, VaultLandDownOffset);
+	bVaultTracePending = AsyncTrace->RequestTrace(EPRAsyncTraceFeature::AsyncTraceFeature_Vault, FPRAsyncTraceRequest(LandTraceStart, LandTraceEnd, 0.0f, this, true, false, bVaultDebug),
+													FPRAsyncTraceBatchDelegate::CreateUObject(this, &APRPlayerCharacter::OnVaultLandTraceCompleted)) != INDEX_NONE;
+}
+
+void APRPlayerCharacter::OnVaultLandTraceCompleted(TConstArrayView<FHitResult> HitResults)
+{
+	bVaultTracePending = false;
+
+	if(HitResults.Num() > 0)
 	{
-		DebugType = EDrawDebugTrace::ForDuration;
+		CalculateVaultLandLocation(HitResults[0]);
 	}
-	
-	bool bIsLandHit = UKismetSystemLibrary::LineTraceSingle(GetWorld(), TraceStart, TraceEnd, UEngineTypes::ConvertToTraceType(ECC_Visibility),
-																	true, ActorsToIgnore, DebugType, HitResult, true);
-	if(bIsLandHit)
+
+	ExecuteVaultMotionWarp();
+}
+
+void APRPlayerCharacter::CalculateVaultLandLocation(const FHitResult& LandHitResult)
+{
+	if(LandHitResult.bBlockingHit)
 	{
-		VaultLandLocation = HitResult.ImpactPoint;
+		VaultLandLocation = LandHitResult.ImpactPoint;
 		if(bVaultDebug)
 		{
 			DrawDebugSphere(GetWorld(), VaultLandLocation, 10.0f, 12, FColor::Cyan, false, 5.0f);
@@ -745,6 +787,10 @@ void APRPlayerCharacter::Attack_Implementation()
 {
 	Super::Attack_Implementation();
 
-	DoDamage();
+	// 히트 윈도우를 사용할 경우 대미지는 공격 몽타주의 ANS_PRMeleeHitWindow에서 줍니다.
+	if(!IsUsingMeleeHitWindow())
+	{
+		DoDamage();
+	}
 }
 #pragma endregion 
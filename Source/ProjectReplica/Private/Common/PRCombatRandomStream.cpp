@@ -0,0 +1,53 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Common/PRCombatRandomStream.h"
+
+void FPRCombatRandomStream::Initialize(uint32 NewSeed)
+{
+	Seed = NewSeed;
+	Counter = 0;
+}
+
+float FPRCombatRandomStream::FRand()
+{
+	return Hash(Seed, Counter++);
+}
+
+bool FPRCombatRandomStream::RollCritical(float CriticalRate)
+{
+	// 0.0f에서 100.0f 사이의 난수와 치명타 확률(%)을 비교합니다.
+	return FRand() * 100.0f < CriticalRate;
+}
+
+void FPRCombatRandomStream::RollCriticals(float CriticalRate, TArrayView<uint8> OutCriticals)
+{
+	const int32 Count = OutCriticals.Num();
+	const uint32 StartCounter = Counter;
+	uint8* Criticals = OutCriticals.GetData();
+
+	// 반복문 사이에 의존성이 없고 분기가 없으므로 컴파일러가 벡터화할 수 있습니다.
+	for(int32 Index = 0; Index < Count; Index++)
+	{
+		Criticals[Index] = static_cast<uint8>(Hash(Seed, StartCounter + static_cast<uint32>(Index)) * 100.0f < CriticalRate);
+	}
+
+	Counter = StartCounter + static_cast<uint32>(Count);
+}
+
+void FPRCombatRandomStream::RollCriticals(TConstArrayView<float> CriticalRates, TArrayView<uint8> OutCriticals)
+{
+	check(CriticalRates.Num() == OutCriticals.Num());
+
+	const int32 Count = OutCriticals.Num();
+	const uint32 StartCounter = Counter;
+	const float* Rates = CriticalRates.GetData();
+	uint8* Criticals = OutCriticals.GetData();
+
+	for(int32 Index = 0; Index < Count; Index++)
+	{
+		Criticals[Index] = static_cast<uint8>(Hash(Seed, StartCounter + static_cast<uint32>(Index)) * 100.0f < Rates[Index]);
+	}
+
+	Counter = StartCounter + static_cast<uint32>(Count);
+}
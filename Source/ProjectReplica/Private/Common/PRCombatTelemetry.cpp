@@ -0,0 +1,291 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Common/PRCombatTelemetry.h"
+#include "HAL/Event.h"
+#include "HAL/FileManager.h"
+#include "HAL/RunnableThread.h"
+
+#pragma region RingBuffer
+FPRCombatTelemetryRingBuffer::FPRCombatTelemetryRingBuffer(uint32 NewCapacity)
+	: IndexMask(0)
+	, Head(0)
+	, Tail(0)
+	, DroppedCount(0)
+{
+	const uint32 Capacity = FMath::RoundUpToPowerOfTwo(FMath::Max(NewCapacity, 2u));
+	Records.SetNum(Capacity);
+	IndexMask = Capacity - 1;
+}
+
+bool FPRCombatTelemetryRingBuffer::Push(const FPRCombatTelemetryRecord& Record)
+{
+	const uint64 CurrentHead = Head.load(std::memory_order_relaxed);
+	const uint64 CurrentTail = Tail.load(std::memory_order_acquire);
+	if(CurrentHead - CurrentTail >= static_cast<uint64>(Records.Num()))
+	{
+		// 게임 스레드가 Writer 스레드를 기다리지 않도록 가득 찬 경우 기록을 버립니다.
+		DroppedCount.fetch_add(1, std::memory_order_relaxed);
+		return false;
+	}
+
+	Records[static_cast<int32>(CurrentHead & IndexMask)] = Record;
+
+	// 기록을 복사한 후 Head를 갱신하여 소비자가 완성된 기록만 읽도록 합니다.
+	Head.store(CurrentHead + 1, std::memory_order_release);
+	return true;
+}
+
+int32 FPRCombatTelemetryRingBuffer::Pop(TArrayView<FPRCombatTelemetryRecord> OutRecords)
+{
+	const uint64 CurrentTail = Tail.load(std::memory_order_relaxed);
+	const uint64 CurrentHead = Head.load(std::memory_order_acquire);
+	const int32 Count = static_cast<int32>(FMath::Min<uint64>(CurrentHead - CurrentTail, static_cast<uint64>(OutRecords.Num())));
+	for(int32 Index = 0; Index < Count; Index++)
+	{
+		OutRecords[Index] = Records[static_cast<int32>((CurrentTail + Index) & IndexMask)];
+	}
+
+	// 기록을 복사한 후 Tail을 갱신하여 생산자가 복사 중인 위치를 덮어쓰지 않도록 합니다.
+	Tail.store(CurrentTail + Count, std::memory_order_release);
+	return Count;
+}
+#pragma endregion
+
+#pragma region TelemetryFile
+bool FPRCombatTelemetryFile::ConvertToCSV(const FString& TelemetryFilePath, const FString& CSVFilePath)
+{
+	TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*TelemetryFilePath));
+	if(!Reader)
+	{
+		PR_LOG_ERROR("Failed to open combat telemetry file %s", *TelemetryFilePath);
+		return false;
+	}
+
+	uint32 FileMagic = 0;
+	uint32 FileVersion = 0;
+	*Reader << FileMagic;
+	*Reader << FileVersion;
+	if(FileMagic != Magic || FileVersion != Version)
+	{
+		PR_LOG_ERROR("%s is not a combat telemetry file (version %u)", *TelemetryFilePath, FileVersion);
+		return false;
+	}
+
+	TUniquePtr<FArchive> Writer(IFileManager::Get().CreateFileWriter(*CSVFilePath));
+	if(!Writer)
+	{
+		PR_LOG_ERROR("Failed to create CSV file %s", *CSVFilePath);
+		return false;
+	}
+
+	const UEnum* ElementTypeEnum = StaticEnum<EPRElementType>();
+	const UEnum* DamageResponseEnum = StaticEnum<EPRDamageResponse>();
+
+	// CSV는 일정한 크기마다 UTF-8로 변환하여 파일에 기록합니다.
+	FString Buffer = TEXT("Timestamp,Attacker,Target,Amount,Critical,Applied,ElementType,DamageResponse\n");
+	auto FlushBuffer = [&Writer, &Buffer]()
+	{
+		const FTCHARToUTF8 UTF8Buffer(*Buffer);
+		Writer->Serialize(const_cast<ANSICHAR*>(UTF8Buffer.Get()), UTF8Buffer.Length());
+		Buffer.Reset();
+	};
+
+	TArray<FString> Names;
+	while(!Reader->AtEnd() && !Reader->IsError())
+	{
+		uint8 ChunkType = 0;
+		*Reader << ChunkType;
+		if(ChunkType == static_cast<uint8>(EChunkType::Name))
+		{
+			uint32 NameID = 0;
+			FString Name;
+			*Reader << NameID;
+			*Reader << Name;
+			if(Names.Num() <= static_cast<int32>(NameID))
+			{
+				Names.SetNum(NameID + 1);
+			}
+
+			Names[NameID] = MoveTemp(Name);
+		}
+		else if(ChunkType == static_cast<uint8>(EChunkType::Records))
+		{
+			int32 Count = 0;
+			*Reader << Count;
+			for(int32 Index = 0; Index < Count && !Reader->IsError(); Index++)
+			{
+				double Timestamp = 0.0;
+				uint32 AttackerID = 0;
+				uint32 TargetID = 0;
+				float Amount = 0.0f;
+				uint8 ElementType = 0;
+				uint8 DamageResponse = 0;
+				uint8 Flags = 0;
+				*Reader << Timestamp << AttackerID << TargetID << Amount << ElementType << DamageResponse << Flags;
+
+				const EPRCombatTelemetryFlags RecordFlags = static_cast<EPRCombatTelemetryFlags>(Flags);
+				Buffer.Appendf(TEXT("%.6f,%s,%s,%.3f,%d,%d,%s,%s\n"),
+								Timestamp,
+								Names.IsValidIndex(AttackerID) ? *Names[AttackerID] : TEXT(""),
+								Names.IsValidIndex(TargetID) ? *Names[TargetID] : TEXT(""),
+								Amount,
+								EnumHasAnyFlags(RecordFlags, EPRCombatTelemetryFlags::Critical) ? 1 : 0,
+								EnumHasAnyFlags(RecordFlags, EPRCombatTelemetryFlags::Applied) ? 1 : 0,
+								*ElementTypeEnum->GetNameStringByValue(ElementType),
+								*DamageResponseEnum->GetNameStringByValue(DamageResponse));
+
+				if(Buffer.Len() >= 64 * 1024)
+				{
+					FlushBuffer();
+				}
+			}
+		}
+		else
+		{
+			PR_LOG_ERROR("%s has an unknown chunk type %d", *TelemetryFilePath, ChunkType);
+			break;
+		}
+	}
+
+	FlushBuffer();
+	return Writer->Close() && !Reader->IsError();
+}
+#pragma endregion
+
+#pragma region Writer
+FPRCombatTelemetryWriter::FPRCombatTelemetryWriter(FPRCombatTelemetryRingBuffer& NewRingBuffer, const FString& NewFilePath, float NewFlushInterval)
+	: RingBuffer(NewRingBuffer)
+	, FilePath(NewFilePath)
+	, FlushInterval(NewFlushInterval)
+	, Thread(nullptr)
+	, WakeEvent(nullptr)
+	, bStopRequested(false)
+	, WrittenCount(0)
+{
+}
+
+FPRCombatTelemetryWriter::~FPRCombatTelemetryWriter()
+{
+	Shutdown();
+}
+
+bool FPRCombatTelemetryWriter::Start()
+{
+	FileWriter.Reset(IFileManager::Get().CreateFileWriter(*FilePath));
+	if(!FileWriter)
+	{
+		PR_LOG_ERROR("Failed to create combat telemetry file %s", *FilePath);
+		return false;
+	}
+
+	uint32 Magic = FPRCombatTelemetryFile::Magic;
+	uint32 Version = FPRCombatTelemetryFile::Version;
+	*FileWriter << Magic;
+	*FileWriter << Version;
+
+	// 꺼낸 기록을 담는 배열은 시작할 때 한 번만 할당합니다.
+	DrainedRecords.SetNum(FMath::Min<uint32>(RingBuffer.GetCapacity(), 4096));
+
+	WakeEvent = FPlatformProcess::GetSynchEventFromPool(false);
+	Thread = FRunnableThread::Create(this, TEXT("PRCombatTelemetryWriter"), 0, TPri_BelowNormal);
+	return Thread != nullptr;
+}
+
+void FPRCombatTelemetryWriter::Shutdown()
+{
+	if(Thread)
+	{
+		Thread->Kill(true);
+		delete Thread;
+		Thread = nullptr;
+	}
+
+	if(WakeEvent)
+	{
+		FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+		WakeEvent = nullptr;
+	}
+
+	if(FileWriter)
+	{
+		FileWriter->Close();
+		FileWriter.Reset();
+	}
+}
+
+uint32 FPRCombatTelemetryWriter::Run()
+{
+	const uint32 FlushIntervalMilliseconds = static_cast<uint32>(FMath::Max(FlushInterval, 0.01f) * 1000.0f);
+	while(!bStopRequested.load(std::memory_order_relaxed))
+	{
+		WakeEvent->Wait(FlushIntervalMilliseconds);
+		Drain();
+	}
+
+	// 종료하기 전에 남은 기록을 모두 기록합니다.
+	Drain();
+	FileWriter->Flush();
+	return 0;
+}
+
+void FPRCombatTelemetryWriter::Stop()
+{
+	bStopRequested.store(true, std::memory_order_relaxed);
+	if(WakeEvent)
+	{
+		WakeEvent->Trigger();
+	}
+}
+
+void FPRCombatTelemetryWriter::Drain()
+{
+	int32 Count = RingBuffer.Pop(DrainedRecords);
+	while(Count > 0)
+	{
+		// 새로운 이름은 Record Chunk보다 먼저 기록해야 하므로 ID를 먼저 구합니다.
+		for(int32 Index = 0; Index < Count; Index++)
+		{
+			GetOrWriteNameID(DrainedRecords[Index].Attacker);
+			GetOrWriteNameID(DrainedRecords[Index].Target);
+		}
+
+		uint8 ChunkType = static_cast<uint8>(FPRCombatTelemetryFile::EChunkType::Records);
+		*FileWriter << ChunkType;
+		*FileWriter << Count;
+		for(int32 Index = 0; Index < Count; Index++)
+		{
+			FPRCombatTelemetryRecord& Record = DrainedRecords[Index];
+			uint32 AttackerID = NameIDs.FindChecked(Record.Attacker);
+			uint32 TargetID = NameIDs.FindChecked(Record.Target);
+			uint8 ElementType = static_cast<uint8>(Record.ElementType);
+			uint8 DamageResponse = static_cast<uint8>(Record.DamageResponse);
+			uint8 Flags = static_cast<uint8>(Record.Flags);
+			*FileWriter << Record.Timestamp << AttackerID << TargetID << Record.Amount << ElementType << DamageResponse << Flags;
+		}
+
+		WrittenCount.fetch_add(Count, std::memory_order_relaxed);
+		Count = RingBuffer.Pop(DrainedRecords);
+	}
+}
+
+uint32 FPRCombatTelemetryWriter::GetOrWriteNameID(FName Name)
+{
+	const uint32* NameID = NameIDs.Find(Name);
+	if(NameID)
+	{
+		return *NameID;
+	}
+
+	uint32 NewNameID = static_cast<uint32>(NameIDs.Num());
+	NameIDs.Add(Name, NewNameID);
+
+	uint8 ChunkType = static_cast<uint8>(FPRCombatTelemetryFile::EChunkType::Name);
+	FString NameString = Name.ToString();
+	*FileWriter << ChunkType;
+	*FileWriter << NewNameID;
+	*FileWriter << NameString;
+
+	return NewNameID;
+}
+#pragma endregion
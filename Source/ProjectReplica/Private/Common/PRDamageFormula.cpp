@@ -0,0 +1,670 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Common/PRDamageFormula.h"
+#include "Misc/MemStack.h"
+
+namespace PRDamageFormula
+{
+	/** 속성에 해당하는 속성 피해 보너스 능력치를 반환하는 함수입니다. */
+	EPRStatType GetElementDamageBonusStatType(EPRElementType ElementType)
+	{
+		switch(ElementType)
+		{
+		case EPRElementType::ElementType_Physio:
+			return EPRStatType::StatType_PhysioDamageBonus;
+		case EPRElementType::ElementType_Pyro:
+			return EPRStatType::StatType_PyroDamageBonus;
+		case EPRElementType::ElementType_Hydro:
+			return EPRStatType::StatType_HydroDamageBonus;
+		case EPRElementType::ElementType_Cryo:
+			return EPRStatType::StatType_CryoDamageBonus;
+		case EPRElementType::ElementType_Anemo:
+			return EPRStatType::StatType_AnemoDamageBonus;
+		case EPRElementType::ElementType_Electro:
+			return EPRStatType::StatType_ElectroDamageBonus;
+		case EPRElementType::ElementType_Geo:
+			return EPRStatType::StatType_GeoDamageBonus;
+		case EPRElementType::ElementType_Photo:
+			return EPRStatType::StatType_PhotoDamageBonus;
+		case EPRElementType::ElementType_Erebo:
+			return EPRStatType::StatType_EreboDamageBonus;
+		default:
+			return EPRStatType::StatType_None;
+		}
+	}
+
+	/** 0으로 나눌 경우 0을 반환하는 나눗셈 함수입니다. */
+	FORCEINLINE float SafeDivide(float A, float B)
+	{
+		return B != 0.0f ? A / B : 0.0f;
+	}
+
+	/**
+	 * 대미지 공식의 문자열을 명령어 배열로 변환하는 재귀 하향 파서입니다.
+	 * Expression	:= Term (('+' | '-') Term)*
+	 * Term			:= Unary (('*' | '/') Unary)*
+	 * Unary		:= '-' Unary | Primary
+	 * Primary		:= Number | Variable | Function '(' Expression ',' Expression ')' | '(' Expression ')'
+	 */
+	class FParser
+	{
+	public:
+		FParser(const FString& NewSource, TArray<FPRDamageFormula::FInstruction>& NewInstructions)
+			: Source(NewSource)
+			, Position(0)
+			, Instructions(NewInstructions)
+			, Error()
+		{}
+
+		/** 문자열 전체를 변환하는 함수입니다. */
+		bool Parse()
+		{
+			if(!ParseExpression())
+			{
+				return false;
+			}
+
+			SkipWhitespace();
+			if(Position < Source.Len())
+			{
+				return SetError(FString::Printf(TEXT("Unexpected '%c'"), Source[Position]));
+			}
+
+			return true;
+		}
+
+		/** 변환에 실패한 이유를 반환하는 함수입니다. */
+		const FString& GetError() const { return Error; }
+
+	private:
+		bool ParseExpression()
+		{
+			if(!ParseTerm())
+			{
+				return false;
+			}
+
+			while(true)
+			{
+				if(Consume(TEXT('+')))
+				{
+					if(!ParseTerm())
+					{
+						return false;
+					}
+
+					EmitBinary(FPRDamageFormula::EOpCode::Add);
+				}
+				else if(Consume(TEXT('-')))
+				{
+					if(!ParseTerm())
+					{
+						return false;
+					}
+
+					EmitBinary(FPRDamageFormula::EOpCode::Subtract);
+				}
+				else
+				{
+					return true;
+				}
+			}
+		}
+
+		bool ParseTerm()
+		{
+			if(!ParseUnary())
+			{
+				return false;
+			}
+
+			while(true)
+			{
+				if(Consume(TEXT('*')))
+				{
+					if(!ParseUnary())
+					{
+						return false;
+					}
+
+					EmitBinary(FPRDamageFormula::EOpCode::Multiply);
+				}
+				else if(Consume(TEXT('/')))
+				{
+					if(!ParseUnary())
+					{
+						return false;
+					}
+
+					EmitBinary(FPRDamageFormula::EOpCode::Divide);
+				}
+				else
+				{
+					return true;
+				}
+			}
+		}
+
+		bool ParseUnary()
+		{
+			if(Consume(TEXT('-')))
+			{
+				if(!ParseUnary())
+				{
+					return false;
+				}
+
+				// 상수의 부호는 명령어를 추가하지 않고 바로 바꿉니다.
+				if(Instructions.Last().OpCode == FPRDamageFormula::EOpCode::PushConstant)
+				{
+					Instructions.Last().Constant = -Instructions.Last().Constant;
+				}
+				else
+				{
+					Instructions.Emplace(FPRDamageFormula::EOpCode::Negate);
+				}
+
+				return true;
+			}
+
+			return ParsePrimary();
+		}
+
+		bool ParsePrimary()
+		{
+			SkipWhitespace();
+			if(Position >= Source.Len())
+			{
+				return SetError(TEXT("Unexpected end of expression"));
+			}
+
+			if(Consume(TEXT('(')))
+			{
+				if(!ParseExpression())
+				{
+					return false;
+				}
+
+				return Consume(TEXT(')')) ? true : SetError(TEXT("Missing ')'"));
+			}
+
+			const TCHAR Character = Source[Position];
+			if(FChar::IsDigit(Character) || Character == TEXT('.'))
+			{
+				return ParseNumber();
+			}
+
+			if(FChar::IsAlpha(Character) || Character == TEXT('_'))
+			{
+				return ParseIdentifier();
+			}
+
+			return SetError(FString::Printf(TEXT("Unexpected '%c'"), Character));
+		}
+
+		bool ParseNumber()
+		{
+			const int32 Start = Position;
+			while(Position < Source.Len() && (FChar::IsDigit(Source[Position]) || Source[Position] == TEXT('.')))
+			{
+				Position++;
+			}
+
+			const FString Number = Source.Mid(Start, Position - Start);
+			if(!Number.IsNumeric())
+			{
+				return SetError(FString::Printf(TEXT("Invalid number '%s'"), *Number));
+			}
+
+			Instructions.Emplace(FPRDamageFormula::EOpCode::PushConstant, 0, FCString::Atof(*Number));
+
+			return true;
+		}
+
+		bool ParseIdentifier()
+		{
+			const int32 Start = Position;
+			while(Position < Source.Len() && (FChar::IsAlnum(Source[Position]) || Source[Position] == TEXT('_')))
+			{
+				Position++;
+			}
+
+			const FString Identifier = Source.Mid(Start, Position - Start);
+
+			// 함수
+			const bool bIsMin = Identifier.Equals(TEXT("min"), ESearchCase::IgnoreCase);
+			const bool bIsMax = Identifier.Equals(TEXT("max"), ESearchCase::IgnoreCase);
+			if(bIsMin || bIsMax)
+			{
+				if(!Consume(TEXT('(')) || !ParseExpression() || !Consume(TEXT(',')) || !ParseExpression() || !Consume(TEXT(')')))
+				{
+					return Error.IsEmpty() ? SetError(FString::Printf(TEXT("'%s' requires two arguments"), *Identifier)) : false;
+				}
+
+				EmitBinary(bIsMin ? FPRDamageFormula::EOpCode::Min : FPRDamageFormula::EOpCode::Max);
+
+				return true;
+			}
+
+			// 변수는 이름을 Index로 변환합니다.
+			for(uint8 Variable = 0; Variable < static_cast<uint8>(EPRDamageFormulaVariable::Count); Variable++)
+			{
+				if(Identifier.Equals(FPRDamageFormula::GetVariableName(static_cast<EPRDamageFormulaVariable>(Variable)), ESearchCase::IgnoreCase))
+				{
+					Instructions.Emplace(FPRDamageFormula::EOpCode::PushVariable, Variable);
+
+					return true;
+				}
+			}
+
+			return SetError(FString::Printf(TEXT("Unknown variable '%s'"), *Identifier));
+		}
+
+		/** 이항 연산 명령어를 추가하는 함수입니다. 두 피연산자가 모두 상수일 경우 미리 계산합니다. */
+		void EmitBinary(FPRDamageFormula::EOpCode OpCode)
+		{
+			const int32 Num = Instructions.Num();
+			if(Num >= 2
+				&& Instructions[Num - 2].OpCode == FPRDamageFormula::EOpCode::PushConstant
+				&& Instructions[Num - 1].OpCode == FPRDamageFormula::EOpCode::PushConstant)
+			{
+				const float A = Instructions[Num - 2].Constant;
+				const float B = Instructions[Num - 1].Constant;
+				float Result = 0.0f;
+				switch(OpCode)
+				{
+				case FPRDamageFormula::EOpCode::Add:
+					Result = A + B;
+					break;
+				case FPRDamageFormula::EOpCode::Subtract:
+					Result = A - B;
+					break;
+				case FPRDamageFormula::EOpCode::Multiply:
+					Result = A * B;
+					break;
+				case FPRDamageFormula::EOpCode::Divide:
+					Result = SafeDivide(A, B);
+					break;
+				case FPRDamageFormula::EOpCode::Min:
+					Result = FMath::Min(A, B);
+					break;
+				case FPRDamageFormula::EOpCode::Max:
+					Result = FMath::Max(A, B);
+					break;
+				default:
+					break;
+				}
+
+				Instructions.Pop();
+				Instructions.Last().Constant = Result;
+
+				return;
+			}
+
+			Instructions.Emplace(OpCode);
+		}
+
+		/** 공백을 건너뛰고 다음 문자가 주어진 문자일 경우 건너뛰는 함수입니다. */
+		bool Consume(TCHAR Character)
+		{
+			SkipWhitespace();
+			if(Position < Source.Len() && Source[Position] == Character)
+			{
+				Position++;
+				return true;
+			}
+
+			return false;
+		}
+
+		void SkipWhitespace()
+		{
+			while(Position < Source.Len() && FChar::IsWhitespace(Source[Position]))
+			{
+				Position++;
+			}
+		}
+
+		/** 실패한 이유를 설정하고 false를 반환하는 함수입니다. */
+		bool SetError(const FString& NewError)
+		{
+			if(Error.IsEmpty())
+			{
+				Error = FString::Printf(TEXT("%s at %d"), *NewError, Position);
+			}
+
+			return false;
+		}
+
+	private:
+		/** 변환할 문자열입니다. */
+		const FString& Source;
+
+		/** 현재 읽고 있는 위치입니다. */
+		int32 Position;
+
+		/** 변환한 명령어 배열입니다. */
+		TArray<FPRDamageFormula::FInstruction>& Instructions;
+
+		/** 변환에 실패한 이유입니다. */
+		FString Error;
+	};
+}
+
+#pragma region DamageFormulaInputs
+FPRDamageFormulaInputs FPRDamageFormulaInputs::Make(const FPRCharacterStat& AttackerStat, const FPRWeaponStat& WeaponStat, const FPRCharacterStat& TargetStat,
+													EPRElementType ElementType, bool bIsCritical, float BaseDamage)
+{
+	FPRDamageFormulaInputs Inputs;
+	Inputs.Set(EPRDamageFormulaVariable::AttackPoint, AttackerStat.AttackPoint);
+	Inputs.Set(EPRDamageFormulaVariable::DefencePoint, AttackerStat.DefencePoint);
+	Inputs.Set(EPRDamageFormulaVariable::MaxHealth, AttackerStat.MaxHealth);
+	Inputs.Set(EPRDamageFormulaVariable::CriticalDamage, AttackerStat.CriticalDamage);
+	Inputs.Set(EPRDamageFormulaVariable::WeaponAttack, WeaponStat.DefaultAttack);
+	Inputs.Set(EPRDamageFormulaVariable::TargetDefencePoint, TargetStat.DefencePoint);
+	Inputs.Set(EPRDamageFormulaVariable::TargetMaxHealth, TargetStat.MaxHealth);
+	Inputs.Set(EPRDamageFormulaVariable::TargetHealth, TargetStat.Health);
+	Inputs.Set(EPRDamageFormulaVariable::Critical, bIsCritical ? 1.0f : 0.0f);
+	Inputs.Set(EPRDamageFormulaVariable::BaseDamage, BaseDamage);
+
+	// 무기의 부 옵션을 해당하는 변수에 더합니다.
+	switch(WeaponStat.SubStatType)
+	{
+	case EPRStatType::StatType_Attack:
+		Inputs.Set(EPRDamageFormulaVariable::WeaponAttack, WeaponStat.DefaultAttack + WeaponStat.SubStatAmount);
+		break;
+	case EPRStatType::StatType_AttackPercent:
+		Inputs.Set(EPRDamageFormulaVariable::WeaponAttackPercent, WeaponStat.SubStatAmount);
+		break;
+	case EPRStatType::StatType_Defence:
+		Inputs.Set(EPRDamageFormulaVariable::DefencePoint, AttackerStat.DefencePoint + WeaponStat.SubStatAmount);
+		break;
+	case EPRStatType::StatType_DefencePercent:
+		Inputs.Set(EPRDamageFormulaVariable::DefencePoint, AttackerStat.DefencePoint * (1.0f + WeaponStat.SubStatAmount * 0.01f));
+		break;
+	case EPRStatType::StatType_Health:
+		Inputs.Set(EPRDamageFormulaVariable::MaxHealth, AttackerStat.MaxHealth + WeaponStat.SubStatAmount);
+		break;
+	case EPRStatType::StatType_HealthPercent:
+		Inputs.Set(EPRDamageFormulaVariable::MaxHealth, AttackerStat.MaxHealth * (1.0f + WeaponStat.SubStatAmount * 0.01f));
+		break;
+	case EPRStatType::StatType_CriticalDamage:
+		Inputs.Set(EPRDamageFormulaVariable::WeaponCriticalDamage, WeaponStat.SubStatAmount);
+		break;
+	default:
+		// 대미지의 속성과 같은 속성의 피해 보너스일 경우에만 적용합니다.
+		if(WeaponStat.SubStatType != EPRStatType::StatType_None
+			&& WeaponStat.SubStatType == PRDamageFormula::GetElementDamageBonusStatType(ElementType))
+		{
+			Inputs.Set(EPRDamageFormulaVariable::ElementBonus, WeaponStat.SubStatAmount);
+		}
+		break;
+	}
+
+	const float CriticalMultiplier = bIsCritical
+										? (Inputs.Get(EPRDamageFormulaVariable::CriticalDamage) + Inputs.Get(EPRDamageFormulaVariable::WeaponCriticalDamage)) * 0.01f
+										: 1.0f;
+	Inputs.Set(EPRDamageFormulaVariable::CriticalMultiplier, CriticalMultiplier);
+
+	return Inputs;
+}
+#pragma endregion
+
+#pragma region DamageFormula
+FPRDamageFormula::FPRDamageFormula()
+	: Instructions()
+	, StackDepth(0)
+	, Expression()
+{
+}
+
+bool FPRDamageFormula::Compile(const FString& NewExpression, FString& OutError)
+{
+	TArray<FInstruction> NewInstructions;
+	PRDamageFormula::FParser Parser(NewExpression, NewInstructions);
+	if(!Parser.Parse())
+	{
+		OutError = Parser.GetError();
+		return false;
+	}
+
+	// 명령어 배열을 실행할 때 필요한 스택의 깊이를 구합니다.
+	int32 Depth = 0;
+	int32 NewStackDepth = 0;
+	for(const FInstruction& Instruction : NewInstructions)
+	{
+		switch(Instruction.OpCode)
+		{
+		case EOpCode::PushConstant:
+		case EOpCode::PushVariable:
+			Depth++;
+			break;
+		case EOpCode::Negate:
+			break;
+		default:
+			Depth--;
+			break;
+		}
+
+		NewStackDepth = FMath::Max(NewStackDepth, Depth);
+	}
+
+	if(NewStackDepth > MaxStackDepth)
+	{
+		OutError = FString::Printf(TEXT("Expression is nested too deeply (%d > %d)"), NewStackDepth, MaxStackDepth);
+		return false;
+	}
+
+	Instructions = MoveTemp(NewInstructions);
+	StackDepth = NewStackDepth;
+	Expression = NewExpression;
+
+	return true;
+}
+
+float FPRDamageFormula::Evaluate(const FPRDamageFormulaInputs& Inputs) const
+{
+	float Stack[MaxStackDepth];
+	int32 Top = 0;
+	for(const FInstruction& Instruction : Instructions)
+	{
+		switch(Instruction.OpCode)
+		{
+		case EOpCode::PushConstant:
+			Stack[Top++] = Instruction.Constant;
+			break;
+		case EOpCode::PushVariable:
+			Stack[Top++] = Inputs.Values[Instruction.Variable];
+			break;
+		case EOpCode::Negate:
+			Stack[Top - 1] = -Stack[Top - 1];
+			break;
+		case EOpCode::Add:
+			Top--;
+			Stack[Top - 1] += Stack[Top];
+			break;
+		case EOpCode::Subtract:
+			Top--;
+			Stack[Top - 1] -= Stack[Top];
+			break;
+		case EOpCode::Multiply:
+			Top--;
+			Stack[Top - 1] *= Stack[Top];
+			break;
+		case EOpCode::Divide:
+			Top--;
+			Stack[Top - 1] = PRDamageFormula::SafeDivide(Stack[Top - 1], Stack[Top]);
+			break;
+		case EOpCode::Min:
+			Top--;
+			Stack[Top - 1] = FMath::Min(Stack[Top - 1], Stack[Top]);
+			break;
+		case EOpCode::Max:
+			Top--;
+			Stack[Top - 1] = FMath::Max(Stack[Top - 1], Stack[Top]);
+			break;
+		default:
+			break;
+		}
+	}
+
+	return Top > 0 ? FMath::Max(Stack[0], 0.0f) : 0.0f;
+}
+
+void FPRDamageFormula::EvaluateBatch(TConstArrayView<FPRDamageFormulaInputs> Inputs, TArrayView<float> OutDamages) const
+{
+	check(Inputs.Num() == OutDamages.Num());
+
+	const int32 Count = Inputs.Num();
+	if(Count == 0)
+	{
+		return;
+	}
+
+	if(!IsCompiled())
+	{
+		for(float& Damage : OutDamages)
+		{
+			Damage = 0.0f;
+		}
+
+		return;
+	}
+
+	// 스택의 각 칸을 입력의 수만큼의 배열로 사용하여 명령어마다 모든 입력을 계산합니다.
+	FMemMark MemMark(FMemStack::Get());
+	TArray<float, TMemStackAllocator<>> Stack;
+	Stack.SetNumUninitialized(StackDepth * Count);
+
+	int32 Top = 0;
+	for(const FInstruction& Instruction : Instructions)
+	{
+		switch(Instruction.OpCode)
+		{
+		case EOpCode::PushConstant:
+			{
+				float* Destination = Stack.GetData() + Top++ * Count;
+				for(int32 Index = 0; Index < Count; Index++)
+				{
+					Destination[Index] = Instruction.Constant;
+				}
+			}
+			break;
+		case EOpCode::PushVariable:
+			{
+				float* Destination = Stack.GetData() + Top++ * Count;
+				for(int32 Index = 0; Index < Count; Index++)
+				{
+					Destination[Index] = Inputs[Index].Values[Instruction.Variable];
+				}
+			}
+			break;
+		case EOpCode::Negate:
+			{
+				float* Destination = Stack.GetData() + (Top - 1) * Count;
+				for(int32 Index = 0; Index < Count; Index++)
+				{
+					Destination[Index] = -Destination[Index];
+				}
+			}
+			break;
+		default:
+			{
+				Top--;
+				float* A = Stack.GetData() + (Top - 1) * Count;
+				const float* B = Stack.GetData() + Top * Count;
+				switch(Instruction.OpCode)
+				{
+				case EOpCode::Add:
+					for(int32 Index = 0; Index < Count; Index++)
+					{
+						A[Index] += B[Index];
+					}
+					break;
+				case EOpCode::Subtract:
+					for(int32 Index = 0; Index < Count; Index++)
+					{
+						A[Index] -= B[Index];
+					}
+					break;
+				case EOpCode::Multiply:
+					for(int32 Index = 0; Index < Count; Index++)
+					{
+						A[Index] *= B[Index];
+					}
+					break;
+				case EOpCode::Divide:
+					for(int32 Index = 0; Index < Count; Index++)
+					{
+						A[Index] = PRDamageFormula::SafeDivide(A[Index], B[Index]);
+					}
+					break;
+				case EOpCode::Min:
+					for(int32 Index = 0; Index < Count; Index++)
+					{
+						A[Index] = FMath::Min(A[Index], B[Index]);
+					}
+					break;
+				case EOpCode::Max:
+					for(int32 Index = 0; Index < Count; Index++)
+					{
+						A[Index] = FMath::Max(A[Index], B[Index]);
+					}
+					break;
+				default:
+					break;
+				}
+			}
+			break;
+		}
+	}
+
+	for(int32 Index = 0; Index < Count; Index++)
+	{
+		OutDamages[Index] = FMath::Max(Stack[Index], 0.0f);
+	}
+}
+
+const TCHAR* FPRDamageFormula::GetDefaultExpression()
+{
+	return TEXT("(AttackPoint * (1 + WeaponAttackPercent * 0.01) + WeaponAttack) * BaseDamage * 0.01 * CriticalMultiplier * (1 + ElementBonus * 0.01) * 100 / (100 + TargetDefencePoint)");
+}
+
+const TCHAR* FPRDamageFormula::GetVariableName(EPRDamageFormulaVariable Variable)
+{
+	switch(Variable)
+	{
+	case EPRDamageFormulaVariable::AttackPoint:
+		return TEXT("AttackPoint");
+	case EPRDamageFormulaVariable::DefencePoint:
+		return TEXT("DefencePoint");
+	case EPRDamageFormulaVariable::MaxHealth:
+		return TEXT("MaxHealth");
+	case EPRDamageFormulaVariable::CriticalDamage:
+		return TEXT("CriticalDamage");
+	case EPRDamageFormulaVariable::WeaponAttack:
+		return TEXT("WeaponAttack");
+	case EPRDamageFormulaVariable::WeaponAttackPercent:
+		return TEXT("WeaponAttackPercent");
+	case EPRDamageFormulaVariable::WeaponCriticalDamage:
+		return TEXT("WeaponCriticalDamage");
+	case EPRDamageFormulaVariable::ElementBonus:
+		return TEXT("ElementBonus");
+	case EPRDamageFormulaVariable::TargetDefencePoint:
+		return TEXT("TargetDefencePoint");
+	case EPRDamageFormulaVariable::TargetMaxHealth:
+		return TEXT("TargetMaxHealth");
+	case EPRDamageFormulaVariable::TargetHealth:
+		return TEXT("TargetHealth");
+	case EPRDamageFormulaVariable::Critical:
+		return TEXT("Critical");
+	case EPRDamageFormulaVariable::CriticalMultiplier:
+		return TEXT("CriticalMultiplier");
+	case EPRDamageFormulaVariable::BaseDamage:
+		return TEXT("BaseDamage");
+	default:
+		return TEXT("");
+	}
+}
+#pragma endregion
@@ -0,0 +1,65 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Common/PRDelegateBenchmark.h"
+#include "HAL/IConsoleManager.h"
+#include "UObject/StrongObjectPtr.h"
+
+/** 델리게이트의 호출 비용을 측정하는 콘솔 명령어입니다. */
+static FAutoConsoleCommand DelegateBroadcastBenchmarkCommand(
+	TEXT("PR.Benchmark.DelegateBroadcast"),
+	TEXT("Measures native and dynamic delegate broadcast cost. Usage: PR.Benchmark.DelegateBroadcast [Broadcasts] [Listeners]"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		UPRDelegateBenchmark::RunBroadcastBenchmark(Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 100000,
+													Args.Num() > 1 ? FCString::Atoi(*Args[1]) : 1);
+	}));
+
+UPRDelegateBenchmark::UPRDelegateBenchmark()
+{
+	ReceivedCount = 0;
+}
+
+FPRDelegateBenchmarkResult UPRDelegateBenchmark::RunBroadcastBenchmark(int32 Broadcasts, int32 Listeners)
+{
+	FPRDelegateBenchmarkResult BenchmarkResult;
+	BenchmarkResult.Broadcasts = FMath::Max(Broadcasts, 1);
+	BenchmarkResult.Listeners = FMath::Max(Listeners, 1);
+
+	FOnBlockedNativeDelegate NativeDelegate;
+	FOnBlockedDelegate DynamicDelegate;
+	TArray<TStrongObjectPtr<UPRDelegateBenchmark>> ListenerObjects;
+	for(int32 Index = 0; Index < BenchmarkResult.Listeners; Index++)
+	{
+		UPRDelegateBenchmark* Listener = NewObject<UPRDelegateBenchmark>(GetTransientPackage());
+		ListenerObjects.Emplace(Listener);
+		NativeDelegate.AddUObject(Listener, &UPRDelegateBenchmark::OnBlocked);
+		DynamicDelegate.AddDynamic(Listener, &UPRDelegateBenchmark::OnBlocked);
+	}
+
+	double StartTime = FPlatformTime::Seconds();
+	for(int32 Index = 0; Index < BenchmarkResult.Broadcasts; Index++)
+	{
+		NativeDelegate.Broadcast((Index & 1) != 0);
+	}
+
+	BenchmarkResult.NativeTimePerBroadcast = (FPlatformTime::Seconds() - StartTime) * 1.0e9 / BenchmarkResult.Broadcasts;
+
+	StartTime = FPlatformTime::Seconds();
+	for(int32 Index = 0; Index < BenchmarkResult.Broadcasts; Index++)
+	{
+		DynamicDelegate.Broadcast((Index & 1) != 0);
+	}
+
+	BenchmarkResult.DynamicTimePerBroadcast = (FPlatformTime::Seconds() - StartTime) * 1.0e9 / BenchmarkResult.Broadcasts;
+
+	PR_LOG(Log, "Delegate broadcast benchmark: %d broadcasts, %d listeners, native %.1f ns, dynamic %.1f ns per broadcast",
+			BenchmarkResult.Broadcasts, BenchmarkResult.Listeners, BenchmarkResult.NativeTimePerBroadcast, BenchmarkResult.DynamicTimePerBroadcast);
+
+	return BenchmarkResult;
+}
+
+void UPRDelegateBenchmark::OnBlocked(bool bCanBeParried)
+{
+	ReceivedCount += bCanBeParried ? 1 : 0;
+}
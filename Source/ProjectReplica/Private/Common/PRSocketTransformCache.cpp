@@ -0,0 +1,135 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Common/PRSocketTransformCache.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+
+// 캐시로 생략한 Socket Transform 계산의 수를 프레임별로 기록하는 CSV 프로파일러 카테고리입니다.
+CSV_DEFINE_CATEGORY(PRSocketTransformCache, true);
+
+TMap<FObjectKey, FPRSocketTransformCache::FPRMeshSocketTransforms> FPRSocketTransformCache::MeshSocketTransforms;
+FPRSocketTransformCacheStats FPRSocketTransformCache::Stats;
+int32 FPRSocketTransformCache::PurgeThreshold = 16;
+
+FTransform FPRSocketTransformCache::GetSocketTransform(USceneComponent* Component, FName SocketName, ERelativeTransformSpace TransformSpace)
+{
+	if(!IsValid(Component))
+	{
+		return FTransform::Identity;
+	}
+
+	Stats.Requests++;
+
+	// 게임 스레드에서 SkeletalMeshComponent의 World, Component 공간을 요청한 경우에만 캐시를 사용합니다.
+	USkeletalMeshComponent* MeshComp = Cast<USkeletalMeshComponent>(Component);
+	if(!MeshComp || !IsInGameThread() || (TransformSpace != RTS_World && TransformSpace != RTS_Component))
+	{
+		Stats.Computations++;
+
+		return Component->GetSocketTransform(SocketName, TransformSpace);
+	}
+
+	FPRMeshSocketTransforms& MeshTransforms = GetValidMeshSocketTransforms(MeshComp);
+	const FTransform* CachedTransform = MeshTransforms.ComponentSpaceTransforms.Find(SocketName);
+	if(CachedTransform)
+	{
+		Stats.CacheHits++;
+		CSV_CUSTOM_STAT(PRSocketTransformCache, CacheHits, 1, ECsvCustomStatOp::Accumulate);
+	}
+	else
+	{
+		Stats.Computations++;
+		CSV_CUSTOM_STAT(PRSocketTransformCache, Computations, 1, ECsvCustomStatOp::Accumulate);
+		CachedTransform = &MeshTransforms.ComponentSpaceTransforms.Emplace(SocketName, MeshComp->GetSocketTransform(SocketName, RTS_Component));
+	}
+
+	if(TransformSpace == RTS_Component)
+	{
+		return *CachedTransform;
+	}
+
+	return *CachedTransform * MeshComp->GetComponentTransform();
+}
+
+FVector FPRSocketTransformCache::GetSocketLocation(USceneComponent* Component, FName SocketName)
+{
+	return GetSocketTransform(Component, SocketName, RTS_World).GetLocation();
+}
+
+void FPRSocketTransformCache::Invalidate(const USkeletalMeshComponent* MeshComp)
+{
+	FPRMeshSocketTransforms* MeshTransforms = MeshSocketTransforms.Find(FObjectKey(MeshComp));
+	if(MeshTransforms)
+	{
+		MeshTransforms->bPoseDirty = true;
+	}
+}
+
+const FPRSocketTransformCacheStats& FPRSocketTransformCache::GetStats()
+{
+	return Stats;
+}
+
+void FPRSocketTransformCache::ResetStats()
+{
+	Stats = FPRSocketTransformCacheStats();
+}
+
+FPRSocketTransformCache::FPRMeshSocketTransforms& FPRSocketTransformCache::GetValidMeshSocketTransforms(USkeletalMeshComponent* MeshComp)
+{
+	const FObjectKey MeshKey(MeshComp);
+	FPRMeshSocketTransforms* MeshTransforms = MeshSocketTransforms.Find(MeshKey);
+	if(!MeshTransforms)
+	{
+		PurgeStaleMeshes();
+
+		MeshTransforms = &MeshSocketTransforms.Add(MeshKey);
+		MeshTransforms->MeshComp = MeshComp;
+
+		// 포즈가 갱신되면 캐시를 비우도록 델리게이트를 등록합니다.
+		MeshTransforms->BoneTransformsFinalizedHandle = MeshComp->RegisterOnBoneTransformsFinalizedDelegate(
+			FOnBoneTransformsFinalizedMultiCast::FDelegate::CreateLambda([MeshKey]()
+			{
+				FPRMeshSocketTransforms* FinalizedMeshTransforms = MeshSocketTransforms.Find(MeshKey);
+				if(FinalizedMeshTransforms)
+				{
+					FinalizedMeshTransforms->bPoseDirty = true;
+				}
+			}));
+	}
+
+	// 포즈가 갱신되었거나 프레임이 바뀌었으면 캐시를 비웁니다.
+	if(MeshTransforms->bPoseDirty || MeshTransforms->FrameCounter != GFrameCounter)
+	{
+		if(MeshTransforms->ComponentSpaceTransforms.Num() > 0)
+		{
+			Stats.PoseInvalidations++;
+		}
+
+		MeshTransforms->ComponentSpaceTransforms.Reset();
+		MeshTransforms->FrameCounter = GFrameCounter;
+		MeshTransforms->bPoseDirty = false;
+	}
+
+	return *MeshTransforms;
+}
+
+void FPRSocketTransformCache::PurgeStaleMeshes()
+{
+	// 캐시의 크기가 이전에 정리한 크기의 두 배를 넘을 때만 정리합니다.
+	if(MeshSocketTransforms.Num() < PurgeThreshold)
+	{
+		return;
+	}
+
+	for(auto It = MeshSocketTransforms.CreateIterator(); It; ++It)
+	{
+		if(!It.Value().MeshComp.IsValid())
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	PurgeThreshold = FMath::Max(MeshSocketTransforms.Num() * 2, 16);
+}
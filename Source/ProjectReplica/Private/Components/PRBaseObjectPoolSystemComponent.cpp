@@ -2,6 +2,7 @@
 
 
 #include "Components/PRBaseObjectPoolSystemComponent.h"
+#include "Interfaces/PRInterfaceDispatch.h"
 
 UPRBaseObjectPoolSystemComponent::UPRBaseObjectPoolSystemComponent()
 {
@@ -29,19 +30,19 @@ void UPRBaseObjectPoolSystemComponent::ClearAllObjectPool()
 
 bool UPRBaseObjectPoolSystemComponent::IsPoolableObject(UObject* PoolableObject) const
 {
-	return IsValid(PoolableObject) && PoolableObject->GetClass()->ImplementsInterface(UPRPoolableInterface::StaticClass());
+	return FPRClassCapabilityRegistry::IsPoolable(PoolableObject);
 }
 
 bool UPRBaseObjectPoolSystemComponent::IsPoolableObjectClass(TSubclassOf<UObject> PoolableObjectClass) const
 {
-	return IsValid(PoolableObjectClass) && PoolableObjectClass->ImplementsInterface(UPRPoolableInterface::StaticClass());
+	return FPRClassCapabilityRegistry::IsPoolableClass(PoolableObjectClass);
 }
 
 void UPRBaseObjectPoolSystemComponent::ActivateObject(UObject* PoolableObject)
 {
 	if(IsPoolableObject(PoolableObject))
 	{
-		IPRPoolableInterface::Execute_Activate(PoolableObject);
+		FPRPoolableDispatch::Activate(PoolableObject);
 	}
 }
 
@@ -49,7 +50,7 @@ void UPRBaseObjectPoolSystemComponent::DeactivateObject(UObject* PoolableObject)
 {
 	if(IsPoolableObject(PoolableObject))
 	{
-		IPRPoolableInterface::Execute_Deactivate(PoolableObject);
+		FPRPoolableDispatch::Deactivate(PoolableObject);
 	}
 }
 
@@ -57,7 +58,7 @@ float UPRBaseObjectPoolSystemComponent::GetLifespan(UObject* PoolableObject) con
 {
 	if(IsPoolableObject(PoolableObject))
 	{
-		return IPRPoolableInterface::Execute_GetLifespan(PoolableObject);
+		return FPRPoolableDispatch::GetLifespan(PoolableObject);
 	}
 	
 	// 유효하지 않은 float 값을 나타내기 위해 NAN을 반환합니다.
@@ -68,7 +69,7 @@ void UPRBaseObjectPoolSystemComponent::SetLifespan(UObject* PoolableObject, floa
 {
 	if(IsPoolableObject(PoolableObject))
 	{
-		IPRPoolableInterface::Execute_SetLifespan(PoolableObject, NewLifespan);
+		FPRPoolableDispatch::SetLifespan(PoolableObject, NewLifespan);
 	}
 }
 
@@ -76,7 +77,7 @@ int32 UPRBaseObjectPoolSystemComponent::GetPoolIndex(UObject* PoolableObject) co
 {
 	if(IsPoolableObject(PoolableObject))
 	{
-		return IPRPoolableInterface::Execute_GetPoolIndex(PoolableObject);
+		return FPRPoolableDispatch::GetPoolIndex(PoolableObject);
 	}
 
 	// 유효하지 않은 Index를 반환합니다.
@@ -96,7 +97,7 @@ int32 UPRBaseObjectPoolSystemComponent::FindAvailableIndex(const TSet<int32>& Us
 
 bool UPRBaseObjectPoolSystemComponent::IsActivateObject(UObject* PoolableObject) const
 {
-	return IsPoolableObject(PoolableObject) && IPRPoolableInterface::Execute_IsActivate(PoolableObject);
+	return IsPoolableObject(PoolableObject) && FPRPoolableDispatch::IsActivate(PoolableObject);
 }
 
 void UPRBaseObjectPoolSystemComponent::ClearDynamicDestroyObjectList(FPRDynamicDestroyObjectList& TargetDynamicDestroyObjectList)
@@ -7,6 +7,7 @@
 #include "Components/PRStatSystemComponent.h"
 #include "Components/PRStateSystemComponent.h"
 #include "Components/PRObjectPoolSystemComponent.h"
+#include "Subsystems/PRDamageQueueSubsystem.h"
 #include "Characters/PRBaseCharacter.h"
 #include "Kismet/GameplayStatics.h"
 #include "Objects/PRDamageAmount.h"
@@ -76,38 +77,32 @@ bool UPRDamageSystemComponent::TakeDamage(FPRDamageInfo DamageInfo)
 	switch(CanBeDamagedResult)
 	{
 	case EPRCanBeDamaged::CanBeDamaged_BlockDamage:
-		if(OnBlockedDelegate.IsBound())
-		{
-			// 방어 상태이면서 방어할 수 있는 대미지이므로 패링합니다.
-			OnBlockedDelegate.Broadcast(DamageInfo.bCanBeParried);
-		}
+		// 방어 상태이면서 방어할 수 있는 대미지이므로 패링합니다.
+		BroadcastBlocked(DamageInfo.bCanBeParried);
 		break;
 		
 	case EPRCanBeDamaged::CanBeDamaged_DoDamage:
 		{
 			if(GetPRGameMode() != nullptr)
 			{
-				GetPRGameMode()->ActivateDamageAmount(DamageInfo.ImpactLocation, DamageInfo.Amount, DamageInfo.bIsCritical, DamageInfo.DamageElementType);
+				GetPRGameMode()->ShowDamageAmount(GetOwner(), DamageInfo.ImpactLocation, DamageInfo.Amount, DamageInfo.bIsCritical, DamageInfo.DamageElementType);
 			}
 		
 			StatSystem->SetHealth(CharacterStat.Health -= DamageInfo.Amount);
 			if(CharacterStat.Health <= 0.0f)
 			{
-				// 캐릭터의 체력이 0이하(사망)일 경우 OnDeathDelegate를 실행합니다.
-				if(OnDeathDelegate.IsBound())
-				{
-					OnDeathDelegate.Broadcast();
-				}
+				// 캐릭터의 체력이 0이하(사망)일 경우 사망을 알립니다.
+				BroadcastDeath();
 			}
 			else
 			{
 				// 동작을 강제로 중단할 수 있는 상태이거나 동작을 강제로 중단해야하는 대미지일 경우
-				// OnDamageResponseDelegate를 실행합니다.
+				// 대미지에 대한 반응을 알립니다.
 				if(StateSystem->IsInterruptible() || DamageInfo.bShouldForceInterrupt)
 				{
-					if(OnDamageResponseDelegate.IsBound())
+					if(HasDamageResponseListener())
 					{
-						OnDamageResponseDelegate.Broadcast(DamageInfo.DamageResponse);
+						BroadcastDamageResponse(DamageInfo.DamageResponse);
 						return true;
 					}
 				}
@@ -123,6 +118,80 @@ bool UPRDamageSystemComponent::TakeDamage(FPRDamageInfo DamageInfo)
 	return false;
 }
 
+void UPRDamageSystemComponent::TakeQueuedDamage(const FPRDamageEventQueue& DamageQueue, TConstArrayView<int32> EventIndices, AProjectReplicaGameMode* PRGameMode, TBitArray<>& OutAppliedEvents)
+{
+	if(!GetPROwner()
+		|| GetPROwner()->IsDead()
+		|| !StatSystem.IsValid()
+		|| !StateSystem.IsValid())
+	{
+		return;
+	}
+
+	// 능력치와 상태는 대미지 이벤트마다 읽지 않고 한 번만 읽습니다.
+	float Health = StatSystem->GetCharacterStat().Health;
+	const bool bIsInvincible = GetPROwner()->IsInvincible();
+	const bool bIsBlocking = GetPROwner()->IsBlocking();
+	const bool bIsInterruptible = StateSystem->IsInterruptible();
+	const bool bCanRespond = HasDamageResponseListener();
+
+	int32 BlockedEventIndex = INDEX_NONE;
+	int32 ResponseEventIndex = INDEX_NONE;
+	bool bIsDead = false;
+	for(const int32 EventIndex : EventIndices)
+	{
+		if(bIsInvincible && !DamageQueue.HasFlag(EventIndex, EPRDamageEventFlags::DamageInvincible))
+		{
+			continue;
+		}
+
+		if(bIsBlocking && DamageQueue.HasFlag(EventIndex, EPRDamageEventFlags::CanBeBlocked))
+		{
+			BlockedEventIndex = EventIndex;
+			continue;
+		}
+
+		if(PRGameMode != nullptr)
+		{
+			PRGameMode->ShowDamageAmount(GetOwner(), DamageQueue.ImpactLocations[EventIndex], DamageQueue.Amounts[EventIndex],
+											DamageQueue.HasFlag(EventIndex, EPRDamageEventFlags::Critical), DamageQueue.ElementTypes[EventIndex]);
+		}
+
+		Health -= DamageQueue.Amounts[EventIndex];
+		if(Health <= 0.0f)
+		{
+			// 사망한 후의 대미지 이벤트는 처리하지 않습니다.
+			bIsDead = true;
+			break;
+		}
+
+		if(bCanRespond && (bIsInterruptible || DamageQueue.HasFlag(EventIndex, EPRDamageEventFlags::ForceInterrupt)))
+		{
+			ResponseEventIndex = EventIndex;
+		}
+	}
+
+	StatSystem->SetHealth(Health);
+
+	if(BlockedEventIndex != INDEX_NONE)
+	{
+		// 방어 상태이면서 방어할 수 있는 대미지이므로 패링합니다.
+		BroadcastBlocked(DamageQueue.HasFlag(BlockedEventIndex, EPRDamageEventFlags::CanBeParried));
+	}
+
+	if(bIsDead)
+	{
+		// 캐릭터의 체력이 0이하(사망)일 경우 사망을 알립니다.
+		BroadcastDeath();
+	}
+	else if(ResponseEventIndex != INDEX_NONE)
+	{
+		// 반응은 마지막 대미지 이벤트에 대해서 한 번만 실행하므로 해당 대미지 이벤트만 반응한 것으로 기록합니다.
+		OutAppliedEvents[ResponseEventIndex] = true;
+		BroadcastDamageResponse(DamageQueue.DamageResponses[ResponseEventIndex]);
+	}
+}
+
 EPRCanBeDamaged UPRDamageSystemComponent::CanBeDamaged(const bool& bShouldDamageInvincible, const bool& bCanBeBlocked)
 {
 	if(GetPROwner()
@@ -139,3 +208,34 @@ EPRCanBeDamaged UPRDamageSystemComponent::CanBeDamaged(const bool& bShouldDamage
 
 	return EPRCanBeDamaged::CanBeDamaged_NoDamage;
 }
+
+void UPRDamageSystemComponent::BroadcastDeath()
+{
+	OnDeathNativeDelegate.Broadcast();
+
+	// 블루프린트 델리게이트는 리플렉션으로 호출하므로 바인딩한 함수가 있을 때만 호출합니다.
+	if(OnDeathDelegate.IsBound())
+	{
+		OnDeathDelegate.Broadcast();
+	}
+}
+
+void UPRDamageSystemComponent::BroadcastBlocked(bool bCanBeParried)
+{
+	OnBlockedNativeDelegate.Broadcast(bCanBeParried);
+
+	if(OnBlockedDelegate.IsBound())
+	{
+		OnBlockedDelegate.Broadcast(bCanBeParried);
+	}
+}
+
+void UPRDamageSystemComponent::BroadcastDamageResponse(EPRDamageResponse DamageResponse)
+{
+	OnDamageResponseNativeDelegate.Broadcast(DamageResponse);
+
+	if(OnDamageResponseDelegate.IsBound())
+	{
+		OnDamageResponseDelegate.Broadcast(DamageResponse);
+	}
+}
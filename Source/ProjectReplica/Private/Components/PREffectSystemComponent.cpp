@@ -3,15 +3,48 @@
 
 #include "Components/PREffectSystemComponent.h"
 #include "Characters/PRBaseCharacter.h"
+#include "Common/PRSocketTransformCache.h"
+#include "Subsystems/PRSharedEffectPoolSubsystem.h"
+#include "Camera/PlayerCameraManager.h"
+#include "Kismet/GameplayStatics.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+
+// 이펙트 시스템의 프레임별 사용량을 기록하는 CSV 프로파일러 카테고리입니다.
+CSV_DEFINE_CATEGORY(PREffectSystem, true);
 
 UPREffectSystemComponent::UPREffectSystemComponent()
 {
+#if CSV_PROFILER
+	// CSV 프로파일러가 캡처 중일 때 활성화된 이펙트의 수를 매 프레임 기록합니다.
+	// 캡처하지 않을 때는 Tick하지 않도록 비활성화한 상태로 시작하고, 캡처를 시작하면 활성화합니다.
+	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.bStartWithTickEnabled = false;
+#endif
+	
 	// NiagaraSystem
 	NiagaraPoolSettingsDataTable = nullptr;
+	bUseNiagaraEffectLOD = true;
+	bPrimeNiagaraPoolOnWarmUp = true;
+	bUseSharedNiagaraPool = false;
+	SharedNiagaraPoolOwnerQuota = 8;
 	NiagaraPool = FPRNiagaraEffectObjectPool();
 	ActivateNiagaraIndexList = FPRActivateNiagaraEffectIndexList();
 	UsedNiagaraIndexList = FPRUsedNiagaraEffectIndexList();
 	DynamicDestroyNiagaraList = FPRDynamicDestroyNiagaraEffectList();
+	NiagaraPoolStats = FPREffectPoolStats();
+
+	// LoopingNiagaraEffect
+	MaxLoopingNiagaraEffects = 16;
+	NextLoopingEffectHandleID = 0;
+
+	// SpawnCulling
+	bUseSpawnCulling = true;
+	SpawnCullDistance = 8000.0f;
+	bCullOutsideFrustum = true;
+	SpawnCullBoundsRadius = 300.0f;
+	OwnerRenderTimeThreshold = 1.0f;
+	LastSpawnCullReason = EPREffectCullReason::EffectCullReason_None;
 
 	// ParticleSystem
 	ParticlePoolSettingsDataTable = nullptr;
@@ -19,6 +52,46 @@ UPREffectSystemComponent::UPREffectSystemComponent()
 	ActivateParticleIndexList = FPRActivateParticleEffectIndexList();
 	UsedParticleIndexList = FPRUsedParticleEffectIndexList();
 	DynamicDestroyParticleList = FPRDynamicDestroyParticleEffectList();
+	ParticlePoolStats = FPREffectPoolStats();
+}
+
+void UPREffectSystemComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+#if CSV_PROFILER
+	CsvProfileStartHandle = FCsvProfiler::Get()->OnCSVProfileStart().AddUObject(this, &UPREffectSystemComponent::OnCsvProfileStart);
+	SetComponentTickEnabled(FCsvProfiler::Get()->IsCapturing());
+#endif
+}
+
+void UPREffectSystemComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+#if CSV_PROFILER
+	FCsvProfiler::Get()->OnCSVProfileStart().Remove(CsvProfileStartHandle);
+#endif
+
+	// 공유 Pool에서 가져온 NiagaraEffect를 다른 Owner가 사용할 수 있도록 반환합니다.
+	ReleaseSharedNiagaraEffects();
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void UPREffectSystemComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+#if CSV_PROFILER
+	if(FCsvProfiler::Get()->IsCapturing())
+	{
+		RecordActiveEffectCsvStats();
+	}
+	else
+	{
+		// 캡처가 끝나면 다음 캡처를 시작할 때까지 Tick하지 않습니다.
+		SetComponentTickEnabled(false);
+	}
+#endif
 }
 
 #pragma region PRBaseObjectPoolSystem
@@ -33,6 +106,130 @@ void UPREffectSystemComponent::ClearAllObjectPool()
 	ClearAllNiagaraPool();
 	ClearAllParticlePool();
 }
+
+void UPREffectSystemComponent::ResetPoolStats()
+{
+	NiagaraPoolStats = FPREffectPoolStats();
+	NiagaraActivationStats.Empty();
+	ParticlePoolStats = FPREffectPoolStats();
+}
+
+void UPREffectSystemComponent::RecordActiveEffectCsvStats() const
+{
+#if CSV_PROFILER
+	// 여러 EffectSystem의 값을 합산하도록 Accumulate로 기록합니다.
+	int32 ActiveNiagaraEffectCount = 0;
+	for(const auto& ActivateIndexList : ActivateNiagaraIndexList.List)
+	{
+		if(ActivateIndexList.Key && ActivateIndexList.Value.Indexes.Num() > 0)
+		{
+			const FName* StatName = ActiveEffectCsvStatNames.Find(ActivateIndexList.Key.Get());
+			if(StatName)
+			{
+				FCsvProfiler::RecordCustomStat(*StatName, CSV_CATEGORY_INDEX(PREffectSystem), ActivateIndexList.Value.Indexes.Num(), ECsvCustomStatOp::Accumulate);
+			}
+
+			ActiveNiagaraEffectCount += ActivateIndexList.Value.Indexes.Num();
+		}
+	}
+
+	int32 ActiveParticleEffectCount = 0;
+	for(const auto& ActivateIndexList : ActivateParticleIndexList.List)
+	{
+		if(ActivateIndexList.Key && ActivateIndexList.Value.Indexes.Num() > 0)
+		{
+			const FName* StatName = ActiveEffectCsvStatNames.Find(ActivateIndexList.Key.Get());
+			if(StatName)
+			{
+				FCsvProfiler::RecordCustomStat(*StatName, CSV_CATEGORY_INDEX(PREffectSystem), ActivateIndexList.Value.Indexes.Num(), ECsvCustomStatOp::Accumulate);
+			}
+
+			ActiveParticleEffectCount += ActivateIndexList.Value.Indexes.Num();
+		}
+	}
+
+	CSV_CUSTOM_STAT(PREffectSystem, ActiveNiagaraEffects, ActiveNiagaraEffectCount, ECsvCustomStatOp::Accumulate);
+	CSV_CUSTOM_STAT(PREffectSystem, ActiveParticleEffects, ActiveParticleEffectCount, ECsvCustomStatOp::Accumulate);
+#endif
+}
+
+void UPREffectSystemComponent::OnCsvProfileStart()
+{
+	SetComponentTickEnabled(true);
+}
+
+void UPREffectSystemComponent::CacheActiveEffectCsvStatName(const UObject* EffectAsset, const TCHAR* Prefix)
+{
+#if CSV_PROFILER
+	if(EffectAsset && !ActiveEffectCsvStatNames.Contains(EffectAsset))
+	{
+		ActiveEffectCsvStatNames.Add(EffectAsset, FName(*FString::Printf(TEXT("%s_%s"), Prefix, *EffectAsset->GetName())));
+	}
+#endif
+}
+#pragma endregion
+
+#pragma region SpawnCulling
+EPREffectCullReason UPREffectSystemComponent::GetEffectSpawnCullReason(const FVector& SpawnLocation) const
+{
+	if(!bUseSpawnCulling)
+	{
+		return EPREffectCullReason::EffectCullReason_None;
+	}
+
+	// 로컬 플레이어의 카메라가 없을 경우 컬링하지 않습니다.
+	const APlayerCameraManager* PlayerCameraManager = UGameplayStatics::GetPlayerCameraManager(this, 0);
+	if(!IsValid(PlayerCameraManager))
+	{
+		return EPREffectCullReason::EffectCullReason_None;
+	}
+
+	const FVector CameraLocation = PlayerCameraManager->GetCameraLocation();
+	const FVector ToSpawnLocation = SpawnLocation - CameraLocation;
+	const float DistanceSquared = ToSpawnLocation.SizeSquared();
+
+	// 카메라와의 거리를 검사합니다.
+	if(SpawnCullDistance > 0.0f && DistanceSquared > FMath::Square(SpawnCullDistance))
+	{
+		return EPREffectCullReason::EffectCullReason_Distance;
+	}
+
+	// 경계 구가 카메라의 시야 원뿔과 겹치는지 검사합니다. 수평 FOV를 사용하므로 수직 방향은 보수적으로 판단합니다.
+	if(bCullOutsideFrustum && DistanceSquared > FMath::Square(SpawnCullBoundsRadius))
+	{
+		const float Distance = FMath::Sqrt(DistanceSquared);
+		const float HalfFOVRadians = FMath::DegreesToRadians(PlayerCameraManager->GetFOVAngle() * 0.5f);
+		const float BoundsAngleRadians = FMath::Asin(FMath::Clamp(SpawnCullBoundsRadius / Distance, 0.0f, 1.0f));
+		const float CosAngle = FVector::DotProduct(PlayerCameraManager->GetCameraRotation().Vector(), ToSpawnLocation / Distance);
+		if(CosAngle < FMath::Cos(FMath::Min(HalfFOVRadians + BoundsAngleRadians, PI)))
+		{
+			return EPREffectCullReason::EffectCullReason_Frustum;
+		}
+	}
+
+	// Owner가 최근에 렌더링되었는지 검사합니다.
+	const AActor* EffectOwner = GetOwner();
+	if(OwnerRenderTimeThreshold > 0.0f && IsValid(EffectOwner) && !EffectOwner->WasRecentlyRendered(OwnerRenderTimeThreshold))
+	{
+		return EPREffectCullReason::EffectCullReason_NotRendered;
+	}
+
+	return EPREffectCullReason::EffectCullReason_None;
+}
+
+bool UPREffectSystemComponent::CullEffectSpawn(const FVector& SpawnLocation, bool bAllowSpawnCulling, FPREffectPoolStats& PoolStats)
+{
+	// 컬링된 Spawn은 다시 요청하지 않으므로 호출자가 허용한 경우에만 컬링합니다.
+	LastSpawnCullReason = bAllowSpawnCulling ? GetEffectSpawnCullReason(SpawnLocation) : EPREffectCullReason::EffectCullReason_None;
+	if(LastSpawnCullReason != EPREffectCullReason::EffectCullReason_None)
+	{
+		PoolStats.AddCulled(LastSpawnCullReason);
+
+		return true;
+	}
+
+	return false;
+}
 #pragma endregion 
 
 #pragma region NiagaraSystem
@@ -49,7 +246,40 @@ void UPREffectSystemComponent::InitializeNiagaraPool()
 			FPRNiagaraEffectPoolSettings* NiagaraSettings = NiagaraPoolSettingsDataTable->FindRow<FPRNiagaraEffectPoolSettings>(RowName, FString(""));
 			if(NiagaraSettings)
 			{
+				NiagaraPoolSettingsCache.Emplace(NiagaraSettings->NiagaraSystem, *NiagaraSettings);
+
+				// 공유 Pool을 사용할 경우 캐릭터의 Pool을 생성하지 않고 공유 Pool에 설정 값을 등록합니다.
+				UPRSharedEffectPoolSubsystem* SharedEffectPool = GetSharedEffectPool();
+				if(SharedEffectPool)
+				{
+					SharedEffectPool->RegisterNiagaraPool(*NiagaraSettings, bPrimeNiagaraPoolOnWarmUp);
+					for(const FPRNiagaraEffectLODVariant& LODVariant : NiagaraSettings->LODVariants)
+					{
+						if(LODVariant.NiagaraSystem)
+						{
+							const int32 LODPoolSize = LODVariant.PoolSize > 0 ? LODVariant.PoolSize : NiagaraSettings->PoolSize;
+							const FPRNiagaraEffectPoolSettings LODPoolSettings = FPRNiagaraEffectPoolSettings(LODVariant.NiagaraSystem, LODPoolSize, NiagaraSettings->EffectLifespan);
+							NiagaraPoolSettingsCache.Emplace(LODVariant.NiagaraSystem, LODPoolSettings);
+							SharedEffectPool->RegisterNiagaraPool(LODPoolSettings, bPrimeNiagaraPoolOnWarmUp);
+						}
+					}
+
+					continue;
+				}
+				
 				CreateNiagaraPool(*NiagaraSettings);
+
+				// LODVariant별로 별도의 Pool을 생성합니다.
+				for(const FPRNiagaraEffectLODVariant& LODVariant : NiagaraSettings->LODVariants)
+				{
+					if(LODVariant.NiagaraSystem && !IsCreateNiagaraPool(LODVariant.NiagaraSystem))
+					{
+						const int32 LODPoolSize = LODVariant.PoolSize > 0 ? LODVariant.PoolSize : NiagaraSettings->PoolSize;
+						const FPRNiagaraEffectPoolSettings LODPoolSettings = FPRNiagaraEffectPoolSettings(LODVariant.NiagaraSystem, LODPoolSize, NiagaraSettings->EffectLifespan);
+						NiagaraPoolSettingsCache.Emplace(LODVariant.NiagaraSystem, LODPoolSettings);
+						CreateNiagaraPool(LODPoolSettings);
+					}
+				}
 			}
 		}
 	}
@@ -57,19 +287,34 @@ void UPREffectSystemComponent::InitializeNiagaraPool()
 
 void UPREffectSystemComponent::ClearAllNiagaraPool()
 {
+	NiagaraPoolSettingsCache.Empty();
+	LoopingNiagaraEffects.Empty();
+	LoopingNiagaraEffectHandleIDs.Empty();
 	ActivateNiagaraIndexList.List.Empty();
 	UsedNiagaraIndexList.List.Empty();
 	ClearDynamicDestroyNiagaraList(DynamicDestroyNiagaraList);
 	ClearNiagaraPool(NiagaraPool);
 }
 
-APRNiagaraEffect* UPREffectSystemComponent::SpawnNiagaraEffectAtLocation(UNiagaraSystem* SpawnEffect, FVector Location, FRotator Rotation, FVector Scale, bool bEffectAutoActivate, bool bReset)
+APRNiagaraEffect* UPREffectSystemComponent::SpawnNiagaraEffectAtLocation(UNiagaraSystem* SpawnEffect, FVector Location, FRotator Rotation, FVector Scale, bool bEffectAutoActivate, bool bReset, bool bAllowSpawnCulling)
 {
-	APRNiagaraEffect* ActivateableNiagaraEffect = InitializeNiagaraEffect(SpawnEffect);
+	CSV_SCOPED_TIMING_STAT(PREffectSystem, SpawnNiagaraEffect);
+	TRACE_CPUPROFILER_EVENT_SCOPE(UPREffectSystemComponent::SpawnNiagaraEffect);
+	
+	NiagaraPoolStats.SpawnRequests++;
+	CSV_CUSTOM_STAT(PREffectSystem, NiagaraSpawns, 1, ECsvCustomStatOp::Accumulate);
+	if(CullEffectSpawn(Location, bAllowSpawnCulling, NiagaraPoolStats))
+	{
+		return nullptr;
+	}
+	
+	APRNiagaraEffect* ActivateableNiagaraEffect = InitializeNiagaraEffect(SelectNiagaraSystemLOD(SpawnEffect, Location));
 	if(IsValid(ActivateableNiagaraEffect))
 	{
 		// NiagaraEffect를 활성화하고 Spawn할 위치와 회전값, 크기, 자동실행 여부를 적용합니다.
+		const double ActivationStartTime = FPlatformTime::Seconds();
 		ActivateableNiagaraEffect->SpawnEffectAtLocation(Location, Rotation, Scale, bEffectAutoActivate, bReset);
+		RecordNiagaraActivation(ActivateableNiagaraEffect, static_cast<float>(FPlatformTime::Seconds() - ActivationStartTime));
 	
 		return ActivateableNiagaraEffect;
 	}
@@ -77,13 +322,27 @@ APRNiagaraEffect* UPREffectSystemComponent::SpawnNiagaraEffectAtLocation(UNiagar
 	return nullptr;
 }
 
-APRNiagaraEffect* UPREffectSystemComponent::SpawnNiagaraEffectAttached(UNiagaraSystem* SpawnEffect,	USceneComponent* Parent, FName AttachSocketName, FVector Location, FRotator Rotation, FVector Scale, bool bEffectAutoActivate, bool bReset)
+APRNiagaraEffect* UPREffectSystemComponent::SpawnNiagaraEffectAttached(UNiagaraSystem* SpawnEffect,	USceneComponent* Parent, FName AttachSocketName, FVector Location, FRotator Rotation, FVector Scale, bool bEffectAutoActivate, bool bReset, bool bAllowSpawnCulling)
 {
-	APRNiagaraEffect* ActivateableNiagaraEffect = InitializeNiagaraEffect(SpawnEffect);
+	CSV_SCOPED_TIMING_STAT(PREffectSystem, SpawnNiagaraEffect);
+	TRACE_CPUPROFILER_EVENT_SCOPE(UPREffectSystemComponent::SpawnNiagaraEffect);
+	
+	NiagaraPoolStats.SpawnRequests++;
+	CSV_CUSTOM_STAT(PREffectSystem, NiagaraSpawns, 1, ECsvCustomStatOp::Accumulate);
+	
+	const FVector SpawnLocation = IsValid(Parent) ? FPRSocketTransformCache::GetSocketLocation(Parent, AttachSocketName) + Location : Location;
+	if(CullEffectSpawn(SpawnLocation, bAllowSpawnCulling, NiagaraPoolStats))
+	{
+		return nullptr;
+	}
+	
+	APRNiagaraEffect* ActivateableNiagaraEffect = InitializeNiagaraEffect(SelectNiagaraSystemLOD(SpawnEffect, SpawnLocation));
 	if(IsValid(ActivateableNiagaraEffect))
 	{
 		// NiagaraEffect를 활성화하고 Spawn하여 부착할 Component와 위치, 회전값, 크기, 자동실행 여부를 적용합니다.
+		const double ActivationStartTime = FPlatformTime::Seconds();
 		ActivateableNiagaraEffect->SpawnEffectAttached(Parent, AttachSocketName, Location, Rotation, Scale, EAttachLocation::KeepWorldPosition, bEffectAutoActivate, bReset);
+		RecordNiagaraActivation(ActivateableNiagaraEffect, static_cast<float>(FPlatformTime::Seconds() - ActivationStartTime));
 	
 		return ActivateableNiagaraEffect;
 	}
@@ -131,8 +390,14 @@ APRNiagaraEffect* UPREffectSystemComponent::GetActivateableNiagaraEffect(UNiagar
 	// PoolEntry의 모든 NiagaraEffect가 활성화되었을 경우 새로운 NiagaraEffect를 생성합니다.
 	if(!ActivateableNiagaraEffect)
 	{
+		NiagaraPoolStats.PoolMisses++;
+		CSV_CUSTOM_STAT(PREffectSystem, NiagaraPoolMisses, 1, ECsvCustomStatOp::Accumulate);
 		ActivateableNiagaraEffect = SpawnDynamicNiagaraEffectInWorld(NiagaraSystem);
 	}
+	else
+	{
+		NiagaraPoolStats.PoolHits++;
+	}
 	
 	// 동적으로 생성된 NiagaraEffect일 경우 DynamicEffectDestroyTimer를 정지합니다.
 	if(IsDynamicNiagaraEffect(ActivateableNiagaraEffect))
@@ -159,6 +424,13 @@ bool UPREffectSystemComponent::IsActivateNiagaraEffect(APRNiagaraEffect* Niagara
 		return false;
 	}
 
+	// 공유 Pool의 NiagaraEffect는 활성화되어 있고 Owner가 같은지 확인합니다.
+	const UPRSharedEffectPoolSubsystem* SharedEffectPool = GetSharedEffectPool();
+	if(SharedEffectPool && SharedEffectPool->IsSharedNiagaraEffect(NiagaraEffect))
+	{
+		return IsActivateObject(NiagaraEffect) && NiagaraEffect->GetEffectOwner() == GetOwner();
+	}
+
 	// NiagaraSystem에 해당하는 활성화된 Index 목록을 찾습니다.
 	const FPRActivateIndexList* IndexList = ActivateNiagaraIndexList.List.Find(NiagaraEffect->GetNiagaraEffectAsset());
 	if(IndexList)
@@ -234,6 +506,15 @@ void UPREffectSystemComponent::CreateNiagaraPool(const FPRNiagaraEffectPoolSetti
 	if(GetWorld() && NiagaraPoolSettings.NiagaraSystem)
 	{
 		FPRNiagaraEffectPool NewNiagaraEffectPool;
+		const double WarmUpStartTime = FPlatformTime::Seconds();
+
+#if WITH_EDITORONLY_DATA
+		// 에디터에서는 준비 단계에서 활성화하기 전에 NiagaraSystem의 컴파일이 끝나기를 기다립니다.
+		if(bPrimeNiagaraPoolOnWarmUp)
+		{
+			NiagaraPoolSettings.NiagaraSystem->WaitForCompilationComplete();
+		}
+#endif
 
 		// PoolSize만큼 NiagaraEffect를 월드에 Spawn한 후 NewNiagaraEffectPool에 보관합니다.
 		for(int32 Index = 0; Index < NiagaraPoolSettings.PoolSize; Index++)
@@ -241,10 +522,18 @@ void UPREffectSystemComponent::CreateNiagaraPool(const FPRNiagaraEffectPoolSetti
 			APRNiagaraEffect* SpawnNiagaraEffect = SpawnNiagaraEffectInWorld(NiagaraPoolSettings.NiagaraSystem, Index, NiagaraPoolSettings.EffectLifespan);
 			if(IsValid(SpawnNiagaraEffect))
 			{
+				if(bPrimeNiagaraPoolOnWarmUp)
+				{
+					SpawnNiagaraEffect->PrimeNiagaraEffect();
+					NiagaraPoolStats.PrimedEffects++;
+				}
+				
 				NewNiagaraEffectPool.PooledEffects.Emplace(SpawnNiagaraEffect);
 			}
 		}
 
+		NiagaraPoolStats.WarmUpTime += static_cast<float>(FPlatformTime::Seconds() - WarmUpStartTime);
+
 		// 초기화된 NewNiagaraEffectPool를 NiagaraPool에 추가하고 ActivateNiagaraIndexList를 생성합니다.
 		NiagaraPool.Pool.Emplace(NiagaraPoolSettings.NiagaraSystem, NewNiagaraEffectPool);
 	}
@@ -255,6 +544,7 @@ void UPREffectSystemComponent::CreateActivateNiagaraIndexList(UNiagaraSystem* Ni
 	if(NiagaraSystem)
 	{
 		ActivateNiagaraIndexList.List.Emplace(NiagaraSystem);
+		CacheActiveEffectCsvStatName(NiagaraSystem, TEXT("ActiveNiagara"));
 	}
 }
 
@@ -298,7 +588,7 @@ APRNiagaraEffect* UPREffectSystemComponent::SpawnNiagaraEffectInWorld(UNiagaraSy
 	NiagaraEffect->InitializeNiagaraEffect(NiagaraSystem, GetPROwner(), PoolIndex, Lifespan);
 
 	// NiagaraEffect의 OnEffectDeactivateDelegate 이벤트에 대한 콜백 함수를 바인딩합니다.
-	NiagaraEffect->OnEffectDeactivateDelegate.AddDynamic(this, &UPREffectSystemComponent::OnNiagaraEffectDeactivate);
+	NiagaraEffect->OnEffectDeactivateDelegate.AddUObject(this, &UPREffectSystemComponent::OnNiagaraEffectDeactivate);
 
 	return NiagaraEffect;
 }
@@ -342,6 +632,9 @@ APRNiagaraEffect* UPREffectSystemComponent::SpawnDynamicNiagaraEffectInWorld(UNi
 	const FPRNiagaraEffectPoolSettings NiagaraEffectSettings = GetNiagaraEffectPoolSettingsFromDataTable(NiagaraSystem);
 	if(NiagaraEffectSettings != FPRNiagaraEffectPoolSettings())
 	{
+		// 데이터 테이블로 크기를 지정한 Pool이 부족한 경우이므로 PoolSize를 조정할 수 있도록 경고를 출력합니다.
+		PR_LOG_WARNING("%s pool (size %d) is exhausted, spawning a dynamic effect", *GetNameSafe(NiagaraSystem), NiagaraEffectSettings.PoolSize);
+		
 		// 데이터 테이블에 NiagaraEffect의 설정 값을 가지고 있을 경우 설정 값의 Lifespan을 적용합니다.
 		DynamicNiagaraEffect = SpawnNiagaraEffectInWorld(NiagaraSystem, NewIndex, NiagaraEffectSettings.EffectLifespan);
 	}
@@ -352,7 +645,7 @@ APRNiagaraEffect* UPREffectSystemComponent::SpawnDynamicNiagaraEffectInWorld(UNi
 	}
 		
 	// OnDynamicNiagaraEffectDeactivate 함수를 바인딩합니다.
-	DynamicNiagaraEffect->OnEffectDeactivateDelegate.AddDynamic(this, &UPREffectSystemComponent::OnDynamicNiagaraEffectDeactivate);
+	DynamicNiagaraEffect->OnEffectDeactivateDelegate.AddUObject(this, &UPREffectSystemComponent::OnDynamicNiagaraEffectDeactivate);
 
 	// NiagaraPool에서 해당 NiagaraSystem의 Pool을 얻습니다.
 	FPRNiagaraEffectPool* PoolEntry = NiagaraPool.Pool.Find(NiagaraSystem);
@@ -366,12 +659,20 @@ APRNiagaraEffect* UPREffectSystemComponent::SpawnDynamicNiagaraEffectInWorld(UNi
 
 	// 새로 생성한 NiagaraEffect를 PoolEntry에 추가합니다.
 	PoolEntry->PooledEffects.Emplace(DynamicNiagaraEffect);
+	NiagaraPoolStats.DynamicCreations++;
+	CSV_CUSTOM_STAT(PREffectSystem, NiagaraDynamicCreations, 1, ECsvCustomStatOp::Accumulate);
 
 	return DynamicNiagaraEffect;
 }
 
 APRNiagaraEffect* UPREffectSystemComponent::InitializeNiagaraEffect(UNiagaraSystem* SpawnEffect)
 {
+	// 공유 Pool을 사용할 경우 공유 Pool에서 NiagaraEffect를 가져옵니다.
+	if(GetSharedEffectPool())
+	{
+		return AcquireSharedNiagaraEffect(SpawnEffect);
+	}
+	
 	APRNiagaraEffect* ActivateableNiagaraEffect = GetActivateableNiagaraEffect(SpawnEffect);
 	
 	// 유효하지 않는 NiagaraEffect이거나 풀링 가능한 객체가 아니면 nullptr를 반환합니다.
@@ -405,8 +706,39 @@ void UPREffectSystemComponent::ClearDynamicDestroyNiagaraList(FPRDynamicDestroyN
 	ClearDynamicDestroyObjects(TargetDynamicDestroyNiagaraEffectList.List);
 }
 
+UNiagaraSystem* UPREffectSystemComponent::SelectNiagaraSystemLOD(UNiagaraSystem* SpawnEffect, const FVector& SpawnLocation) const
+{
+	if(!bUseNiagaraEffectLOD || !SpawnEffect)
+	{
+		return SpawnEffect;
+	}
+
+	// LODVariant가 없는 NiagaraSystem은 거리를 계산하지 않습니다.
+	const FPRNiagaraEffectPoolSettings* NiagaraPoolSettings = NiagaraPoolSettingsCache.Find(SpawnEffect);
+	if(!NiagaraPoolSettings || NiagaraPoolSettings->LODVariants.IsEmpty())
+	{
+		return SpawnEffect;
+	}
+
+	const APlayerCameraManager* PlayerCameraManager = UGameplayStatics::GetPlayerCameraManager(this, 0);
+	if(!IsValid(PlayerCameraManager))
+	{
+		return SpawnEffect;
+	}
+
+	const float Distance = FVector::Dist(PlayerCameraManager->GetCameraLocation(), SpawnLocation);
+	
+	return NiagaraPoolSettings->GetNiagaraSystemForDistance(Distance);
+}
+
 FPRNiagaraEffectPoolSettings UPREffectSystemComponent::GetNiagaraEffectPoolSettingsFromDataTable(UNiagaraSystem* NiagaraSystem) const
 {
+	const FPRNiagaraEffectPoolSettings* CachedNiagaraPoolSettings = NiagaraPoolSettingsCache.Find(NiagaraSystem);
+	if(CachedNiagaraPoolSettings)
+	{
+		return *CachedNiagaraPoolSettings;
+	}
+	
 	if(NiagaraPoolSettingsDataTable != nullptr)
 	{
 		TArray<FName> RowNames = NiagaraPoolSettingsDataTable->GetRowNames();
@@ -426,6 +758,9 @@ FPRNiagaraEffectPoolSettings UPREffectSystemComponent::GetNiagaraEffectPoolSetti
 
 void UPREffectSystemComponent::OnNiagaraEffectDeactivate(APREffect* TargetEffect)
 {
+	CSV_SCOPED_TIMING_STAT(PREffectSystem, DeactivateNiagaraEffect);
+	TRACE_CPUPROFILER_EVENT_SCOPE(UPREffectSystemComponent::DeactivateNiagaraEffect);
+	
 	APRNiagaraEffect* TargetNiagaraEffect = Cast<APRNiagaraEffect>(TargetEffect);
 	// 유효하지 않는 NiagaraEffect이거나 풀링 가능한 NiagaraEffect가 아니거나 NiagaraComponent가 없으면 반환합니다.
 	if(!IsValid(TargetNiagaraEffect)
@@ -435,6 +770,9 @@ void UPREffectSystemComponent::OnNiagaraEffectDeactivate(APREffect* TargetEffect
 		return;
 	}
 
+	// 반복 재생 중인 NiagaraEffect라면 반복 재생 목록에서 제거합니다.
+	UnregisterLoopingNiagaraEffect(TargetNiagaraEffect);
+
 	// TargetNiagaraEffect가 활성화된 상태라면 비활성화합니다.
 	if(IsActivateNiagaraEffect(TargetNiagaraEffect))
 	{
@@ -447,8 +785,82 @@ void UPREffectSystemComponent::OnNiagaraEffectDeactivate(APREffect* TargetEffect
 	}
 }
 
+void UPREffectSystemComponent::ReleaseSharedNiagaraEffects()
+{
+	UPRSharedEffectPoolSubsystem* SharedEffectPool = GetSharedEffectPool();
+	if(SharedEffectPool)
+	{
+		SharedEffectPool->ReleaseOwnerNiagaraEffects(GetOwner());
+	}
+}
+
+UPRSharedEffectPoolSubsystem* UPREffectSystemComponent::GetSharedEffectPool() const
+{
+	if(bUseSharedNiagaraPool && GetWorld())
+	{
+		return GetWorld()->GetSubsystem<UPRSharedEffectPoolSubsystem>();
+	}
+
+	return nullptr;
+}
+
+APRNiagaraEffect* UPREffectSystemComponent::AcquireSharedNiagaraEffect(UNiagaraSystem* SpawnEffect)
+{
+	UPRSharedEffectPoolSubsystem* SharedEffectPool = GetSharedEffectPool();
+	if(!SharedEffectPool || !SpawnEffect)
+	{
+		return nullptr;
+	}
+
+	// 공유 Pool이 생성되지 않은 NiagaraSystem이면 데이터 테이블의 설정 값이나 동적 설정 값으로 공유 Pool을 생성합니다.
+	if(!SharedEffectPool->IsCreateNiagaraPool(SpawnEffect))
+	{
+		FPRNiagaraEffectPoolSettings NiagaraPoolSettings = GetNiagaraEffectPoolSettingsFromDataTable(SpawnEffect);
+		if(!NiagaraPoolSettings.NiagaraSystem)
+		{
+			NiagaraPoolSettings = FPRNiagaraEffectPoolSettings(SpawnEffect, DynamicPoolSize, DynamicLifespan);
+		}
+		
+		SharedEffectPool->RegisterNiagaraPool(NiagaraPoolSettings, bPrimeNiagaraPoolOnWarmUp);
+	}
+
+	APRNiagaraEffect* SharedNiagaraEffect = SharedEffectPool->AcquireNiagaraEffect(SpawnEffect, GetOwner(), SharedNiagaraPoolOwnerQuota);
+	if(!IsValid(SharedNiagaraEffect))
+	{
+		NiagaraPoolStats.PoolMisses++;
+		CSV_CUSTOM_STAT(PREffectSystem, NiagaraPoolMisses, 1, ECsvCustomStatOp::Accumulate);
+
+		return nullptr;
+	}
+
+	NiagaraPoolStats.PoolHits++;
+	
+	// 반복 재생 목록을 정리할 수 있도록 비활성화될 때 알림을 받습니다.
+	if(!SharedNiagaraEffect->OnEffectDeactivateDelegate.IsBoundToObject(this))
+	{
+		SharedNiagaraEffect->OnEffectDeactivateDelegate.AddUObject(this, &UPREffectSystemComponent::OnSharedNiagaraEffectDeactivate);
+	}
+	
+	return SharedNiagaraEffect;
+}
+
+void UPREffectSystemComponent::OnSharedNiagaraEffectDeactivate(APREffect* TargetEffect)
+{
+	APRNiagaraEffect* TargetNiagaraEffect = Cast<APRNiagaraEffect>(TargetEffect);
+	if(IsValid(TargetNiagaraEffect))
+	{
+		UnregisterLoopingNiagaraEffect(TargetNiagaraEffect);
+
+		// 공유 Pool에 반환된 NiagaraEffect는 다른 Owner가 사용하므로 바인딩을 해제합니다.
+		TargetNiagaraEffect->OnEffectDeactivateDelegate.RemoveAll(this);
+	}
+}
+
 void UPREffectSystemComponent::OnDynamicNiagaraEffectDeactivate(APREffect* TargetEffect)
 {
+	CSV_SCOPED_TIMING_STAT(PREffectSystem, DeactivateNiagaraEffect);
+	TRACE_CPUPROFILER_EVENT_SCOPE(UPREffectSystemComponent::DeactivateNiagaraEffect);
+	
 	APRNiagaraEffect* TargetNiagaraEffect = Cast<APRNiagaraEffect>(TargetEffect);
 	// 유효하지 않는 NiagaraEffect이거나 풀링 가능한 NiagaraEffect가 아니거나 NiagaraComponent가 없으면 반환합니다.
 	if(!IsValid(TargetNiagaraEffect)
@@ -516,6 +928,169 @@ void UPREffectSystemComponent::OnDynamicNiagaraEffectDestroy(APRNiagaraEffect* T
 	}
 		
 	TargetNiagaraEffect->ConditionalBeginDestroy();
+	NiagaraPoolStats.DynamicDestructions++;
+	CSV_CUSTOM_STAT(PREffectSystem, NiagaraDynamicDestructions, 1, ECsvCustomStatOp::Accumulate);
+}
+
+FPREffectActivationStats UPREffectSystemComponent::GetNiagaraActivationStats(UNiagaraSystem* NiagaraSystem) const
+{
+	const FPREffectActivationStats* ActivationStats = NiagaraActivationStats.Find(NiagaraSystem);
+	if(ActivationStats)
+	{
+		return *ActivationStats;
+	}
+
+	return FPREffectActivationStats();
+}
+
+void UPREffectSystemComponent::RecordNiagaraActivation(const APRNiagaraEffect* NiagaraEffect, float ActivationTime)
+{
+	NiagaraPoolStats.AddActivation(ActivationTime);
+
+	// 첫 번째 활성화의 비용은 NiagaraSystem마다 다르므로 NiagaraSystem별로 기록합니다.
+	UNiagaraSystem* NiagaraSystem = NiagaraEffect->GetNiagaraEffectAsset();
+	if(NiagaraSystem)
+	{
+		NiagaraActivationStats.FindOrAdd(NiagaraSystem).AddActivation(ActivationTime);
+	}
+}
+#pragma endregion 
+
+#pragma region LoopingNiagaraEffect
+FPRLoopingEffectHandle UPREffectSystemComponent::SpawnLoopingNiagaraEffectAtLocation(UNiagaraSystem* SpawnEffect, FVector Location, FRotator Rotation, FVector Scale, float Lifespan, FName LoopingEffectName)
+{
+	if(!HasLoopingNiagaraEffectBudget())
+	{
+		PR_LOG_WARNING("%s exceeded the looping NiagaraEffect budget (%d)", *GetNameSafe(SpawnEffect), MaxLoopingNiagaraEffects);
+		return FPRLoopingEffectHandle();
+	}
+	
+	// 반복 재생되는 이펙트는 나중에 카메라에 보일 수 있으므로 컬링을 허용하지 않습니다.
+	APRNiagaraEffect* LoopingNiagaraEffect = SpawnNiagaraEffectAtLocation(SpawnEffect, Location, Rotation, Scale, true, true);
+	if(IsValid(LoopingNiagaraEffect))
+	{
+		return RegisterLoopingNiagaraEffect(LoopingNiagaraEffect, Lifespan, LoopingEffectName);
+	}
+
+	return FPRLoopingEffectHandle();
+}
+
+FPRLoopingEffectHandle UPREffectSystemComponent::SpawnLoopingNiagaraEffectAttached(UNiagaraSystem* SpawnEffect, USceneComponent* Parent, FName AttachSocketName, FVector Location, FRotator Rotation, FVector Scale, float Lifespan, FName LoopingEffectName)
+{
+	if(!HasLoopingNiagaraEffectBudget())
+	{
+		PR_LOG_WARNING("%s exceeded the looping NiagaraEffect budget (%d)", *GetNameSafe(SpawnEffect), MaxLoopingNiagaraEffects);
+		return FPRLoopingEffectHandle();
+	}
+	
+	// 반복 재생되는 이펙트는 나중에 카메라에 보일 수 있으므로 컬링을 허용하지 않습니다.
+	APRNiagaraEffect* LoopingNiagaraEffect = SpawnNiagaraEffectAttached(SpawnEffect, Parent, AttachSocketName, Location, Rotation, Scale, true, true);
+	if(IsValid(LoopingNiagaraEffect))
+	{
+		return RegisterLoopingNiagaraEffect(LoopingNiagaraEffect, Lifespan, LoopingEffectName);
+	}
+
+	return FPRLoopingEffectHandle();
+}
+
+bool UPREffectSystemComponent::StopLoopingNiagaraEffect(FPRLoopingEffectHandle& LoopingEffectHandle)
+{
+	APRNiagaraEffect* LoopingNiagaraEffect = GetLoopingNiagaraEffect(LoopingEffectHandle);
+	LoopingEffectHandle.Invalidate();
+	if(IsValid(LoopingNiagaraEffect))
+	{
+		// 비활성화하면 OnNiagaraEffectDeactivate 함수에서 반복 재생 목록에서 제거됩니다.
+		DeactivateObject(LoopingNiagaraEffect);
+
+		return true;
+	}
+
+	return false;
+}
+
+int32 UPREffectSystemComponent::StopLoopingNiagaraEffectsByName(FName LoopingEffectName)
+{
+	// 비활성화하는 동안 목록이 변경되므로 정지할 NiagaraEffect를 먼저 모읍니다.
+	TArray<APRNiagaraEffect*> EffectsToStop;
+	for(const auto& LoopingEntry : LoopingNiagaraEffects)
+	{
+		if(LoopingEntry.Value.LoopingEffectName == LoopingEffectName && LoopingEntry.Value.NiagaraEffect.IsValid())
+		{
+			EffectsToStop.Emplace(LoopingEntry.Value.NiagaraEffect.Get());
+		}
+	}
+
+	for(APRNiagaraEffect* EffectToStop : EffectsToStop)
+	{
+		DeactivateObject(EffectToStop);
+	}
+
+	return EffectsToStop.Num();
+}
+
+void UPREffectSystemComponent::StopAllLoopingNiagaraEffects()
+{
+	// 비활성화하는 동안 목록이 변경되므로 정지할 NiagaraEffect를 먼저 모읍니다.
+	TArray<TWeakObjectPtr<APRNiagaraEffect>> EffectsToStop;
+	LoopingNiagaraEffectHandleIDs.GenerateKeyArray(EffectsToStop);
+	for(const TWeakObjectPtr<APRNiagaraEffect>& EffectToStop : EffectsToStop)
+	{
+		if(EffectToStop.IsValid())
+		{
+			DeactivateObject(EffectToStop.Get());
+		}
+	}
+
+	LoopingNiagaraEffects.Empty();
+	LoopingNiagaraEffectHandleIDs.Empty();
+}
+
+APRNiagaraEffect* UPREffectSystemComponent::GetLoopingNiagaraEffect(const FPRLoopingEffectHandle& LoopingEffectHandle) const
+{
+	const FPRLoopingNiagaraEffect* LoopingEntry = LoopingNiagaraEffects.Find(LoopingEffectHandle.HandleID);
+	if(LoopingEntry)
+	{
+		return LoopingEntry->NiagaraEffect.Get();
+	}
+
+	return nullptr;
+}
+
+bool UPREffectSystemComponent::IsLoopingNiagaraEffectActive(const FPRLoopingEffectHandle& LoopingEffectHandle) const
+{
+	return IsActivateNiagaraEffect(GetLoopingNiagaraEffect(LoopingEffectHandle));
+}
+
+FPRLoopingEffectHandle UPREffectSystemComponent::RegisterLoopingNiagaraEffect(APRNiagaraEffect* NiagaraEffect, float Lifespan, FName LoopingEffectName)
+{
+	// Lifespan이 0 이상일 경우 이번 활성화에 한해서 Pool의 수명 대신 Lifespan을 적용합니다.
+	if(Lifespan >= 0.0f)
+	{
+		NiagaraEffect->SetActivationLifespan(Lifespan);
+	}
+
+	// 같은 NiagaraEffect가 이전 Handle로 등록되어 있다면 제거합니다.
+	UnregisterLoopingNiagaraEffect(NiagaraEffect);
+	
+	const int32 NewHandleID = NextLoopingEffectHandleID++;
+	LoopingNiagaraEffects.Emplace(NewHandleID, FPRLoopingNiagaraEffect(NiagaraEffect, LoopingEffectName));
+	LoopingNiagaraEffectHandleIDs.Emplace(NiagaraEffect, NewHandleID);
+
+	return FPRLoopingEffectHandle(NewHandleID);
+}
+
+void UPREffectSystemComponent::UnregisterLoopingNiagaraEffect(APRNiagaraEffect* NiagaraEffect)
+{
+	int32 HandleID = INDEX_NONE;
+	if(LoopingNiagaraEffectHandleIDs.RemoveAndCopyValue(NiagaraEffect, HandleID))
+	{
+		LoopingNiagaraEffects.Remove(HandleID);
+	}
+}
+
+bool UPREffectSystemComponent::HasLoopingNiagaraEffectBudget() const
+{
+	return MaxLoopingNiagaraEffects <= 0 || LoopingNiagaraEffects.Num() < MaxLoopingNiagaraEffects;
 }
 #pragma endregion 
 
@@ -547,32 +1122,53 @@ void UPREffectSystemComponent::ClearAllParticlePool()
 	ClearParticlePool(ParticlePool);
 }
 
-APRParticleEffect* UPREffectSystemComponent::SpawnParticleEffectAtLocation(UParticleSystem* SpawnEffect, FVector Location, FRotator Rotation, FVector Scale, bool bEffectAutoActivate, bool bReset)
+APRParticleEffect* UPREffectSystemComponent::SpawnParticleEffectAtLocation(UParticleSystem* SpawnEffect, FVector Location, FRotator Rotation, FVector Scale, bool bEffectAutoActivate, bool bReset, bool bAllowSpawnCulling)
 {
-	APRParticleEffect* ActivateableParticleEffect = InitializeParticleEffect(SpawnEffect);
-	if(IsValid(ActivateableParticleEffect))
+	CSV_SCOPED_TIMING_STAT(PREffectSystem, SpawnParticleEffect);
+	TRACE_CPUPROFILER_EVENT_SCOPE(UPREffectSystemComponent::SpawnParticleEffect);
+	
+	ParticlePoolStats.SpawnRequests++;
+	CSV_CUSTOM_STAT(PREffectSystem, ParticleSpawns, 1, ECsvCustomStatOp::Accumulate);
+	if(CullEffectSpawn(Location, bAllowSpawnCulling, ParticlePoolStats))
 	{
 		return nullptr;
 	}
 	
-	// ParticleEffect를 활성화하고 Spawn할 위치와 회전값, 크기, 자동실행 여부를 적용합니다.
-	ActivateableParticleEffect->SpawnEffectAtLocation(Location, Rotation, Scale, bEffectAutoActivate, bReset);
+	APRParticleEffect* ActivateableParticleEffect = InitializeParticleEffect(SpawnEffect);
+	if(IsValid(ActivateableParticleEffect))
+	{
+		// ParticleEffect를 활성화하고 Spawn할 위치와 회전값, 크기, 자동실행 여부를 적용합니다.
+		ActivateableParticleEffect->SpawnEffectAtLocation(Location, Rotation, Scale, bEffectAutoActivate, bReset);
 	
-	return ActivateableParticleEffect;
+		return ActivateableParticleEffect;
+	}
+
+	return nullptr;
 }
 
-APRParticleEffect* UPREffectSystemComponent::SpawnParticleEffectAttached(UParticleSystem* SpawnEffect,	USceneComponent* Parent, FName AttachSocketName, FVector Location, FRotator Rotation, FVector Scale, bool bEffectAutoActivate, bool bReset)
+APRParticleEffect* UPREffectSystemComponent::SpawnParticleEffectAttached(UParticleSystem* SpawnEffect,	USceneComponent* Parent, FName AttachSocketName, FVector Location, FRotator Rotation, FVector Scale, bool bEffectAutoActivate, bool bReset, bool bAllowSpawnCulling)
 {
+	CSV_SCOPED_TIMING_STAT(PREffectSystem, SpawnParticleEffect);
+	TRACE_CPUPROFILER_EVENT_SCOPE(UPREffectSystemComponent::SpawnParticleEffect);
+	
+	ParticlePoolStats.SpawnRequests++;
+	CSV_CUSTOM_STAT(PREffectSystem, ParticleSpawns, 1, ECsvCustomStatOp::Accumulate);
+	const FVector SpawnLocation = IsValid(Parent) ? FPRSocketTransformCache::GetSocketLocation(Parent, AttachSocketName) + Location : Location;
+	if(CullEffectSpawn(SpawnLocation, bAllowSpawnCulling, ParticlePoolStats))
+	{
+		return nullptr;
+	}
+	
 	APRParticleEffect* ActivateableParticleEffect = InitializeParticleEffect(SpawnEffect);
 	if(IsValid(ActivateableParticleEffect))
 	{
-		return nullptr;
+		// ParticleEffect를 활성화하고 Spawn하여 부착할 Component와 위치, 회전값, 크기, 자동실행 여부를 적용합니다.
+		ActivateableParticleEffect->SpawnEffectAttached(Parent, AttachSocketName, Location, Rotation, Scale, EAttachLocation::KeepWorldPosition, bEffectAutoActivate, bReset);
+	
+		return ActivateableParticleEffect;
 	}
 
-	// ParticleEffect를 활성화하고 Spawn하여 부착할 Component와 위치, 회전값, 크기, 자동실행 여부를 적용합니다.
-	ActivateableParticleEffect->SpawnEffectAttached(Parent, AttachSocketName, Location, Rotation, Scale, EAttachLocation::KeepWorldPosition, bEffectAutoActivate, bReset);
-	
-	return ActivateableParticleEffect;
+	return nullptr;
 }
 
 APRParticleEffect* UPREffectSystemComponent::GetActivateableParticleEffect(UParticleSystem* ParticleSystem)
@@ -615,8 +1211,14 @@ APRParticleEffect* UPREffectSystemComponent::GetActivateableParticleEffect(UPart
 	// PoolEntry의 모든 ParticleEffect가 활성화되었을 경우 새로운 ParticleEffect를 생성합니다.
 	if(!ActivateableParticleEffect)
 	{
+		ParticlePoolStats.PoolMisses++;
+		CSV_CUSTOM_STAT(PREffectSystem, ParticlePoolMisses, 1, ECsvCustomStatOp::Accumulate);
 		ActivateableParticleEffect = SpawnDynamicParticleEffectInWorld(ParticleSystem);
 	}
+	else
+	{
+		ParticlePoolStats.PoolHits++;
+	}
 	
 	// 동적으로 생성된 ParticleEffect일 경우 DynamicEffectDestroyTimer를 정지합니다.
 	if(IsDynamicParticleEffect(ActivateableParticleEffect))
@@ -739,6 +1341,7 @@ void UPREffectSystemComponent::CreateActivateParticleIndexList(UParticleSystem*
 	if(ParticleSystem)
 	{
 		ActivateParticleIndexList.List.Emplace(ParticleSystem);
+		CacheActiveEffectCsvStatName(ParticleSystem, TEXT("ActiveParticle"));
 	}
 }
 
@@ -782,7 +1385,7 @@ APRParticleEffect* UPREffectSystemComponent::SpawnParticleEffectInWorld(UParticl
 	ParticleEffect->InitializeParticleEffect(ParticleSystem, GetPROwner(), PoolIndex, Lifespan);
 
 	// ParticleEffect의 OnEffectDeactivateDelegate 이벤트에 대한 콜백 함수를 바인딩합니다.
-	ParticleEffect->OnEffectDeactivateDelegate.AddDynamic(this, &UPREffectSystemComponent::OnParticleEffectDeactivate);
+	ParticleEffect->OnEffectDeactivateDelegate.AddUObject(this, &UPREffectSystemComponent::OnParticleEffectDeactivate);
 
 	return ParticleEffect;
 }
@@ -826,6 +1429,9 @@ APRParticleEffect* UPREffectSystemComponent::SpawnDynamicParticleEffectInWorld(U
 	const FPRParticleEffectPoolSettings ParticleEffectSettings = GetParticleEffectPoolSettingsFromDataTable(ParticleSystem);
 	if(ParticleEffectSettings != FPRParticleEffectPoolSettings())
 	{
+		// 데이터 테이블로 크기를 지정한 Pool이 부족한 경우이므로 PoolSize를 조정할 수 있도록 경고를 출력합니다.
+		PR_LOG_WARNING("%s pool (size %d) is exhausted, spawning a dynamic effect", *GetNameSafe(ParticleSystem), ParticleEffectSettings.PoolSize);
+		
 		// 데이터 테이블에 ParticleEffect의 설정 값을 가지고 있을 경우 설정 값의 Lifespan을 적용합니다.
 		DynamicParticleEffect = SpawnParticleEffectInWorld(ParticleSystem, NewIndex, ParticleEffectSettings.EffectLifespan);
 	}
@@ -836,7 +1442,7 @@ APRParticleEffect* UPREffectSystemComponent::SpawnDynamicParticleEffectInWorld(U
 	}
 		
 	// OnDynamicParticleEffectDeactivate 함수를 바인딩합니다.
-	DynamicParticleEffect->OnEffectDeactivateDelegate.AddDynamic(this, &UPREffectSystemComponent::OnDynamicParticleEffectDeactivate);
+	DynamicParticleEffect->OnEffectDeactivateDelegate.AddUObject(this, &UPREffectSystemComponent::OnDynamicParticleEffectDeactivate);
 
 	// ParticlePool에서 해당 ParticleSystem의 Pool을 얻습니다.
 	FPRParticleEffectPool* PoolEntry = ParticlePool.Pool.Find(ParticleSystem);
@@ -850,6 +1456,8 @@ APRParticleEffect* UPREffectSystemComponent::SpawnDynamicParticleEffectInWorld(U
 
 	// 새로 생성한 ParticleEffect를 PoolEntry에 추가합니다.
 	PoolEntry->PooledEffects.Emplace(DynamicParticleEffect);
+	ParticlePoolStats.DynamicCreations++;
+	CSV_CUSTOM_STAT(PREffectSystem, ParticleDynamicCreations, 1, ECsvCustomStatOp::Accumulate);
 
 	return DynamicParticleEffect;
 }
@@ -910,6 +1518,9 @@ FPRParticleEffectPoolSettings UPREffectSystemComponent::GetParticleEffectPoolSet
 
 void UPREffectSystemComponent::OnParticleEffectDeactivate(APREffect* TargetEffect)
 {
+	CSV_SCOPED_TIMING_STAT(PREffectSystem, DeactivateParticleEffect);
+	TRACE_CPUPROFILER_EVENT_SCOPE(UPREffectSystemComponent::DeactivateParticleEffect);
+	
 	APRParticleEffect* TargetParticleEffect = Cast<APRParticleEffect>(TargetEffect);
 	// 유효하지 않는 ParticleEffect이거나 풀링 가능한 ParticleEffect가 아니거나 ParticleComponent가 없으면 반환합니다.
 	if(!IsValid(TargetParticleEffect)
@@ -933,6 +1544,9 @@ void UPREffectSystemComponent::OnParticleEffectDeactivate(APREffect* TargetEffec
 
 void UPREffectSystemComponent::OnDynamicParticleEffectDeactivate(APREffect* TargetEffect)
 {
+	CSV_SCOPED_TIMING_STAT(PREffectSystem, DeactivateParticleEffect);
+	TRACE_CPUPROFILER_EVENT_SCOPE(UPREffectSystemComponent::DeactivateParticleEffect);
+	
 	APRParticleEffect* TargetParticleEffect = Cast<APRParticleEffect>(TargetEffect);
 	// 유효하지 않는 ParticleEffect이거나 풀링 가능한 ParticleEffect가 아니거나 ParticleComponent가 없으면 반환합니다.
 	if(!IsValid(TargetParticleEffect)
@@ -1000,5 +1614,7 @@ void UPREffectSystemComponent::OnDynamicParticleEffectDestroy(APRParticleEffect*
 	}
 		
 	TargetParticleEffect->ConditionalBeginDestroy();
+	ParticlePoolStats.DynamicDestructions++;
+	CSV_CUSTOM_STAT(PREffectSystem, ParticleDynamicDestructions, 1, ECsvCustomStatOp::Accumulate);
 }
 #pragma endregion 
@@ -284,7 +284,7 @@ APRPooledObject* UPRObjectPoolSystemComponent::SpawnDynamicObjectInWorld(TSubcla
 	DynamicObject = SpawnAndInitializeObject(PooledObjectClass, NewIndex);
 		
 	// OnDynamicObjectDeactivate 함수를 바인딩합니다.
-	DynamicObject->OnPooledObjectDeactivateDelegate.AddDynamic(this, &UPRObjectPoolSystemComponent::OnDynamicObjectDeactivate);
+	DynamicObject->OnPooledObjectDeactivateDelegate.AddUObject(this, &UPRObjectPoolSystemComponent::OnDynamicObjectDeactivate);
 
 	// ObjectPool에서 해당 Object의 Pool을 얻습니다.
 	FPRPool* PoolEntry = ObjectPool.Pool.Find(PooledObjectClass);
@@ -309,7 +309,7 @@ APRPooledObject* UPRObjectPoolSystemComponent::SpawnAndInitializeObject(TSubclas
 	{
 		// 생성한 오브젝트를 초기화하고 OnPooledObjectDeactivate 함수를 바인딩합니다.
 		SpawnObject->InitializeObject(GetOwner(), Index);
-		SpawnObject->OnPooledObjectDeactivateDelegate.AddDynamic(this, &UPRObjectPoolSystemComponent::OnPooledObjectDeactivate);
+		SpawnObject->OnPooledObjectDeactivateDelegate.AddUObject(this, &UPRObjectPoolSystemComponent::OnPooledObjectDeactivate);
 	}
 	
 	return SpawnObject;
@@ -2,7 +2,9 @@
 
 
 #include "Effects/PREffect.h"
+#include "Common/PRSocketTransformCache.h"
 #include "Particles/ParticleSystemComponent.h"
+#include "Interfaces/PRInterfaceDispatch.h"
 
 APREffect::APREffect()
 {
@@ -12,6 +14,7 @@ APREffect::APREffect()
 	EffectLifespan = 0.0f;
 	EffectOwner = nullptr;
 	PoolIndex = INDEX_NONE;
+	EffectGeneration = 0;
 }
 
 void APREffect::BeginPlay()
@@ -58,7 +61,8 @@ void APREffect::SpawnEffectAttached(USceneComponent* Parent, FName AttachSocketN
 	AttachToComponent(Parent, AttachmentTransformRules, AttachSocketName);
 	if (LocationType == EAttachLocation::KeepWorldPosition)
 	{
-		SetActorLocationAndRotation(Parent->GetSocketLocation(AttachSocketName) + Location, Parent->GetSocketRotation(AttachSocketName) + Rotation);
+		const FTransform SocketTransform = FPRSocketTransformCache::GetSocketTransform(Parent, AttachSocketName);
+		SetActorLocationAndRotation(SocketTransform.GetLocation() + Location, SocketTransform.Rotator() + Rotation);
 	}
 	else
 	{
@@ -89,6 +93,9 @@ void APREffect::DeactivateEffect()
 	// 이펙트에 설정된 모든 타이머를 초기화합니다.
 	GetWorldTimerManager().ClearAllTimersForObject(this);
 
+	// Pool로 반환되므로 이전에 Spawn한 곳에서 더 이상 제어하지 않도록 Generation을 증가시킵니다.
+	EffectGeneration++;
+
 	// 비활성화 델리게이트를 호출합니다.
 	OnEffectDeactivateDelegate.Broadcast(this);
 }
@@ -135,9 +142,24 @@ void APREffect::SetEffectLifespan(float NewLifespan)
 	}
 }
 
+void APREffect::SetActivationLifespan(float NewLifespan)
+{
+	if(bActivate)
+	{
+		if(NewLifespan > 0.0f)
+		{
+			GetWorldTimerManager().SetTimer(EffectLifespanTimerHandle, this, &APREffect::OnDeactivate, NewLifespan);
+		}
+		else
+		{
+			GetWorldTimerManager().ClearTimer(EffectLifespanTimerHandle);
+		}
+	}
+}
+
 void APREffect::OnDeactivate()
 {
-	IPRPoolableInterface::Execute_Deactivate(this);
+	FPRPoolableDispatch::Deactivate(this);
 }
 
 float APREffect::GetEffectLifespan() const
@@ -0,0 +1,261 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Effects/PREffectPoolBenchmark.h"
+#include "Components/PREffectSystemComponent.h"
+#include "Engine/DataTable.h"
+#include "NiagaraFunctionLibrary.h"
+#include "NiagaraSystem.h"
+#include "HAL/PlatformMemory.h"
+#include "Misc/EngineVersion.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+APREffectPoolBenchmark::APREffectPoolBenchmark()
+{
+	PrimaryActorTick.bCanEverTick = true;
+	PrimaryActorTick.bStartWithTickEnabled = false;
+
+	BenchmarkNiagaraSystem = nullptr;
+	BenchmarkEffectSystem = CreateDefaultSubobject<UPREffectSystemComponent>(TEXT("BenchmarkEffectSystem"));
+	CustomPoolSize = 640;
+	CustomPoolEffectLifespan = 0.5f;
+	BenchmarkModes = { EPREffectPoolBenchmarkMode::EffectPoolBenchmarkMode_CustomPool,
+						EPREffectPoolBenchmarkMode::EffectPoolBenchmarkMode_AutoRelease,
+						EPREffectPoolBenchmarkMode::EffectPoolBenchmarkMode_NoPooling };
+	EffectsPerFrame = 20;
+	MeasureFrames = 600;
+	CooldownFrames = 120;
+	SpawnRadius = 1000.0f;
+	bStartOnBeginPlay = true;
+	bQuitWhenFinished = false;
+	BenchmarkCsvFilePath = FString();
+	CurrentModeIndex = INDEX_NONE;
+	RemainingCooldownFrames = 0;
+	ModeStartMemoryMB = 0.0;
+	GarbageCollectStartTime = 0.0;
+}
+
+void APREffectPoolBenchmark::BeginPlay()
+{
+	Super::BeginPlay();
+
+	PreGarbageCollectHandle = FCoreUObjectDelegates::GetPreGarbageCollectDelegate().AddUObject(this, &APREffectPoolBenchmark::OnPreGarbageCollect);
+	PostGarbageCollectHandle = FCoreUObjectDelegates::GetPostGarbageCollect().AddUObject(this, &APREffectPoolBenchmark::OnPostGarbageCollect);
+
+	if(bStartOnBeginPlay)
+	{
+		StartBenchmark();
+	}
+}
+
+void APREffectPoolBenchmark::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	FCoreUObjectDelegates::GetPreGarbageCollectDelegate().Remove(PreGarbageCollectHandle);
+	FCoreUObjectDelegates::GetPostGarbageCollect().Remove(PostGarbageCollectHandle);
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void APREffectPoolBenchmark::Tick(float DeltaSeconds)
+{
+	Super::Tick(DeltaSeconds);
+
+	if(!BenchmarkModes.IsValidIndex(CurrentModeIndex) || !BenchmarkResults.IsValidIndex(CurrentModeIndex))
+	{
+		return;
+	}
+
+	// 이전 Spawn 방식의 이펙트가 정리될 때까지 기다린 후 측정을 시작합니다.
+	if(RemainingCooldownFrames > 0)
+	{
+		RemainingCooldownFrames--;
+		if(RemainingCooldownFrames == 0)
+		{
+			ModeStartMemoryMB = GetUsedPhysicalMemoryMB();
+		}
+
+		return;
+	}
+
+	FPREffectPoolBenchmarkResult& BenchmarkResult = BenchmarkResults[CurrentModeIndex];
+	const FVector BenchmarkLocation = GetActorLocation();
+	const double FrameStartTime = FPlatformTime::Seconds();
+	for(int32 Index = 0; Index < EffectsPerFrame; Index++)
+	{
+		SpawnBenchmarkEffect(BenchmarkResult.Mode, BenchmarkLocation + FMath::VRand() * FMath::FRandRange(0.0f, SpawnRadius));
+	}
+
+	const double FrameSpawnTime = FPlatformTime::Seconds() - FrameStartTime;
+	BenchmarkResult.Frames++;
+	BenchmarkResult.SpawnedEffects += EffectsPerFrame;
+	BenchmarkResult.TotalSpawnTime += FrameSpawnTime;
+	BenchmarkResult.MaxFrameSpawnTime = FMath::Max(BenchmarkResult.MaxFrameSpawnTime, FrameSpawnTime);
+
+	if(BenchmarkResult.Frames >= MeasureFrames)
+	{
+		EndMode();
+	}
+}
+
+void APREffectPoolBenchmark::StartBenchmark()
+{
+	if(!BenchmarkNiagaraSystem || BenchmarkModes.Num() == 0)
+	{
+		PR_LOG_WARNING("Benchmark requires a NiagaraSystem and at least one mode");
+		return;
+	}
+
+	if(BenchmarkModes.Contains(EPREffectPoolBenchmarkMode::EffectPoolBenchmarkMode_CustomPool))
+	{
+		InitializeCustomPool();
+	}
+
+	BenchmarkResults.Empty(BenchmarkModes.Num());
+	BenchmarkCsvFilePath.Empty();
+	CurrentModeIndex = 0;
+	BeginMode();
+	SetActorTickEnabled(true);
+}
+
+void APREffectPoolBenchmark::InitializeCustomPool()
+{
+	if(!BenchmarkEffectSystem)
+	{
+		return;
+	}
+
+	// 캐릭터의 데이터 테이블에 의존하지 않도록 BenchmarkNiagaraSystem만 가진 설정 값으로 Pool을 생성합니다.
+	UDataTable* NiagaraPoolSettingsDataTable = NewObject<UDataTable>(this);
+	NiagaraPoolSettingsDataTable->RowStruct = FPRNiagaraEffectPoolSettings::StaticStruct();
+	NiagaraPoolSettingsDataTable->AddRow(BenchmarkNiagaraSystem->GetFName(), FPRNiagaraEffectPoolSettings(BenchmarkNiagaraSystem, CustomPoolSize, CustomPoolEffectLifespan));
+
+	// 카메라와 관계없이 같은 조건에서 비교하도록 컬링을 사용하지 않습니다.
+	BenchmarkEffectSystem->SetUseSpawnCulling(false);
+	BenchmarkEffectSystem->SetNiagaraPoolSettingsDataTable(NiagaraPoolSettingsDataTable);
+	BenchmarkEffectSystem->InitializeNiagaraPool();
+	BenchmarkEffectSystem->ResetPoolStats();
+}
+
+void APREffectPoolBenchmark::BeginMode()
+{
+	BenchmarkResults.Emplace(FPREffectPoolBenchmarkResult(BenchmarkModes[CurrentModeIndex]));
+
+	// 이전 Spawn 방식에서 생성된 오브젝트를 정리한 후 대기합니다.
+	GEngine->ForceGarbageCollection(true);
+	RemainingCooldownFrames = FMath::Max(CooldownFrames, 1);
+}
+
+void APREffectPoolBenchmark::EndMode()
+{
+	FPREffectPoolBenchmarkResult& BenchmarkResult = BenchmarkResults[CurrentModeIndex];
+	BenchmarkResult.MemoryDeltaMB = GetUsedPhysicalMemoryMB() - ModeStartMemoryMB;
+
+	PR_LOG(Log, "%s: %d effects, %.3f ms/frame average, %.3f ms/frame max, %.2f MB, %d GC (%.3f ms)",
+		*UEnum::GetDisplayValueAsText(BenchmarkResult.Mode).ToString(),
+		BenchmarkResult.SpawnedEffects,
+		BenchmarkResult.TotalSpawnTime * 1000.0 / FMath::Max(BenchmarkResult.Frames, 1),
+		BenchmarkResult.MaxFrameSpawnTime * 1000.0,
+		BenchmarkResult.MemoryDeltaMB,
+		BenchmarkResult.GarbageCollections,
+		BenchmarkResult.GarbageCollectionTime * 1000.0);
+
+	CurrentModeIndex++;
+	if(BenchmarkModes.IsValidIndex(CurrentModeIndex))
+	{
+		BeginMode();
+	}
+	else
+	{
+		FinishBenchmark();
+	}
+}
+
+void APREffectPoolBenchmark::FinishBenchmark()
+{
+	SetActorTickEnabled(false);
+	CurrentModeIndex = INDEX_NONE;
+
+	const FString CsvFilePath = FPaths::Combine(FPaths::ProfilingDir(), TEXT("PREffectPoolBenchmark"), FString::Printf(TEXT("PREffectPoolBenchmark_%s.csv"), *FDateTime::Now().ToString()));
+	if(FFileHelper::SaveStringToFile(MakeBenchmarkCsv(), *CsvFilePath))
+	{
+		BenchmarkCsvFilePath = CsvFilePath;
+		PR_LOG(Log, "Benchmark results saved to %s", *CsvFilePath);
+	}
+	else
+	{
+		PR_LOG_ERROR("Failed to save benchmark results to %s", *CsvFilePath);
+	}
+
+	if(bQuitWhenFinished)
+	{
+		UKismetSystemLibrary::QuitGame(this, nullptr, EQuitPreference::Quit, false);
+	}
+}
+
+void APREffectPoolBenchmark::SpawnBenchmarkEffect(EPREffectPoolBenchmarkMode Mode, const FVector& SpawnLocation)
+{
+	switch(Mode)
+	{
+	case EPREffectPoolBenchmarkMode::EffectPoolBenchmarkMode_CustomPool:
+		if(BenchmarkEffectSystem)
+		{
+			BenchmarkEffectSystem->SpawnNiagaraEffectAtLocation(BenchmarkNiagaraSystem, SpawnLocation, FRotator::ZeroRotator, FVector::OneVector, true, true);
+		}
+		break;
+	case EPREffectPoolBenchmarkMode::EffectPoolBenchmarkMode_AutoRelease:
+		UNiagaraFunctionLibrary::SpawnSystemAtLocation(this, BenchmarkNiagaraSystem, SpawnLocation, FRotator::ZeroRotator, FVector::OneVector, true, true, ENCPoolMethod::AutoRelease, false);
+		break;
+	case EPREffectPoolBenchmarkMode::EffectPoolBenchmarkMode_NoPooling:
+		UNiagaraFunctionLibrary::SpawnSystemAtLocation(this, BenchmarkNiagaraSystem, SpawnLocation, FRotator::ZeroRotator, FVector::OneVector, true, true, ENCPoolMethod::None, false);
+		break;
+	default:
+		break;
+	}
+}
+
+FString APREffectPoolBenchmark::MakeBenchmarkCsv() const
+{
+	FString BenchmarkCsv = TEXT("EngineVersion,NiagaraSystem,Mode,EffectsPerFrame,Frames,SpawnedEffects,TotalSpawnMs,AverageFrameSpawnMs,MaxFrameSpawnMs,AverageEffectSpawnUs,MemoryDeltaMB,GarbageCollections,GarbageCollectionMs\n");
+	const FString EngineVersion = FEngineVersion::Current().ToString();
+	for(const FPREffectPoolBenchmarkResult& BenchmarkResult : BenchmarkResults)
+	{
+		BenchmarkCsv += FString::Printf(TEXT("%s,%s,%s,%d,%d,%d,%.4f,%.4f,%.4f,%.4f,%.2f,%d,%.4f\n"),
+			*EngineVersion,
+			*GetNameSafe(BenchmarkNiagaraSystem),
+			*UEnum::GetDisplayValueAsText(BenchmarkResult.Mode).ToString(),
+			EffectsPerFrame,
+			BenchmarkResult.Frames,
+			BenchmarkResult.SpawnedEffects,
+			BenchmarkResult.TotalSpawnTime * 1000.0,
+			BenchmarkResult.TotalSpawnTime * 1000.0 / FMath::Max(BenchmarkResult.Frames, 1),
+			BenchmarkResult.MaxFrameSpawnTime * 1000.0,
+			BenchmarkResult.TotalSpawnTime * 1000000.0 / FMath::Max(BenchmarkResult.SpawnedEffects, 1),
+			BenchmarkResult.MemoryDeltaMB,
+			BenchmarkResult.GarbageCollections,
+			BenchmarkResult.GarbageCollectionTime * 1000.0);
+	}
+
+	return BenchmarkCsv;
+}
+
+void APREffectPoolBenchmark::OnPreGarbageCollect()
+{
+	GarbageCollectStartTime = FPlatformTime::Seconds();
+}
+
+void APREffectPoolBenchmark::OnPostGarbageCollect()
+{
+	// 측정 중인 Spawn 방식이 있을 때 실행된 가비지 컬렉션만 기록합니다.
+	if(RemainingCooldownFrames == 0 && BenchmarkResults.IsValidIndex(CurrentModeIndex))
+	{
+		FPREffectPoolBenchmarkResult& BenchmarkResult = BenchmarkResults[CurrentModeIndex];
+		BenchmarkResult.GarbageCollections++;
+		BenchmarkResult.GarbageCollectionTime += FPlatformTime::Seconds() - GarbageCollectStartTime;
+	}
+}
+
+double APREffectPoolBenchmark::GetUsedPhysicalMemoryMB()
+{
+	return static_cast<double>(FPlatformMemory::GetStats().UsedPhysical) / (1024.0 * 1024.0);
+}
@@ -42,6 +42,19 @@ void APRNiagaraEffect::DeactivateEffect()
 	}
 }
 
+void APRNiagaraEffect::PrimeNiagaraEffect()
+{
+	if(IsValid(NiagaraEffect) && NiagaraEffect->GetAsset())
+	{
+		// 렌더링되지 않도록 숨긴 상태에서 System Instance를 생성한 후 즉시 비활성화합니다.
+		const bool bWasVisible = NiagaraEffect->IsVisible();
+		NiagaraEffect->SetVisibility(false);
+		NiagaraEffect->Activate(true);
+		NiagaraEffect->DeactivateImmediate();
+		NiagaraEffect->SetVisibility(bWasVisible);
+	}
+}
+
 UFXSystemComponent* APRNiagaraEffect::GetFXSystemComponent() const
 {
 	return NiagaraEffect;	
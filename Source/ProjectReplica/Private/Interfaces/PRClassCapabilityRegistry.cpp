@@ -0,0 +1,169 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Interfaces/PRClassCapabilityRegistry.h"
+#include "Interfaces/PRPoolableInterface.h"
+#include "Interfaces/PRDamageableInterface.h"
+#include "Objects/PRPooledObject.h"
+#include "Effects/PREffect.h"
+#include "Characters/PRAICharacter.h"
+
+FPRClassCapabilityRegistry& FPRClassCapabilityRegistry::Get()
+{
+	static FPRClassCapabilityRegistry Registry;
+	return Registry;
+}
+
+FPRClassCapabilityRegistry::FPRClassCapabilityRegistry()
+{
+	// Registry는 프로세스가 끝날 때까지 유지되므로 델리게이트를 해제하지 않습니다.
+	FCoreUObjectDelegates::ReloadCompleteDelegate.AddRaw(this, &FPRClassCapabilityRegistry::OnReloadComplete);
+#if WITH_EDITOR
+	FCoreUObjectDelegates::OnObjectsReinstanced.AddRaw(this, &FPRClassCapabilityRegistry::OnObjectsReinstanced);
+#endif
+}
+
+FPRClassCapabilities FPRClassCapabilityRegistry::GetCapabilities(const UClass* Class)
+{
+	checkSlow(IsInGameThread());
+
+	if(!Class)
+	{
+		return FPRClassCapabilities();
+	}
+
+	const TObjectKey<UClass> ClassKey(Class);
+	if(ClassKey != LastClass)
+	{
+		const FPRClassCapabilities* ClassCapabilities = Capabilities.Find(ClassKey);
+		LastCapabilities = ClassCapabilities ? *ClassCapabilities : Capabilities.Add(ClassKey, BuildCapabilities(Class));
+		LastClass = ClassKey;
+	}
+
+	return LastCapabilities;
+}
+
+void FPRClassCapabilityRegistry::Invalidate()
+{
+	Capabilities.Empty();
+	LastClass = TObjectKey<UClass>();
+	LastCapabilities = FPRClassCapabilities();
+}
+
+bool FPRClassCapabilityRegistry::IsPoolable(const UObject* Object)
+{
+	return IsValid(Object) && Get().GetCapabilities(Object->GetClass()).IsPoolable();
+}
+
+bool FPRClassCapabilityRegistry::IsPoolableClass(const UClass* Class)
+{
+	return Get().GetCapabilities(Class).IsPoolable();
+}
+
+bool FPRClassCapabilityRegistry::IsDamageable(const UObject* Object)
+{
+	return IsValid(Object) && Get().GetCapabilities(Object->GetClass()).IsDamageable();
+}
+
+bool FPRClassCapabilityRegistry::IsDamageableClass(const UClass* Class)
+{
+	return Get().GetCapabilities(Class).IsDamageable();
+}
+
+EPRPreferredPool FPRClassCapabilityRegistry::GetPreferredPool(const UClass* Class)
+{
+	return Get().GetCapabilities(Class).PreferredPool;
+}
+
+FPRClassCapabilities FPRClassCapabilityRegistry::BuildCapabilities(const UClass* Class)
+{
+	static const FName PoolableFunctionNames[] =
+	{
+		GET_FUNCTION_NAME_CHECKED(IPRPoolableInterface, IsActivate),
+		GET_FUNCTION_NAME_CHECKED(IPRPoolableInterface, Activate),
+		GET_FUNCTION_NAME_CHECKED(IPRPoolableInterface, Deactivate),
+		GET_FUNCTION_NAME_CHECKED(IPRPoolableInterface, GetPoolIndex),
+		GET_FUNCTION_NAME_CHECKED(IPRPoolableInterface, GetLifespan),
+		GET_FUNCTION_NAME_CHECKED(IPRPoolableInterface, SetLifespan)
+	};
+	static_assert(UE_ARRAY_COUNT(PoolableFunctionNames) == static_cast<int32>(EPRPoolableFunction::Count), "PoolableFunctionNames must match EPRPoolableFunction.");
+
+	static const FName DamageableFunctionNames[] =
+	{
+		GET_FUNCTION_NAME_CHECKED(IPRDamageableInterface, GetCurrentHealth),
+		GET_FUNCTION_NAME_CHECKED(IPRDamageableInterface, GetMaxHealth),
+		GET_FUNCTION_NAME_CHECKED(IPRDamageableInterface, Heal),
+		GET_FUNCTION_NAME_CHECKED(IPRDamageableInterface, TakeDamage)
+	};
+	static_assert(UE_ARRAY_COUNT(DamageableFunctionNames) == static_cast<int32>(EPRDamageableFunction::Count), "DamageableFunctionNames must match EPRDamageableFunction.");
+
+	FPRClassCapabilities ClassCapabilities;
+	if(Class->ImplementsInterface(UPRPoolableInterface::StaticClass()))
+	{
+		ClassCapabilities.Flags |= EPRClassCapabilityFlags::Poolable;
+		ClassCapabilities.PoolableNativeMask = BuildNativeMask(Class, UPRPoolableInterface::StaticClass(), PoolableFunctionNames);
+		if(ClassCapabilities.PoolableNativeMask != (1u << static_cast<uint32>(EPRPoolableFunction::Count)) - 1)
+		{
+			ClassCapabilities.Flags |= EPRClassCapabilityFlags::PoolableBlueprintOverride;
+		}
+
+		if(Class->IsChildOf(APREffect::StaticClass()))
+		{
+			ClassCapabilities.PreferredPool = EPRPreferredPool::Effect;
+		}
+		else if(Class->IsChildOf(APRAICharacter::StaticClass()))
+		{
+			ClassCapabilities.PreferredPool = EPRPreferredPool::AICharacter;
+		}
+		else if(Class->IsChildOf(APRPooledObject::StaticClass()))
+		{
+			ClassCapabilities.PreferredPool = EPRPreferredPool::Object;
+		}
+	}
+
+	if(Class->ImplementsInterface(UPRDamageableInterface::StaticClass()))
+	{
+		ClassCapabilities.Flags |= EPRClassCapabilityFlags::Damageable;
+		ClassCapabilities.DamageableNativeMask = BuildNativeMask(Class, UPRDamageableInterface::StaticClass(), DamageableFunctionNames);
+		if(ClassCapabilities.DamageableNativeMask != (1u << static_cast<uint32>(EPRDamageableFunction::Count)) - 1)
+		{
+			ClassCapabilities.Flags |= EPRClassCapabilityFlags::DamageableBlueprintOverride;
+		}
+	}
+
+	return ClassCapabilities;
+}
+
+uint32 FPRClassCapabilityRegistry::BuildNativeMask(const UClass* Class, UClass* InterfaceClass, TConstArrayView<FName> FunctionNames)
+{
+	// 블루프린트에서만 Interface를 구현한 클래스는 호출할 C++ 구현이 없습니다.
+	if(!Class->GetDefaultObject()->GetNativeInterfaceAddress(InterfaceClass))
+	{
+		return 0;
+	}
+
+	// 블루프린트에서 오버라이드한 함수는 블루프린트 클래스가 소유한 UFunction으로 검색됩니다.
+	uint32 NativeMask = 0;
+	for(int32 Index = 0; Index < FunctionNames.Num(); Index++)
+	{
+		const UFunction* Function = Class->FindFunctionByName(FunctionNames[Index]);
+		if(Function && Function->GetOwnerClass()->HasAnyClassFlags(CLASS_Native))
+		{
+			NativeMask |= 1u << Index;
+		}
+	}
+
+	return NativeMask;
+}
+
+void FPRClassCapabilityRegistry::OnReloadComplete(EReloadCompleteReason Reason)
+{
+	Invalidate();
+}
+
+#if WITH_EDITOR
+void FPRClassCapabilityRegistry::OnObjectsReinstanced(const TMap<UObject*, UObject*>& OldToNewInstanceMap)
+{
+	Invalidate();
+}
+#endif
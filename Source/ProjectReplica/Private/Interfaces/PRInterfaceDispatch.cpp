@@ -0,0 +1,203 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Interfaces/PRInterfaceDispatch.h"
+#include "Objects/PRPooledObject.h"
+#include "Objects/PRDamageableObject_HasHealthPoint.h"
+#include "Subsystems/PRCombatTelemetrySubsystem.h"
+#include "Subsystems/PRDamageStreamSubsystem.h"
+#include "HAL/IConsoleManager.h"
+
+/** Interface 함수의 호출 성능을 비교하는 콘솔 명령어입니다. */
+static FAutoConsoleCommand InterfaceDispatchBenchmarkCommand(
+	TEXT("PR.Benchmark.InterfaceDispatch"),
+	TEXT("Measures native dispatch and Execute_ calls per second. Usage: PR.Benchmark.InterfaceDispatch [Calls] [PoolableClassPath] [DamageableClassPath]"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		UClass* PoolableClass = Args.Num() > 1 ? LoadClass<UObject>(nullptr, *Args[1]) : nullptr;
+		UClass* DamageableClass = Args.Num() > 2 ? LoadClass<UObject>(nullptr, *Args[2]) : nullptr;
+		UPRInterfaceDispatchBenchmark::RunDispatchBenchmark(Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 1000000, PoolableClass, DamageableClass);
+	}));
+
+#pragma region PoolableDispatch
+bool FPRPoolableDispatch::IsActivate(const UObject* Object)
+{
+	const IPRPoolableInterface* Interface = GetNativeInterface(Object, EPRPoolableFunction::IsActivate);
+	return Interface ? Interface->IsActivate_Implementation() : IPRPoolableInterface::Execute_IsActivate(Object);
+}
+
+void FPRPoolableDispatch::Activate(UObject* Object)
+{
+	IPRPoolableInterface* Interface = GetNativeInterface(Object, EPRPoolableFunction::Activate);
+	if(Interface)
+	{
+		Interface->Activate_Implementation();
+		return;
+	}
+
+	IPRPoolableInterface::Execute_Activate(Object);
+}
+
+void FPRPoolableDispatch::Deactivate(UObject* Object)
+{
+	IPRPoolableInterface* Interface = GetNativeInterface(Object, EPRPoolableFunction::Deactivate);
+	if(Interface)
+	{
+		Interface->Deactivate_Implementation();
+		return;
+	}
+
+	IPRPoolableInterface::Execute_Deactivate(Object);
+}
+
+int32 FPRPoolableDispatch::GetPoolIndex(const UObject* Object)
+{
+	const IPRPoolableInterface* Interface = GetNativeInterface(Object, EPRPoolableFunction::GetPoolIndex);
+	return Interface ? Interface->GetPoolIndex_Implementation() : IPRPoolableInterface::Execute_GetPoolIndex(Object);
+}
+
+float FPRPoolableDispatch::GetLifespan(const UObject* Object)
+{
+	const IPRPoolableInterface* Interface = GetNativeInterface(Object, EPRPoolableFunction::GetLifespan);
+	return Interface ? Interface->GetLifespan_Implementation() : IPRPoolableInterface::Execute_GetLifespan(Object);
+}
+
+void FPRPoolableDispatch::SetLifespan(UObject* Object, float NewLifespan)
+{
+	IPRPoolableInterface* Interface = GetNativeInterface(Object, EPRPoolableFunction::SetLifespan);
+	if(Interface)
+	{
+		Interface->SetLifespan_Implementation(NewLifespan);
+		return;
+	}
+
+	IPRPoolableInterface::Execute_SetLifespan(Object, NewLifespan);
+}
+
+IPRPoolableInterface* FPRPoolableDispatch::GetNativeInterface(const UObject* Object, EPRPoolableFunction Function)
+{
+	if(!Object || !FPRClassCapabilityRegistry::Get().GetCapabilities(Object->GetClass()).IsNative(Function))
+	{
+		return nullptr;
+	}
+
+	return Cast<IPRPoolableInterface>(const_cast<UObject*>(Object));
+}
+#pragma endregion
+
+#pragma region DamageableDispatch
+float FPRDamageableDispatch::GetCurrentHealth(UObject* Object)
+{
+	IPRDamageableInterface* Interface = GetNativeInterface(Object, EPRDamageableFunction::GetCurrentHealth);
+	return Interface ? Interface->GetCurrentHealth_Implementation() : IPRDamageableInterface::Execute_GetCurrentHealth(Object);
+}
+
+float FPRDamageableDispatch::GetMaxHealth(UObject* Object)
+{
+	IPRDamageableInterface* Interface = GetNativeInterface(Object, EPRDamageableFunction::GetMaxHealth);
+	return Interface ? Interface->GetMaxHealth_Implementation() : IPRDamageableInterface::Execute_GetMaxHealth(Object);
+}
+
+float FPRDamageableDispatch::Heal(UObject* Object, float Amount)
+{
+	IPRDamageableInterface* Interface = GetNativeInterface(Object, EPRDamageableFunction::Heal);
+	return Interface ? Interface->Heal_Implementation(Amount) : IPRDamageableInterface::Execute_Heal(Object, Amount);
+}
+
+bool FPRDamageableDispatch::TakeDamage(UObject* Object, const FPRDamageInfo& DamageInfo, const AActor* Instigator)
+{
+	// 대미지를 처리하기 전에 기록해야 대상이 대미지로 제거되어도 기록할 수 있습니다.
+	UPRDamageStreamSubsystem::Capture(Cast<AActor>(Object), Instigator, DamageInfo, false);
+
+	const bool bApplied = ResolveDamage(Object, DamageInfo);
+
+	UPRCombatTelemetrySubsystem* CombatTelemetry = UPRCombatTelemetrySubsystem::GetRecording(Object);
+	if(CombatTelemetry)
+	{
+		CombatTelemetry->RecordDamage(Instigator, Object, DamageInfo, bApplied);
+	}
+
+	return bApplied;
+}
+
+bool FPRDamageableDispatch::ResolveDamage(UObject* Object, const FPRDamageInfo& DamageInfo)
+{
+	IPRDamageableInterface* Interface = GetNativeInterface(Object, EPRDamageableFunction::TakeDamage);
+	return Interface ? Interface->TakeDamage_Implementation(DamageInfo) : IPRDamageableInterface::Execute_TakeDamage(Object, DamageInfo);
+}
+
+IPRDamageableInterface* FPRDamageableDispatch::GetNativeInterface(UObject* Object, EPRDamageableFunction Function)
+{
+	if(!Object || !FPRClassCapabilityRegistry::Get().GetCapabilities(Object->GetClass()).IsNative(Function))
+	{
+		return nullptr;
+	}
+
+	return Cast<IPRDamageableInterface>(Object);
+}
+#pragma endregion
+
+#pragma region Benchmark
+FPRInterfaceDispatchBenchmarkResult UPRInterfaceDispatchBenchmark::RunDispatchBenchmark(int32 Calls, TSubclassOf<UObject> PoolableClass, TSubclassOf<UObject> DamageableClass)
+{
+	FPRInterfaceDispatchBenchmarkResult BenchmarkResult;
+	BenchmarkResult.Calls = FMath::Max(Calls, 1);
+
+	if(!PoolableClass || !FPRClassCapabilityRegistry::IsPoolableClass(PoolableClass))
+	{
+		PoolableClass = APRPooledObject::StaticClass();
+	}
+
+	if(!DamageableClass || !FPRClassCapabilityRegistry::IsDamageableClass(DamageableClass))
+	{
+		DamageableClass = APRDamageableObject_HasHealthPoint::StaticClass();
+	}
+
+	// 부작용이 없는 함수를 기본 오브젝트로 호출하므로 월드가 없어도 측정할 수 있습니다.
+	UObject* PoolableObject = PoolableClass->GetDefaultObject();
+	UObject* DamageableObject = DamageableClass->GetDefaultObject();
+
+	// 결과를 사용하여 컴파일러가 호출을 제거하지 않도록 합니다.
+	int32 ActivateCount = 0;
+	float HealthSum = 0.0f;
+
+	double StartTime = FPlatformTime::Seconds();
+	for(int32 Index = 0; Index < BenchmarkResult.Calls; Index++)
+	{
+		ActivateCount += FPRPoolableDispatch::IsActivate(PoolableObject) ? 1 : 0;
+	}
+
+	BenchmarkResult.PoolableDispatchCallsPerSecond = BenchmarkResult.Calls / FMath::Max(FPlatformTime::Seconds() - StartTime, UE_DOUBLE_SMALL_NUMBER);
+
+	StartTime = FPlatformTime::Seconds();
+	for(int32 Index = 0; Index < BenchmarkResult.Calls; Index++)
+	{
+		ActivateCount += IPRPoolableInterface::Execute_IsActivate(PoolableObject) ? 1 : 0;
+	}
+
+	BenchmarkResult.PoolableExecuteCallsPerSecond = BenchmarkResult.Calls / FMath::Max(FPlatformTime::Seconds() - StartTime, UE_DOUBLE_SMALL_NUMBER);
+
+	StartTime = FPlatformTime::Seconds();
+	for(int32 Index = 0; Index < BenchmarkResult.Calls; Index++)
+	{
+		HealthSum += FPRDamageableDispatch::GetMaxHealth(DamageableObject);
+	}
+
+	BenchmarkResult.DamageableDispatchCallsPerSecond = BenchmarkResult.Calls / FMath::Max(FPlatformTime::Seconds() - StartTime, UE_DOUBLE_SMALL_NUMBER);
+
+	StartTime = FPlatformTime::Seconds();
+	for(int32 Index = 0; Index < BenchmarkResult.Calls; Index++)
+	{
+		HealthSum += IPRDamageableInterface::Execute_GetMaxHealth(DamageableObject);
+	}
+
+	BenchmarkResult.DamageableExecuteCallsPerSecond = BenchmarkResult.Calls / FMath::Max(FPlatformTime::Seconds() - StartTime, UE_DOUBLE_SMALL_NUMBER);
+
+	PR_LOG(Log, "Interface dispatch benchmark (%d calls, %d, %.1f): %s IsActivate dispatch %.0f/s, Execute_ %.0f/s; %s GetMaxHealth dispatch %.0f/s, Execute_ %.0f/s",
+			BenchmarkResult.Calls, ActivateCount, HealthSum,
+			*PoolableClass->GetName(), BenchmarkResult.PoolableDispatchCallsPerSecond, BenchmarkResult.PoolableExecuteCallsPerSecond,
+			*DamageableClass->GetName(), BenchmarkResult.DamageableDispatchCallsPerSecond, BenchmarkResult.DamageableExecuteCallsPerSecond);
+
+	return BenchmarkResult;
+}
+#pragma endregion
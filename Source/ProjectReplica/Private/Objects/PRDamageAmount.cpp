@@ -4,6 +4,7 @@
 #include "Objects/PRDamageAmount.h"
 #include "Components/WidgetComponent.h"
 #include "Widgets/PRDamageAmountWidget.h"
+#include "Interfaces/PRInterfaceDispatch.h"
 
 APRDamageAmount::APRDamageAmount()
 {
@@ -55,9 +56,17 @@ void APRDamageAmount::Initialize(FVector SpawnLocation, float DamageAmount, bool
 	}
 }
 
+void APRDamageAmount::UpdateDamageAmount(float DamageAmount, bool bIsCritical)
+{
+	if(IsValid(DamageAmountWidgetInstance))
+	{
+		DamageAmountWidgetInstance->UpdateDamageAmountWidget(DamageAmount, bIsCritical);
+	}
+}
+
 void APRDamageAmount::OnFadeOutWidgetAnimFinished()
 {
-	IPRPoolableInterface::Execute_Deactivate(this);
+	FPRPoolableDispatch::Deactivate(this);
 }
 
 UPRDamageAmountWidget* APRDamageAmount::CreateDamageAmountWidget()
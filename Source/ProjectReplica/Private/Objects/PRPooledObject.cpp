@@ -2,6 +2,7 @@
 
 
 #include "Objects/PRPooledObject.h"
+#include "Interfaces/PRInterfaceDispatch.h"
 
 APRPooledObject::APRPooledObject()
 {
@@ -31,7 +32,7 @@ void APRPooledObject::Activate_Implementation()
 	SetActorTickEnabled(bActivate);
 
 	// 오브젝트의 수명을 설정합니다. 오브젝트의 수명이 끝나면 오브젝트를 비활성화합니다.
-	IPRPoolableInterface::Execute_SetLifespan(this, ObjectLifespan);
+	FPRPoolableDispatch::SetLifespan(this, ObjectLifespan);
 }
 
 void APRPooledObject::Deactivate_Implementation()
@@ -86,12 +87,12 @@ void APRPooledObject::InitializeObject_Implementation(AActor* NewObjectOwner, in
 
 void APRPooledObject::ActivateAndSetLocation(const FVector& NewLocation)
 {
-	IPRPoolableInterface::Execute_Activate(this);
+	FPRPoolableDispatch::Activate(this);
 	SetActorLocation(NewLocation);
 }
 
 void APRPooledObject::OnDeactivate()
 {
-	IPRPoolableInterface::Execute_Deactivate(this);
+	FPRPoolableDispatch::Deactivate(this);
 }
 
@@ -11,6 +11,10 @@ UProjectReplicaGameInstance::UProjectReplicaGameInstance()
 	// ElementColor
 	ElementColorDataTable = nullptr;
 	ElementColors.Empty();
+
+	// DamageFormula
+	DamageFormulaDataTable = nullptr;
+	DamageFormulas.Empty();
 }
 
 void UProjectReplicaGameInstance::Init()
@@ -25,6 +29,9 @@ void UProjectReplicaGameInstance::Init()
 
 	// CharacterStatInfo
 	InitializeCharacterStatSettings();
+
+	// DamageFormula
+	InitializeDamageFormulas();
 }
 
 #pragma region ElementColor
@@ -153,3 +160,49 @@ TMap<TSubclassOf<APRBaseCharacter>, FPRLevelToCharacterStat> UProjectReplicaGame
 	return CharacterStatSettings;
 }
 #pragma endregion 
+
+#pragma region DamageFormula
+const FPRDamageFormula& UProjectReplicaGameInstance::GetDamageFormula(EPRDamageType DamageType) const
+{
+	const FPRDamageFormula* DamageFormula = DamageFormulas.Find(DamageType);
+	if(DamageFormula)
+	{
+		return *DamageFormula;
+	}
+
+	return DefaultDamageFormula;
+}
+
+void UProjectReplicaGameInstance::InitializeDamageFormulas()
+{
+	DamageFormulas.Empty();
+
+	FString CompileError;
+	if(!DefaultDamageFormula.Compile(FPRDamageFormula::GetDefaultExpression(), CompileError))
+	{
+		PR_LOG_ERROR("Failed to compile default damage formula: %s", *CompileError);
+	}
+
+	if(DamageFormulaDataTable)
+	{
+		TArray<FName> RowNames = DamageFormulaDataTable->GetRowNames();
+		for(const auto& RowName : RowNames)
+		{
+			FPRDamageFormulaSettings* DataTableRow = DamageFormulaDataTable->FindRow<FPRDamageFormulaSettings>(RowName, FString(""));
+			if(DataTableRow)
+			{
+				// 대미지 공식은 불러올 때 한 번만 컴파일하고, 컴파일에 실패한 공식은 기본 대미지 공식으로 대체합니다.
+				FPRDamageFormula DamageFormula;
+				if(DamageFormula.Compile(DataTableRow->Expression, CompileError))
+				{
+					DamageFormulas.Emplace(DataTableRow->DamageType, MoveTemp(DamageFormula));
+				}
+				else
+				{
+					PR_LOG_ERROR("Failed to compile damage formula %s: %s", *RowName.ToString(), *CompileError);
+				}
+			}
+		}
+	}
+}
+#pragma endregion
@@ -5,6 +5,7 @@
 #include "UObject/ConstructorHelpers.h"
 #include "Components/PRObjectPoolSystemComponent.h"
 #include "Objects/PRDamageAmount.h"
+#include "Interfaces/PRInterfaceDispatch.h"
 
 AProjectReplicaGameMode::AProjectReplicaGameMode()
 {
@@ -20,6 +21,8 @@ AProjectReplicaGameMode::AProjectReplicaGameMode()
 
 	// DamageAmount
 	DamageAmountClass = nullptr;
+	DamageAmountAggregationWindow = 0.3f;
+	DamageAmountAggregatesPurgeThreshold = 32;
 }
 
 void AProjectReplicaGameMode::PostInitializeComponents()
@@ -48,3 +51,54 @@ APRDamageAmount* AProjectReplicaGameMode::ActivateDamageAmount(FVector SpawnLoca
 
 	return nullptr;
 }
+
+APRDamageAmount* AProjectReplicaGameMode::ShowDamageAmount(AActor* Target, FVector SpawnLocation, float DamageAmount, bool bIsCritical, EPRElementType ElementType)
+{
+	if(!GetWorld() || !IsValid(Target) || DamageAmountAggregationWindow <= 0.0f)
+	{
+		return ActivateDamageAmount(SpawnLocation, DamageAmount, bIsCritical, ElementType);
+	}
+
+	const float CurrentTime = GetWorld()->GetTimeSeconds();
+	if(DamageAmountAggregates.Num() >= DamageAmountAggregatesPurgeThreshold)
+	{
+		PurgeExpiredDamageAmountAggregates(CurrentTime);
+	}
+
+	// 합산 시간 안에 표시 중인 DamageAmount가 있으면 대미지를 합산합니다.
+	// 합산 시간은 첫 번째 대미지부터 계산하므로 지속 대미지도 일정한 간격으로 새로운 DamageAmount를 표시합니다.
+	FPRDamageAmountAggregate& Aggregate = DamageAmountAggregates.FindOrAdd(MakeTuple(FObjectKey(Target), ElementType));
+	APRDamageAmount* DamageAmountObject = Aggregate.DamageAmountObject.Get();
+	if(IsValid(DamageAmountObject)
+		&& FPRPoolableDispatch::IsActivate(DamageAmountObject)
+		&& CurrentTime - Aggregate.StartTime <= DamageAmountAggregationWindow)
+	{
+		Aggregate.TotalDamage += DamageAmount;
+		Aggregate.bIsCritical |= bIsCritical;
+		Aggregate.HitCount++;
+		DamageAmountObject->UpdateDamageAmount(Aggregate.TotalDamage, Aggregate.bIsCritical);
+
+		return DamageAmountObject;
+	}
+
+	Aggregate.DamageAmountObject = ActivateDamageAmount(SpawnLocation, DamageAmount, bIsCritical, ElementType);
+	Aggregate.TotalDamage = DamageAmount;
+	Aggregate.bIsCritical = bIsCritical;
+	Aggregate.HitCount = 1;
+	Aggregate.StartTime = CurrentTime;
+
+	return Aggregate.DamageAmountObject.Get();
+}
+
+void AProjectReplicaGameMode::PurgeExpiredDamageAmountAggregates(float CurrentTime)
+{
+	for(auto Iterator = DamageAmountAggregates.CreateIterator(); Iterator; ++Iterator)
+	{
+		if(CurrentTime - Iterator.Value().StartTime > DamageAmountAggregationWindow)
+		{
+			Iterator.RemoveCurrent();
+		}
+	}
+
+	DamageAmountAggregatesPurgeThreshold = FMath::Max(DamageAmountAggregates.Num() * 2, 32);
+}
@@ -6,6 +6,7 @@
 #include "Characters/PRAICharacter.h"
 #include "Components/PRStatSystemComponent.h"
 #include "Kismet/GameplayStatics.h"
+#include "Interfaces/PRInterfaceDispatch.h"
 
 APRAISpawner::APRAISpawner()
 {
@@ -38,7 +39,7 @@ void APRAISpawner::SpawnAI()
 		{
 			SpawnedAICharacter->SetActorLocationAndRotation(GetActorLocation(), GetActorRotation());
 			SpawnedAICharacter->GetStatSystem()->InitializeStatByLevel(SpawnAICharacterLevel);
-			IPRPoolableInterface::Execute_Activate(SpawnedAICharacter);
+			FPRPoolableDispatch::Activate(SpawnedAICharacter);
 		}
 	}
 }
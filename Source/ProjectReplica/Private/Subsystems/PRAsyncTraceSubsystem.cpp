@@ -0,0 +1,270 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Subsystems/PRAsyncTraceSubsystem.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+
+// 비동기 Trace의 프레임별 제출량을 기록하는 CSV 프로파일러 카테고리입니다.
+CSV_DEFINE_CATEGORY(PRAsyncTrace, true);
+
+UPRAsyncTraceSubsystem::UPRAsyncTraceSubsystem()
+{
+	// 플레이어의 조작에 직접 반응하는 기능일수록 우선순위가 높습니다.
+	FeatureSettings.Add(EPRAsyncTraceFeature::AsyncTraceFeature_Vault, FPRAsyncTraceFeatureSettings(1, 16));
+	FeatureSettings.Add(EPRAsyncTraceFeature::AsyncTraceFeature_Footsteps, FPRAsyncTraceFeatureSettings(0, 8));
+	FeatureSettings.Add(EPRAsyncTraceFeature::AsyncTraceFeature_Projectile, FPRAsyncTraceFeatureSettings(0, 4096));
+
+	NextBatchID = 0;
+	AsyncTraceStats = FPRAsyncTraceStats();
+}
+
+void UPRAsyncTraceSubsystem::Deinitialize()
+{
+	TraceBatches.Empty();
+	PendingBatchIDs.Empty();
+
+	Super::Deinitialize();
+}
+
+void UPRAsyncTraceSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	// TickableWorldSubsystem은 액터의 Tick이 끝난 후 실행되므로 이번 프레임에 요청한 모든 Trace를 모아서 제출합니다.
+	SubmitPendingTraceBatches();
+}
+
+TStatId UPRAsyncTraceSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UPRAsyncTraceSubsystem, STATGROUP_Tickables);
+}
+
+int32 UPRAsyncTraceSubsystem::RequestTraceBatch(EPRAsyncTraceFeature Feature, TArray<FPRAsyncTraceRequest>&& Requests, FPRAsyncTraceBatchDelegate&& OnCompleted)
+{
+	if(Requests.Num() == 0)
+	{
+		return INDEX_NONE;
+	}
+
+	const int32 BatchID = NextBatchID++;
+	FPRAsyncTraceBatch& Batch = TraceBatches.Add(BatchID);
+	Batch.Feature = Feature;
+	Batch.Requests = MoveTemp(Requests);
+	Batch.OnCompleted = MoveTemp(OnCompleted);
+	PendingBatchIDs.Add(BatchID);
+
+	return BatchID;
+}
+
+int32 UPRAsyncTraceSubsystem::RequestTrace(EPRAsyncTraceFeature Feature, const FPRAsyncTraceRequest& Request, FPRAsyncTraceBatchDelegate&& OnCompleted)
+{
+	TArray<FPRAsyncTraceRequest> Requests;
+	Requests.Add(Request);
+
+	return RequestTraceBatch(Feature, MoveTemp(Requests), MoveTemp(OnCompleted));
+}
+
+void UPRAsyncTraceSubsystem::CancelTraceBatch(int32 BatchID)
+{
+	// 제출한 Trace의 결과는 OnAsyncTraceCompleted에서 묶음을 찾지 못하므로 무시됩니다.
+	TraceBatches.Remove(BatchID);
+	PendingBatchIDs.Remove(BatchID);
+}
+
+void UPRAsyncTraceSubsystem::SetFeatureSettings(EPRAsyncTraceFeature Feature, const FPRAsyncTraceFeatureSettings& NewSettings)
+{
+	FeatureSettings.Add(Feature, NewSettings);
+}
+
+FPRAsyncTraceFeatureSettings UPRAsyncTraceSubsystem::GetFeatureSettings(EPRAsyncTraceFeature Feature) const
+{
+	const FPRAsyncTraceFeatureSettings* Settings = FeatureSettings.Find(Feature);
+	if(Settings)
+	{
+		return *Settings;
+	}
+
+	return FPRAsyncTraceFeatureSettings();
+}
+
+void UPRAsyncTraceSubsystem::ResetAsyncTraceStats()
+{
+	AsyncTraceStats = FPRAsyncTraceStats();
+}
+
+void UPRAsyncTraceSubsystem::SubmitPendingTraceBatches()
+{
+	if(PendingBatchIDs.Num() == 0)
+	{
+		return;
+	}
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(UPRAsyncTraceSubsystem::SubmitPendingTraceBatches);
+
+	// 우선순위가 높은 기능의 묶음부터 제출합니다. 같은 우선순위에서는 요청한 순서를 유지합니다.
+	PendingBatchIDs.StableSort([this](int32 BatchA, int32 BatchB)
+	{
+		const FPRAsyncTraceBatch* A = TraceBatches.Find(BatchA);
+		const FPRAsyncTraceBatch* B = TraceBatches.Find(BatchB);
+		const int32 PriorityA = A ? GetFeatureSettings(A->Feature).Priority : 0;
+		const int32 PriorityB = B ? GetFeatureSettings(B->Feature).Priority : 0;
+		return PriorityA > PriorityB;
+	});
+
+	int32 FeatureSubmittedTraces[static_cast<int32>(EPRAsyncTraceFeature::AsyncTraceFeature_Count)] = {};
+	int32 FrameSubmittedTraces = 0;
+	int32 FrameDeferredBatches = 0;
+	TArray<int32> DeferredBatchIDs;
+	for(const int32 BatchID : PendingBatchIDs)
+	{
+		FPRAsyncTraceBatch* Batch = TraceBatches.Find(BatchID);
+		if(!Batch)
+		{
+			continue;
+		}
+
+		int32& SubmittedTraces = FeatureSubmittedTraces[static_cast<int32>(Batch->Feature)];
+		const int32 MaxTracesPerFrame = FMath::Max(GetFeatureSettings(Batch->Feature).MaxTracesPerFrame, 1);
+		const int32 RemainingBudget = MaxTracesPerFrame - SubmittedTraces;
+		const int32 UnsubmittedTraces = Batch->Requests.Num() - Batch->SubmittedTraces;
+
+		// 예산을 초과하는 묶음은 다음 프레임으로 미룹니다.
+		// 예산보다 커서 한 번에 제출할 수 없는 묶음은 남은 예산만큼 나누어 제출하고 나머지는 다음 프레임으로 미룹니다.
+		int32 MaxBatchTraces = UnsubmittedTraces;
+		if(UnsubmittedTraces > RemainingBudget)
+		{
+			if(UnsubmittedTraces <= MaxTracesPerFrame || RemainingBudget <= 0)
+			{
+				DeferredBatchIDs.Add(BatchID);
+				FrameDeferredBatches++;
+				continue;
+			}
+
+			MaxBatchTraces = RemainingBudget;
+		}
+
+		const int32 BatchSubmittedTraces = SubmitTraceBatch(BatchID, *Batch, MaxBatchTraces);
+		SubmittedTraces += BatchSubmittedTraces;
+		FrameSubmittedTraces += BatchSubmittedTraces;
+		if(Batch->SubmittedTraces < Batch->Requests.Num())
+		{
+			DeferredBatchIDs.Add(BatchID);
+			FrameDeferredBatches++;
+		}
+	}
+
+	PendingBatchIDs = MoveTemp(DeferredBatchIDs);
+
+	AsyncTraceStats.SubmittedTraces += FrameSubmittedTraces;
+	AsyncTraceStats.DeferredBatches += FrameDeferredBatches;
+	AsyncTraceStats.PeakTracesPerFrame = FMath::Max(AsyncTraceStats.PeakTracesPerFrame, FrameSubmittedTraces);
+	CSV_CUSTOM_STAT(PRAsyncTrace, SubmittedTraces, FrameSubmittedTraces, ECsvCustomStatOp::Accumulate);
+	CSV_CUSTOM_STAT(PRAsyncTrace, DeferredBatches, FrameDeferredBatches, ECsvCustomStatOp::Accumulate);
+}
+
+int32 UPRAsyncTraceSubsystem::SubmitTraceBatch(int32 BatchID, FPRAsyncTraceBatch& Batch, int32 MaxTraces)
+{
+	UWorld* World = GetWorld();
+	if(!World)
+	{
+		return 0;
+	}
+
+	// 처음 제출할 때 충돌하지 않은 Trace도 시작 위치와 끝 위치를 사용할 수 있도록 결과를 초기화합니다.
+	// 결과가 도착하지 않은 Trace의 수는 묶음 전체로 설정하므로 나누어 제출한 묶음은 마지막 Trace의 결과가 도착해야 완료됩니다.
+	if(Batch.SubmittedTraces == 0)
+	{
+		Batch.Results.Reset(Batch.Requests.Num());
+		for(const FPRAsyncTraceRequest& Request : Batch.Requests)
+		{
+			Batch.Results.Emplace(Request.Start, Request.End);
+		}
+
+		Batch.RemainingTraces = Batch.Requests.Num();
+		AsyncTraceStats.SubmittedBatches++;
+		if(MaxTraces < Batch.Requests.Num())
+		{
+			AsyncTraceStats.SplitBatches++;
+		}
+	}
+
+	const int32 FirstIndex = Batch.SubmittedTraces;
+	const int32 LastIndex = FMath::Min(FirstIndex + MaxTraces, Batch.Requests.Num());
+	Batch.SubmittedTraces = LastIndex;
+
+	const FTraceDelegate TraceDelegate = FTraceDelegate::CreateUObject(this, &UPRAsyncTraceSubsystem::OnAsyncTraceCompleted, BatchID);
+	for(int32 Index = FirstIndex; Index < LastIndex; Index++)
+	{
+		const FPRAsyncTraceRequest& Request = Batch.Requests[Index];
+		FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(PRAsyncTrace), Request.bTraceComplex, Request.IgnoreActor.Get());
+		QueryParams.bReturnPhysicalMaterial = Request.bReturnPhysicalMaterial;
+
+		if(Request.Radius > 0.0f)
+		{
+			World->AsyncSweepByChannel(EAsyncTraceType::Single, Request.Start, Request.End, FQuat::Identity, Request.TraceChannel,
+										FCollisionShape::MakeSphere(Request.Radius), QueryParams, FCollisionResponseParams::DefaultResponseParam,
+										&TraceDelegate, static_cast<uint32>(Index));
+		}
+		else
+		{
+			World->AsyncLineTraceByChannel(EAsyncTraceType::Single, Request.Start, Request.End, Request.TraceChannel,
+											QueryParams, FCollisionResponseParams::DefaultResponseParam,
+											&TraceDelegate, static_cast<uint32>(Index));
+		}
+	}
+
+	return LastIndex - FirstIndex;
+}
+
+void UPRAsyncTraceSubsystem::OnAsyncTraceCompleted(const FTraceHandle& TraceHandle, FTraceDatum& TraceDatum, int32 BatchID)
+{
+	// 취소한 묶음의 결과는 무시합니다.
+	FPRAsyncTraceBatch* Batch = TraceBatches.Find(BatchID);
+	if(!Batch)
+	{
+		return;
+	}
+
+	const int32 Index = static_cast<int32>(TraceDatum.UserData);
+	if(!Batch->Results.IsValidIndex(Index))
+	{
+		return;
+	}
+
+	if(TraceDatum.OutHits.Num() > 0)
+	{
+		Batch->Results[Index] = TraceDatum.OutHits[0];
+	}
+
+	const FPRAsyncTraceRequest& Request = Batch->Requests[Index];
+	if(Request.bDrawDebug && GetWorld())
+	{
+		const FHitResult& HitResult = Batch->Results[Index];
+		const FVector HitLocation = HitResult.bBlockingHit ? HitResult.Location : Request.End;
+		DrawDebugLine(GetWorld(), Request.Start, HitLocation, FColor::Red, false, 5.0f);
+		if(HitResult.bBlockingHit)
+		{
+			DrawDebugLine(GetWorld(), HitLocation, Request.End, FColor::Green, false, 5.0f);
+			DrawDebugPoint(GetWorld(), HitResult.ImpactPoint, 16.0f, FColor::Red, false, 5.0f);
+		}
+
+		if(Request.Radius > 0.0f)
+		{
+			DrawDebugSphere(GetWorld(), HitLocation, Request.Radius, 12, FColor::Red, false, 5.0f);
+		}
+	}
+
+	Batch->RemainingTraces--;
+	if(Batch->RemainingTraces > 0)
+	{
+		return;
+	}
+
+	// 델리게이트에서 새로운 묶음을 요청할 수 있으므로 묶음을 Map에서 제거한 후 결과를 전달합니다.
+	FPRAsyncTraceBatch CompletedBatch = MoveTemp(*Batch);
+	TraceBatches.Remove(BatchID);
+	AsyncTraceStats.CompletedBatches++;
+
+	CompletedBatch.OnCompleted.ExecuteIfBound(CompletedBatch.Results);
+}
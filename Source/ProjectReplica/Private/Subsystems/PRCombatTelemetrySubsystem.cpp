@@ -0,0 +1,164 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Subsystems/PRCombatTelemetrySubsystem.h"
+#include "Subsystems/PRDamageQueueSubsystem.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Paths.h"
+
+/** 전투 텔레메트리 파일을 CSV 파일로 변환하는 콘솔 명령어입니다. */
+static FAutoConsoleCommand ConvertCombatTelemetryToCSVCommand(
+	TEXT("PR.CombatTelemetry.ConvertToCSV"),
+	TEXT("Converts a combat telemetry file to CSV. Usage: PR.CombatTelemetry.ConvertToCSV <TelemetryFilePath> [CSVFilePath]"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		if(Args.Num() > 0)
+		{
+			UPRCombatTelemetrySubsystem::ConvertToCSV(Args[0], Args.Num() > 1 ? Args[1] : FString());
+		}
+	}));
+
+UPRCombatTelemetrySubsystem::UPRCombatTelemetrySubsystem()
+{
+	RingBufferCapacity = 65536;
+	FlushInterval = 0.5f;
+	RecordingStartTime = 0.0;
+}
+
+void UPRCombatTelemetrySubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	if(FParse::Param(FCommandLine::Get(), TEXT("PRCombatTelemetry")))
+	{
+		StartRecording(FString());
+	}
+}
+
+void UPRCombatTelemetrySubsystem::Deinitialize()
+{
+	StopRecording();
+
+	Super::Deinitialize();
+}
+
+bool UPRCombatTelemetrySubsystem::StartRecording(const FString& FilePath)
+{
+	if(IsRecording())
+	{
+		return false;
+	}
+
+	const FString NewFilePath = FilePath.IsEmpty()
+									? FPaths::ProfilingDir() / TEXT("CombatTelemetry") / FString::Printf(TEXT("CombatTelemetry-%s.prct"), *FDateTime::Now().ToString())
+									: FilePath;
+
+	RingBuffer = MakeUnique<FPRCombatTelemetryRingBuffer>(static_cast<uint32>(FMath::Max(RingBufferCapacity, 2)));
+	Writer = MakeUnique<FPRCombatTelemetryWriter>(*RingBuffer, NewFilePath, FlushInterval);
+	if(!Writer->Start())
+	{
+		Writer.Reset();
+		RingBuffer.Reset();
+		return false;
+	}
+
+	RecordingStartTime = FPlatformTime::Seconds();
+	PR_LOG(Log, "Combat telemetry recording to %s", *NewFilePath);
+	return true;
+}
+
+void UPRCombatTelemetrySubsystem::StopRecording()
+{
+	if(!IsRecording())
+	{
+		return;
+	}
+
+	// Writer가 링 버퍼의 남은 기록을 모두 기록한 후 링 버퍼를 해제합니다.
+	Writer->Shutdown();
+	PR_LOG(Log, "Combat telemetry wrote %llu records to %s (%llu dropped)",
+			Writer->GetWrittenCount(), *Writer->GetFilePath(), RingBuffer->GetDroppedCount());
+
+	Writer.Reset();
+	RingBuffer.Reset();
+}
+
+void UPRCombatTelemetrySubsystem::RecordDamageEvent(const FPRDamageEventQueue& DamageQueue, int32 EventIndex, bool bApplied)
+{
+	if(!RingBuffer.IsValid())
+	{
+		return;
+	}
+
+	PushRecord(DamageQueue.Instigators[EventIndex].Get(),
+				DamageQueue.Targets[DamageQueue.TargetIndices[EventIndex]].Get(),
+				DamageQueue.Amounts[EventIndex],
+				DamageQueue.ElementTypes[EventIndex],
+				DamageQueue.DamageResponses[EventIndex],
+				DamageQueue.HasFlag(EventIndex, EPRDamageEventFlags::Critical),
+				bApplied);
+}
+
+void UPRCombatTelemetrySubsystem::RecordDamage(const AActor* Attacker, const UObject* Target, const FPRDamageInfo& DamageInfo, bool bApplied)
+{
+	if(!RingBuffer.IsValid())
+	{
+		return;
+	}
+
+	PushRecord(Attacker, Target, DamageInfo.Amount, DamageInfo.DamageElementType, DamageInfo.DamageResponse, DamageInfo.bIsCritical, bApplied);
+}
+
+UPRCombatTelemetrySubsystem* UPRCombatTelemetrySubsystem::GetRecording(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	UPRCombatTelemetrySubsystem* CombatTelemetry = World && World->GetGameInstance() ? World->GetGameInstance()->GetSubsystem<UPRCombatTelemetrySubsystem>() : nullptr;
+
+	return CombatTelemetry && CombatTelemetry->IsRecording() ? CombatTelemetry : nullptr;
+}
+
+void UPRCombatTelemetrySubsystem::PushRecord(const UObject* Attacker, const UObject* Target, float Amount, EPRElementType ElementType, EPRDamageResponse DamageResponse, bool bCritical, bool bApplied)
+{
+	FPRCombatTelemetryRecord Record;
+	Record.Timestamp = FPlatformTime::Seconds() - RecordingStartTime;
+	Record.Attacker = Attacker ? Attacker->GetFName() : NAME_None;
+	Record.Target = Target ? Target->GetFName() : NAME_None;
+	Record.Amount = Amount;
+	Record.ElementType = ElementType;
+	Record.DamageResponse = DamageResponse;
+	Record.Flags = bCritical ? EPRCombatTelemetryFlags::Critical : EPRCombatTelemetryFlags::None;
+	if(bApplied)
+	{
+		Record.Flags |= EPRCombatTelemetryFlags::Applied;
+	}
+
+	RingBuffer->Push(Record);
+}
+
+bool UPRCombatTelemetrySubsystem::ConvertToCSV(const FString& TelemetryFilePath, const FString& CSVFilePath)
+{
+	const FString NewCSVFilePath = CSVFilePath.IsEmpty() ? FPaths::ChangeExtension(TelemetryFilePath, TEXT("csv")) : CSVFilePath;
+	const bool bSucceeded = FPRCombatTelemetryFile::ConvertToCSV(TelemetryFilePath, NewCSVFilePath);
+	if(bSucceeded)
+	{
+		PR_LOG(Log, "Converted combat telemetry %s to %s", *TelemetryFilePath, *NewCSVFilePath);
+	}
+
+	return bSucceeded;
+}
+
+int64 UPRCombatTelemetrySubsystem::GetRecordedCount() const
+{
+	return RingBuffer.IsValid() ? static_cast<int64>(RingBuffer->GetPushedCount()) : 0;
+}
+
+int64 UPRCombatTelemetrySubsystem::GetDroppedCount() const
+{
+	return RingBuffer.IsValid() ? static_cast<int64>(RingBuffer->GetDroppedCount()) : 0;
+}
+
+int64 UPRCombatTelemetrySubsystem::GetWrittenCount() const
+{
+	return Writer.IsValid() ? static_cast<int64>(Writer->GetWrittenCount()) : 0;
+}
@@ -0,0 +1,175 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Subsystems/PRDamageFieldSubsystem.h"
+#include "Subsystems/PRDamageQueueSubsystem.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+
+// 지속 범위 공격 영역의 처리량을 기록하는 CSV 프로파일러 카테고리입니다.
+CSV_DEFINE_CATEGORY(PRDamageField, true);
+
+UPRDamageFieldSubsystem::UPRDamageFieldSubsystem()
+{
+	EvaluationInterval = 0.1f;
+	DamageFieldStats = FPRDamageFieldStats();
+	NextFieldID = 0;
+	TimeSinceLastEvaluation = 0.0f;
+}
+
+void UPRDamageFieldSubsystem::Deinitialize()
+{
+	DamageFields.Empty();
+	FieldIndices.Empty();
+	QueryResults.Empty();
+
+	Super::Deinitialize();
+}
+
+void UPRDamageFieldSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if(DamageFields.Num() == 0)
+	{
+		TimeSinceLastEvaluation = 0.0f;
+		return;
+	}
+
+	// 영역마다 따로 처리하지 않고 정해진 간격마다 모든 영역을 한 번에 처리합니다.
+	TimeSinceLastEvaluation += DeltaTime;
+	if(TimeSinceLastEvaluation < EvaluationInterval)
+	{
+		return;
+	}
+
+	TimeSinceLastEvaluation = 0.0f;
+	EvaluateDamageFields();
+}
+
+TStatId UPRDamageFieldSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UPRDamageFieldSubsystem, STATGROUP_Tickables);
+}
+
+int32 UPRDamageFieldSubsystem::SpawnDamageField(AActor* Instigator, const FVector& Center, float Radius, float Height, float Duration, float DamageInterval, const FPRDamageInfo& DamageInfo, bool bDrawDebug)
+{
+	const double CurrentTime = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0;
+
+	FPRDamageField& NewField = DamageFields.AddDefaulted_GetRef();
+	NewField.FieldID = NextFieldID++;
+	NewField.Instigator = Instigator;
+	NewField.Center = Center;
+	NewField.Radius = FMath::Max(Radius, 0.0f);
+	NewField.Height = FMath::Max(Height, 0.0f);
+	NewField.DamageInterval = FMath::Max(DamageInterval, EvaluationInterval);
+	NewField.NextDamageTime = CurrentTime;
+	NewField.ExpireTime = Duration > 0.0f ? CurrentTime + Duration : 0.0;
+	NewField.DamageInfo = DamageInfo;
+	NewField.bDrawDebug = bDrawDebug;
+
+	FieldIndices.Add(NewField.FieldID, DamageFields.Num() - 1);
+	DamageFieldStats.PeakFields = FMath::Max(DamageFieldStats.PeakFields, DamageFields.Num());
+
+	return NewField.FieldID;
+}
+
+void UPRDamageFieldSubsystem::RemoveDamageField(int32 FieldID)
+{
+	const int32* FieldIndex = FieldIndices.Find(FieldID);
+	if(FieldIndex)
+	{
+		RemoveDamageFieldAt(*FieldIndex);
+	}
+}
+
+void UPRDamageFieldSubsystem::SetDamageFieldCenter(int32 FieldID, const FVector& NewCenter)
+{
+	const int32* FieldIndex = FieldIndices.Find(FieldID);
+	if(FieldIndex)
+	{
+		DamageFields[*FieldIndex].Center = NewCenter;
+	}
+}
+
+void UPRDamageFieldSubsystem::ResetDamageFieldStats()
+{
+	DamageFieldStats = FPRDamageFieldStats();
+	DamageFieldStats.PeakFields = DamageFields.Num();
+}
+
+void UPRDamageFieldSubsystem::EvaluateDamageFields()
+{
+	UWorld* World = GetWorld();
+	UPRDamageableSpatialHashSubsystem* SpatialHash = World ? World->GetSubsystem<UPRDamageableSpatialHashSubsystem>() : nullptr;
+	UPRDamageQueueSubsystem* DamageQueue = World ? World->GetSubsystem<UPRDamageQueueSubsystem>() : nullptr;
+	if(!SpatialHash || !DamageQueue)
+	{
+		return;
+	}
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(UPRDamageFieldSubsystem::EvaluateDamageFields);
+	const double PassStartTime = FPlatformTime::Seconds();
+	const double CurrentTime = World->GetTimeSeconds();
+
+	int32 PassEvaluatedFields = 0;
+	int32 PassDamagedTargets = 0;
+	for(int32 FieldIndex = 0; FieldIndex < DamageFields.Num();)
+	{
+		FPRDamageField& Field = DamageFields[FieldIndex];
+		if(CurrentTime >= Field.NextDamageTime)
+		{
+			// 처리 간격 때문에 늦어져도 대미지 간격을 유지하고, 프레임이 오래 멈춘 후에도 대미지를 몰아서 주지 않습니다.
+			Field.NextDamageTime = FMath::Max(Field.NextDamageTime + Field.DamageInterval, CurrentTime);
+			PassEvaluatedFields++;
+
+			AActor* Instigator = Field.Instigator.Get();
+			QueryResults.Reset();
+			SpatialHash->QueryCylinder(Field.Center, Field.Radius, Field.Height, Instigator, QueryResults);
+			for(const FPRDamageableQueryResult& QueryResult : QueryResults)
+			{
+				FPRDamageInfo DamageInfo = Field.DamageInfo;
+				DamageInfo.ImpactLocation = QueryResult.ImpactPoint;
+				DamageQueue->QueueDamage(Instigator, QueryResult.Actor, DamageInfo);
+			}
+
+			PassDamagedTargets += QueryResults.Num();
+
+			if(Field.bDrawDebug)
+			{
+				DrawDebugCylinder(World, Field.Center, Field.Center + FVector(0.0f, 0.0f, Field.Height), Field.Radius, 32, FColor::Orange, false, Field.DamageInterval, 0, 2.0f);
+			}
+		}
+
+		if(Field.ExpireTime > 0.0 && CurrentTime >= Field.ExpireTime)
+		{
+			// 마지막 영역을 현재 위치로 옮기므로 Index를 증가시키지 않습니다.
+			RemoveDamageFieldAt(FieldIndex);
+			continue;
+		}
+
+		FieldIndex++;
+	}
+
+	const double PassTime = FPlatformTime::Seconds() - PassStartTime;
+	DamageFieldStats.Passes++;
+	DamageFieldStats.EvaluatedFields += PassEvaluatedFields;
+	DamageFieldStats.DamagedTargets += PassDamagedTargets;
+	DamageFieldStats.LastPassTime = PassTime;
+	DamageFieldStats.PeakPassTime = FMath::Max(DamageFieldStats.PeakPassTime, PassTime);
+
+	CSV_CUSTOM_STAT(PRDamageField, DamageFields, DamageFields.Num(), ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(PRDamageField, EvaluatedFields, PassEvaluatedFields, ECsvCustomStatOp::Accumulate);
+	CSV_CUSTOM_STAT(PRDamageField, DamagedTargets, PassDamagedTargets, ECsvCustomStatOp::Accumulate);
+}
+
+void UPRDamageFieldSubsystem::RemoveDamageFieldAt(int32 FieldIndex)
+{
+	FieldIndices.Remove(DamageFields[FieldIndex].FieldID);
+
+	DamageFields.RemoveAtSwap(FieldIndex);
+	if(DamageFields.IsValidIndex(FieldIndex))
+	{
+		FieldIndices.Add(DamageFields[FieldIndex].FieldID, FieldIndex);
+	}
+}
@@ -0,0 +1,257 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Subsystems/PRDamageQueueSubsystem.h"
+#include "ProjectReplicaGameMode.h"
+#include "Characters/PRBaseCharacter.h"
+#include "Components/PRDamageSystemComponent.h"
+#include "Interfaces/PRDamageableInterface.h"
+#include "Subsystems/PRCombatTelemetrySubsystem.h"
+#include "Subsystems/PRDamageStreamSubsystem.h"
+#include "Kismet/GameplayStatics.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+#include "Interfaces/PRInterfaceDispatch.h"
+
+// 대미지 큐의 프레임별 처리량과 처리 시간을 기록하는 CSV 프로파일러 카테고리입니다.
+CSV_DEFINE_CATEGORY(PRDamageQueue, true);
+
+#pragma region DamageEventQueue
+int32 FPRDamageEventQueue::Add(AActor* Instigator, AActor* Target, const FPRDamageInfo& DamageInfo)
+{
+	// 처음 대미지를 받는 대상이면 대상의 Index를 부여합니다.
+	int32* TargetIndex = TargetIndexMap.Find(FObjectKey(Target));
+	if(!TargetIndex)
+	{
+		TargetIndex = &TargetIndexMap.Add(FObjectKey(Target), Targets.Emplace(Target));
+	}
+
+	EPRDamageEventFlags EventFlags = EPRDamageEventFlags::None;
+	if(DamageInfo.bIsCritical)
+	{
+		EventFlags |= EPRDamageEventFlags::Critical;
+	}
+
+	if(DamageInfo.bShouldDamageInvincible)
+	{
+		EventFlags |= EPRDamageEventFlags::DamageInvincible;
+	}
+
+	if(DamageInfo.bCanBeBlocked)
+	{
+		EventFlags |= EPRDamageEventFlags::CanBeBlocked;
+	}
+
+	if(DamageInfo.bCanBeParried)
+	{
+		EventFlags |= EPRDamageEventFlags::CanBeParried;
+	}
+
+	if(DamageInfo.bShouldForceInterrupt)
+	{
+		EventFlags |= EPRDamageEventFlags::ForceInterrupt;
+	}
+
+	TargetIndices.Emplace(*TargetIndex);
+	Instigators.Emplace(Instigator);
+	ImpactLocations.Emplace(DamageInfo.ImpactLocation);
+	DamageTypes.Emplace(DamageInfo.DamageType);
+	ElementTypes.Emplace(DamageInfo.DamageElementType);
+	DamageResponses.Emplace(DamageInfo.DamageResponse);
+	Flags.Emplace(EventFlags);
+
+	return Amounts.Emplace(DamageInfo.Amount);
+}
+
+void FPRDamageEventQueue::Reset()
+{
+	Targets.Reset();
+	TargetIndices.Reset();
+	Instigators.Reset();
+	Amounts.Reset();
+	ImpactLocations.Reset();
+	DamageTypes.Reset();
+	ElementTypes.Reset();
+	DamageResponses.Reset();
+	Flags.Reset();
+	TargetIndexMap.Reset();
+}
+
+FPRDamageInfo FPRDamageEventQueue::GetDamageInfo(int32 EventIndex) const
+{
+	return FPRDamageInfo(Amounts[EventIndex],
+						DamageTypes[EventIndex],
+						ElementTypes[EventIndex],
+						DamageResponses[EventIndex],
+						ImpactLocations[EventIndex],
+						HasFlag(EventIndex, EPRDamageEventFlags::Critical),
+						HasFlag(EventIndex, EPRDamageEventFlags::DamageInvincible),
+						HasFlag(EventIndex, EPRDamageEventFlags::CanBeBlocked),
+						HasFlag(EventIndex, EPRDamageEventFlags::CanBeParried),
+						HasFlag(EventIndex, EPRDamageEventFlags::ForceInterrupt));
+}
+#pragma endregion
+
+#pragma region DamageQueueSubsystem
+UPRDamageQueueSubsystem::UPRDamageQueueSubsystem()
+{
+	DamageQueueStats = FPRDamageQueueStats();
+}
+
+void UPRDamageQueueSubsystem::Deinitialize()
+{
+	PendingQueue.Reset();
+	ResolvingQueue.Reset();
+
+	Super::Deinitialize();
+}
+
+void UPRDamageQueueSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	// TickableWorldSubsystem은 액터의 Tick이 끝난 후 실행되므로 이번 프레임에 발생한 모든 대미지를 처리합니다.
+	ResolveDamageQueue();
+}
+
+TStatId UPRDamageQueueSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UPRDamageQueueSubsystem, STATGROUP_Tickables);
+}
+
+void UPRDamageQueueSubsystem::QueueDamage(AActor* Instigator, AActor* Target, const FPRDamageInfo& DamageInfo)
+{
+	if(!FPRClassCapabilityRegistry::IsDamageable(Target))
+	{
+		return;
+	}
+
+	UPRDamageStreamSubsystem::Capture(Target, Instigator, DamageInfo, true);
+	PendingQueue.Add(Instigator, Target, DamageInfo);
+}
+
+void UPRDamageQueueSubsystem::ResolveDamageQueue()
+{
+	if(PendingQueue.Num() == 0)
+	{
+		return;
+	}
+
+	CSV_SCOPED_TIMING_STAT(PRDamageQueue, ResolveDamageQueue);
+	TRACE_CPUPROFILER_EVENT_SCOPE(UPRDamageQueueSubsystem::ResolveDamageQueue);
+	const double ResolveStartTime = FPlatformTime::Seconds();
+
+	// 처리 중에 추가되는 대미지가 처리 중인 배열을 변경하지 않도록 대미지 큐를 교체합니다.
+	Swap(PendingQueue, ResolvingQueue);
+	PendingQueue.Reset();
+
+	const int32 EventCount = ResolvingQueue.Num();
+	const int32 TargetCount = ResolvingQueue.NumTargets();
+
+	// 대상별 대미지 이벤트의 수를 세어 대상별 시작 위치를 구합니다.
+	TargetEventOffsets.Reset();
+	TargetEventOffsets.SetNumZeroed(TargetCount + 1);
+	for(const int32 TargetIndex : ResolvingQueue.TargetIndices)
+	{
+		TargetEventOffsets[TargetIndex + 1]++;
+	}
+
+	for(int32 TargetIndex = 0; TargetIndex < TargetCount; TargetIndex++)
+	{
+		TargetEventOffsets[TargetIndex + 1] += TargetEventOffsets[TargetIndex];
+	}
+
+	// 대미지 이벤트를 추가된 순서를 유지하면서 대상별로 정렬합니다.
+	TargetWriteOffsets = TargetEventOffsets;
+	SortedEventIndices.SetNumUninitialized(EventCount, false);
+	for(int32 EventIndex = 0; EventIndex < EventCount; EventIndex++)
+	{
+		SortedEventIndices[TargetWriteOffsets[ResolvingQueue.TargetIndices[EventIndex]]++] = EventIndex;
+	}
+
+	AppliedEvents.Init(false, EventCount);
+
+	// GameMode는 대상마다 찾지 않고 한 번만 찾습니다.
+	AProjectReplicaGameMode* PRGameMode = Cast<AProjectReplicaGameMode>(UGameplayStatics::GetGameMode(GetWorld()));
+	for(int32 TargetIndex = 0; TargetIndex < TargetCount; TargetIndex++)
+	{
+		AActor* Target = ResolvingQueue.Targets[TargetIndex].Get();
+		if(IsValid(Target))
+		{
+			const int32 EventOffset = TargetEventOffsets[TargetIndex];
+			ResolveTargetDamage(Target, TConstArrayView<int32>(SortedEventIndices.GetData() + EventOffset, TargetEventOffsets[TargetIndex + 1] - EventOffset), PRGameMode);
+		}
+	}
+
+	// 대상이 대미지에 반응한 대미지 이벤트를 대미지를 준 캐릭터에게 알립니다.
+	int32 AppliedEventCount = 0;
+	for(TConstSetBitIterator<> It(AppliedEvents); It; ++It)
+	{
+		const int32 EventIndex = It.GetIndex();
+		AppliedEventCount++;
+
+		APRBaseCharacter* InstigatorCharacter = Cast<APRBaseCharacter>(ResolvingQueue.Instigators[EventIndex].Get());
+		if(IsValid(InstigatorCharacter))
+		{
+			InstigatorCharacter->OnDamageApplied(ResolvingQueue.ImpactLocations[EventIndex]);
+		}
+	}
+
+	ResolvingQueue.Reset();
+
+	const double ResolveTime = FPlatformTime::Seconds() - ResolveStartTime;
+	DamageQueueStats.ResolvedFrames++;
+	DamageQueueStats.ResolvedEvents += EventCount;
+	DamageQueueStats.ResolvedTargets += TargetCount;
+	DamageQueueStats.AppliedEvents += AppliedEventCount;
+	DamageQueueStats.PeakEventsPerFrame = FMath::Max(DamageQueueStats.PeakEventsPerFrame, EventCount);
+	DamageQueueStats.LastResolveTime = ResolveTime;
+	DamageQueueStats.PeakResolveTime = FMath::Max(DamageQueueStats.PeakResolveTime, ResolveTime);
+	DamageQueueStats.TotalResolveTime += ResolveTime;
+
+	CSV_CUSTOM_STAT(PRDamageQueue, DamageEvents, EventCount, ECsvCustomStatOp::Accumulate);
+	CSV_CUSTOM_STAT(PRDamageQueue, DamageTargets, TargetCount, ECsvCustomStatOp::Accumulate);
+}
+
+void UPRDamageQueueSubsystem::ResetDamageQueueStats()
+{
+	DamageQueueStats = FPRDamageQueueStats();
+}
+
+void UPRDamageQueueSubsystem::ResolveTargetDamage(AActor* Target, TConstArrayView<int32> EventIndices, AProjectReplicaGameMode* PRGameMode)
+{
+	// PRBaseCharacter는 능력치와 상태를 한 번만 읽고 모든 대미지 이벤트를 처리합니다.
+	APRBaseCharacter* TargetCharacter = Cast<APRBaseCharacter>(Target);
+	if(IsValid(TargetCharacter) && TargetCharacter->GetDamageSystem())
+	{
+		TargetCharacter->GetDamageSystem()->TakeQueuedDamage(ResolvingQueue, EventIndices, PRGameMode, AppliedEvents);
+	}
+	else
+	{
+		// 그 외의 대상은 대미지 이벤트마다 PRDamageableInterface로 처리합니다.
+		// 대미지 스트림에는 대미지 큐에 추가할 때 기록했으므로 기록하지 않고 처리합니다.
+		for(const int32 EventIndex : EventIndices)
+		{
+			if(!IsValid(Target))
+			{
+				break;
+			}
+
+			if(FPRDamageableDispatch::ResolveDamage(Target, ResolvingQueue.GetDamageInfo(EventIndex)))
+			{
+				AppliedEvents[EventIndex] = true;
+			}
+		}
+	}
+
+	// 처리한 대미지 이벤트를 전투 텔레메트리에 기록합니다.
+	UPRCombatTelemetrySubsystem* CombatTelemetry = UPRCombatTelemetrySubsystem::GetRecording(this);
+	if(CombatTelemetry)
+	{
+		for(const int32 EventIndex : EventIndices)
+		{
+			CombatTelemetry->RecordDamageEvent(ResolvingQueue, EventIndex, AppliedEvents[EventIndex]);
+		}
+	}
+}
+#pragma endregion
@@ -0,0 +1,398 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Subsystems/PRDamageStreamSubsystem.h"
+#include "Subsystems/PRDamageQueueSubsystem.h"
+#include "Interfaces/PRDamageableInterface.h"
+#include "EngineUtils.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Paths.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+#include "Interfaces/PRInterfaceDispatch.h"
+
+// 대미지 스트림 재생의 프레임별 처리량을 기록하는 CSV 프로파일러 카테고리입니다.
+CSV_DEFINE_CATEGORY(PRDamageStream, true);
+
+/** 대미지 호출의 기록을 시작하는 콘솔 명령어입니다. */
+static FAutoConsoleCommandWithWorld StartDamageStreamRecordingCommand(
+	TEXT("PR.DamageStream.Record"),
+	TEXT("Starts recording damage calls. Usage: PR.DamageStream.Record"),
+	FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+	{
+		UPRDamageStreamSubsystem* DamageStreamSubsystem = World ? World->GetSubsystem<UPRDamageStreamSubsystem>() : nullptr;
+		if(DamageStreamSubsystem)
+		{
+			DamageStreamSubsystem->StartRecording();
+		}
+	}));
+
+/** 대미지 호출의 기록을 종료하고 파일에 저장하는 콘솔 명령어입니다. */
+static FAutoConsoleCommandWithWorldAndArgs StopDamageStreamRecordingCommand(
+	TEXT("PR.DamageStream.Stop"),
+	TEXT("Stops recording damage calls and saves them. Usage: PR.DamageStream.Stop [FilePath]"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		UPRDamageStreamSubsystem* DamageStreamSubsystem = World ? World->GetSubsystem<UPRDamageStreamSubsystem>() : nullptr;
+		if(DamageStreamSubsystem)
+		{
+			DamageStreamSubsystem->StopRecording(Args.Num() > 0 ? Args[0] : FString());
+		}
+	}));
+
+/** 파일에 저장한 대미지 호출을 재생하는 콘솔 명령어입니다. */
+static FAutoConsoleCommandWithWorldAndArgs ReplayDamageStreamCommand(
+	TEXT("PR.DamageStream.Replay"),
+	TEXT("Replays recorded damage calls as a benchmark. Usage: PR.DamageStream.Replay <FilePath> [PlaybackRate]"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		UPRDamageStreamSubsystem* DamageStreamSubsystem = World ? World->GetSubsystem<UPRDamageStreamSubsystem>() : nullptr;
+		if(DamageStreamSubsystem && Args.Num() > 0)
+		{
+			DamageStreamSubsystem->StartReplay(Args[0], Args.Num() > 1 ? FCString::Atof(*Args[1]) : 1.0f);
+		}
+	}));
+
+UPRDamageStreamSubsystem::UPRDamageStreamSubsystem()
+{
+	bRecording = false;
+	RecordingStartTime = 0.0;
+
+	bReplaying = false;
+	ReplayPlaybackRate = 1.0f;
+	ReplayStartTime = 0.0;
+	ReplayStartPlatformTime = 0.0;
+	LastFramePlatformTime = 0.0;
+	NextReplayEventIndex = 0;
+	bExitWhenReplayFinished = false;
+	ReplayStats = FPRDamageStreamReplayStats();
+}
+
+void UPRDamageStreamSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	// 명령줄로 기록 또는 재생을 시작합니다. 맵의 모든 액터가 BeginPlay를 실행한 후이므로 재생할 대상을 찾을 수 있습니다.
+	FString FilePath;
+	if(FParse::Value(FCommandLine::Get(), TEXT("PRDamageStreamReplay="), FilePath))
+	{
+		float PlaybackRate = 1.0f;
+		FParse::Value(FCommandLine::Get(), TEXT("PRDamageStreamReplayRate="), PlaybackRate);
+		bExitWhenReplayFinished = FParse::Param(FCommandLine::Get(), TEXT("PRDamageStreamReplayExit"));
+		if(!StartReplay(FilePath, PlaybackRate) && bExitWhenReplayFinished)
+		{
+			FPlatformMisc::RequestExitWithStatus(false, 1);
+		}
+	}
+	else if(FParse::Value(FCommandLine::Get(), TEXT("PRDamageStreamRecord="), AutoRecordFilePath))
+	{
+		StartRecording();
+	}
+}
+
+void UPRDamageStreamSubsystem::Deinitialize()
+{
+	if(IsRecording() && !AutoRecordFilePath.IsEmpty())
+	{
+		StopRecording(AutoRecordFilePath);
+	}
+
+	bRecording = false;
+	RecordedEvents.Empty();
+	StopReplay();
+
+	Super::Deinitialize();
+}
+
+void UPRDamageStreamSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if(!IsReplaying())
+	{
+		return;
+	}
+
+	// 이전 Tick부터의 실제 시간을 프레임 시간으로 측정합니다. 대미지, 대미지 숫자, 이펙트의 처리가 모두 포함됩니다.
+	const double CurrentPlatformTime = FPlatformTime::Seconds();
+	if(ReplayStats.Frames > 0)
+	{
+		ReplayStats.PeakFrameTime = FMath::Max(ReplayStats.PeakFrameTime, CurrentPlatformTime - LastFramePlatformTime);
+	}
+
+	LastFramePlatformTime = CurrentPlatformTime;
+	ReplayStats.Frames++;
+
+	DispatchReplayEvents();
+
+	// 마지막 대미지 호출이 대미지 큐와 이펙트에서 처리될 수 있도록 다음 프레임에 재생을 마칩니다.
+	if(NextReplayEventIndex >= ReplayEvents.Num())
+	{
+		FinishReplay();
+	}
+}
+
+TStatId UPRDamageStreamSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UPRDamageStreamSubsystem, STATGROUP_Tickables);
+}
+
+#pragma region Record
+void UPRDamageStreamSubsystem::StartRecording()
+{
+	if(IsReplaying())
+	{
+		PR_LOG_WARNING("Cannot record damage calls while replaying");
+		return;
+	}
+
+	RecordedEvents.Reset();
+	RecordingStartTime = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0;
+	bRecording = true;
+	PR_LOG(Log, "Damage stream recording started");
+}
+
+bool UPRDamageStreamSubsystem::StopRecording(const FString& FilePath)
+{
+	if(!IsRecording())
+	{
+		return false;
+	}
+
+	bRecording = false;
+
+	const FString NewFilePath = FilePath.IsEmpty()
+									? FPaths::ProfilingDir() / TEXT("DamageStream") / FString::Printf(TEXT("DamageStream-%s.prds"), *FDateTime::Now().ToString())
+									: FilePath;
+
+	const bool bSaved = SaveDamageStream(NewFilePath, RecordedEvents);
+	if(bSaved)
+	{
+		PR_LOG(Log, "Damage stream saved %d damage calls to %s", RecordedEvents.Num(), *NewFilePath);
+	}
+
+	RecordedEvents.Empty();
+	return bSaved;
+}
+
+void UPRDamageStreamSubsystem::CaptureDamage(const AActor* Target, const AActor* Instigator, const FPRDamageInfo& DamageInfo, bool bQueued)
+{
+	// 재생한 대미지 호출을 다시 기록하지 않습니다.
+	if(!IsRecording() || IsReplaying() || !IsValid(Target))
+	{
+		return;
+	}
+
+	FPRDamageStreamEvent& Event = RecordedEvents.AddDefaulted_GetRef();
+	Event.Time = GetWorld()->GetTimeSeconds() - RecordingStartTime;
+	Event.Target = Target->GetFName();
+	Event.Instigator = IsValid(Instigator) ? Instigator->GetFName() : NAME_None;
+	Event.bQueued = bQueued;
+	Event.DamageInfo = DamageInfo;
+}
+
+void UPRDamageStreamSubsystem::Capture(const AActor* Target, const AActor* Instigator, const FPRDamageInfo& DamageInfo, bool bQueued)
+{
+	UWorld* World = IsValid(Target) ? Target->GetWorld() : nullptr;
+	UPRDamageStreamSubsystem* DamageStreamSubsystem = World ? World->GetSubsystem<UPRDamageStreamSubsystem>() : nullptr;
+	if(DamageStreamSubsystem)
+	{
+		DamageStreamSubsystem->CaptureDamage(Target, Instigator, DamageInfo, bQueued);
+	}
+}
+#pragma endregion
+
+#pragma region Replay
+bool UPRDamageStreamSubsystem::StartReplay(const FString& FilePath, float PlaybackRate)
+{
+	UWorld* World = GetWorld();
+	if(!World || IsReplaying() || IsRecording())
+	{
+		PR_LOG_WARNING("Cannot replay a damage stream while recording or replaying");
+		return false;
+	}
+
+	if(!LoadDamageStream(FilePath, ReplayEvents))
+	{
+		return false;
+	}
+
+	// 재생하는 동안 이름으로 액터를 찾지 않도록 대상과 대미지를 준 액터를 한 번만 찾습니다.
+	TSet<FName> ReplayActorNames;
+	for(const FPRDamageStreamEvent& Event : ReplayEvents)
+	{
+		ReplayActorNames.Add(Event.Target);
+		ReplayActorNames.Add(Event.Instigator);
+	}
+
+	ReplayActors.Reset();
+	for(TActorIterator<AActor> Iterator(World); Iterator; ++Iterator)
+	{
+		if(ReplayActorNames.Contains(Iterator->GetFName()))
+		{
+			ReplayActors.Add(Iterator->GetFName(), *Iterator);
+		}
+	}
+
+	bReplaying = true;
+	ReplayPlaybackRate = PlaybackRate > 0.0f ? PlaybackRate : 1.0f;
+	ReplayStartTime = World->GetTimeSeconds();
+	ReplayStartPlatformTime = FPlatformTime::Seconds();
+	LastFramePlatformTime = ReplayStartPlatformTime;
+	NextReplayEventIndex = 0;
+	ReplayStats = FPRDamageStreamReplayStats();
+
+	PR_LOG(Log, "Damage stream replaying %d damage calls from %s (%d actors found)", ReplayEvents.Num(), *FilePath, ReplayActors.Num());
+	return true;
+}
+
+void UPRDamageStreamSubsystem::StopReplay()
+{
+	bReplaying = false;
+	ReplayEvents.Empty();
+	ReplayActors.Empty();
+	NextReplayEventIndex = 0;
+}
+
+void UPRDamageStreamSubsystem::DispatchReplayEvents()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UPRDamageStreamSubsystem::DispatchReplayEvents);
+
+	const double ReplayTime = (GetWorld()->GetTimeSeconds() - ReplayStartTime) * ReplayPlaybackRate;
+	UPRDamageQueueSubsystem* DamageQueueSubsystem = GetWorld()->GetSubsystem<UPRDamageQueueSubsystem>();
+
+	const double DispatchStartTime = FPlatformTime::Seconds();
+	int32 FrameReplayedEvents = 0;
+	while(ReplayEvents.IsValidIndex(NextReplayEventIndex) && ReplayEvents[NextReplayEventIndex].Time <= ReplayTime)
+	{
+		const FPRDamageStreamEvent& Event = ReplayEvents[NextReplayEventIndex++];
+		AActor* Target = ReplayActors.FindRef(Event.Target).Get();
+		if(!FPRClassCapabilityRegistry::IsDamageable(Target))
+		{
+			ReplayStats.MissingTargetEvents++;
+			continue;
+		}
+
+		// 기록할 때와 같은 경로로 대미지를 처리합니다.
+		if(Event.bQueued && DamageQueueSubsystem)
+		{
+			DamageQueueSubsystem->QueueDamage(ReplayActors.FindRef(Event.Instigator).Get(), Target, Event.DamageInfo);
+		}
+		else
+		{
+			FPRDamageableDispatch::TakeDamage(Target, Event.DamageInfo, ReplayActors.FindRef(Event.Instigator).Get());
+		}
+
+		FrameReplayedEvents++;
+	}
+
+	ReplayStats.ReplayedEvents += FrameReplayedEvents;
+	ReplayStats.DispatchTime += FPlatformTime::Seconds() - DispatchStartTime;
+	CSV_CUSTOM_STAT(PRDamageStream, ReplayedEvents, FrameReplayedEvents, ECsvCustomStatOp::Accumulate);
+}
+
+void UPRDamageStreamSubsystem::FinishReplay()
+{
+	ReplayStats.ReplayTime = FPlatformTime::Seconds() - ReplayStartPlatformTime;
+	ReplayStats.AverageFrameTime = ReplayStats.Frames > 0 ? ReplayStats.ReplayTime / ReplayStats.Frames : 0.0;
+
+	PR_LOG(Log, "Damage stream replay finished: %d damage calls (%d missing targets), %d frames in %.3f s, dispatch %.3f ms, average frame %.3f ms, peak frame %.3f ms",
+			ReplayStats.ReplayedEvents, ReplayStats.MissingTargetEvents, ReplayStats.Frames, ReplayStats.ReplayTime,
+			ReplayStats.DispatchTime * 1000.0, ReplayStats.AverageFrameTime * 1000.0, ReplayStats.PeakFrameTime * 1000.0);
+
+	StopReplay();
+	OnReplayFinished.Broadcast(ReplayStats);
+
+	if(bExitWhenReplayFinished)
+	{
+		FPlatformMisc::RequestExit(false);
+	}
+}
+#pragma endregion
+
+#pragma region File
+bool UPRDamageStreamSubsystem::SaveDamageStream(const FString& FilePath, TConstArrayView<FPRDamageStreamEvent> Events)
+{
+	TUniquePtr<FArchive> Writer(IFileManager::Get().CreateFileWriter(*FilePath));
+	if(!Writer)
+	{
+		PR_LOG_ERROR("Failed to create damage stream file %s", *FilePath);
+		return false;
+	}
+
+	uint32 Magic = DamageStreamFileMagic;
+	uint32 Version = DamageStreamFileVersion;
+	int32 Count = Events.Num();
+	*Writer << Magic << Version << Count;
+	for(const FPRDamageStreamEvent& Event : Events)
+	{
+		double Time = Event.Time;
+		FString Target = Event.Target.ToString();
+		FString Instigator = Event.Instigator.IsNone() ? FString() : Event.Instigator.ToString();
+		bool bQueued = Event.bQueued;
+		FPRDamageInfo DamageInfo = Event.DamageInfo;
+		uint8 DamageType = static_cast<uint8>(DamageInfo.DamageType);
+		uint8 ElementType = static_cast<uint8>(DamageInfo.DamageElementType);
+		uint8 DamageResponse = static_cast<uint8>(DamageInfo.DamageResponse);
+		*Writer << Time << Target << Instigator << bQueued;
+		*Writer << DamageInfo.Amount << DamageType << ElementType << DamageResponse << DamageInfo.ImpactLocation;
+		*Writer << DamageInfo.bIsCritical << DamageInfo.bShouldDamageInvincible << DamageInfo.bCanBeBlocked << DamageInfo.bCanBeParried << DamageInfo.bShouldForceInterrupt;
+	}
+
+	return Writer->Close();
+}
+
+bool UPRDamageStreamSubsystem::LoadDamageStream(const FString& FilePath, TArray<FPRDamageStreamEvent>& OutEvents)
+{
+	OutEvents.Reset();
+
+	TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*FilePath));
+	if(!Reader)
+	{
+		PR_LOG_ERROR("Failed to open damage stream file %s", *FilePath);
+		return false;
+	}
+
+	uint32 Magic = 0;
+	uint32 Version = 0;
+	int32 Count = 0;
+	*Reader << Magic << Version << Count;
+	if(Magic != DamageStreamFileMagic || Version != DamageStreamFileVersion || Count < 0)
+	{
+		PR_LOG_ERROR("%s is not a damage stream file (version %u)", *FilePath, Version);
+		return false;
+	}
+
+	OutEvents.Reserve(Count);
+	for(int32 Index = 0; Index < Count && !Reader->IsError(); Index++)
+	{
+		FPRDamageStreamEvent& Event = OutEvents.AddDefaulted_GetRef();
+		FString Target;
+		FString Instigator;
+		uint8 DamageType = 0;
+		uint8 ElementType = 0;
+		uint8 DamageResponse = 0;
+		FPRDamageInfo& DamageInfo = Event.DamageInfo;
+		*Reader << Event.Time << Target << Instigator << Event.bQueued;
+		*Reader << DamageInfo.Amount << DamageType << ElementType << DamageResponse << DamageInfo.ImpactLocation;
+		*Reader << DamageInfo.bIsCritical << DamageInfo.bShouldDamageInvincible << DamageInfo.bCanBeBlocked << DamageInfo.bCanBeParried << DamageInfo.bShouldForceInterrupt;
+
+		Event.Target = FName(*Target);
+		Event.Instigator = Instigator.IsEmpty() ? NAME_None : FName(*Instigator);
+		DamageInfo.DamageType = static_cast<EPRDamageType>(DamageType);
+		DamageInfo.DamageElementType = static_cast<EPRElementType>(ElementType);
+		DamageInfo.DamageResponse = static_cast<EPRDamageResponse>(DamageResponse);
+	}
+
+	if(Reader->IsError())
+	{
+		PR_LOG_ERROR("Damage stream file %s is truncated", *FilePath);
+		OutEvents.Reset();
+		return false;
+	}
+
+	return true;
+}
+#pragma endregion
@@ -0,0 +1,475 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Subsystems/PRDamageableSpatialHashSubsystem.h"
+#include "Interfaces/PRDamageableInterface.h"
+#include "Interfaces/PRClassCapabilityRegistry.h"
+#include "Engine/Level.h"
+#include "EngineUtils.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+UPRDamageableSpatialHashSubsystem::UPRDamageableSpatialHashSubsystem()
+{
+	CellSize = 500.0f;
+	Cells.Empty();
+	SpatialHashStats = FPRDamageableSpatialHashStats();
+	Registrations.Empty();
+	MaxEntryRadius = 0.0f;
+}
+
+void UPRDamageableSpatialHashSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	// 새로 Spawn되는 액터를 등록합니다.
+	ActorSpawnedHandle = GetWorld()->AddOnActorSpawnedHandler(FOnActorSpawned::FDelegate::CreateUObject(this, &UPRDamageableSpatialHashSubsystem::OnActorSpawned));
+
+	// 스트리밍된 레벨의 액터는 Spawn 델리게이트가 호출되지 않으므로 레벨 단위로 등록합니다.
+	LevelAddedHandle = FWorldDelegates::LevelAddedToWorld.AddUObject(this, &UPRDamageableSpatialHashSubsystem::OnLevelAddedToWorld);
+	LevelRemovedHandle = FWorldDelegates::LevelRemovedFromWorld.AddUObject(this, &UPRDamageableSpatialHashSubsystem::OnLevelRemovedFromWorld);
+}
+
+void UPRDamageableSpatialHashSubsystem::Deinitialize()
+{
+	GetWorld()->RemoveOnActorSpawnedHandler(ActorSpawnedHandle);
+	FWorldDelegates::LevelAddedToWorld.Remove(LevelAddedHandle);
+	FWorldDelegates::LevelRemovedFromWorld.Remove(LevelRemovedHandle);
+
+	// 등록한 모든 액터의 델리게이트를 제거합니다.
+	for(const auto& CellEntry : Cells)
+	{
+		for(const FPRDamageableCellEntry& Entry : CellEntry.Value.Entries)
+		{
+			const FPRDamageableRegistration* Registration = Registrations.Find(Entry.Actor.Get());
+			if(IsValid(Entry.Actor) && Registration)
+			{
+				if(Entry.Actor->GetRootComponent())
+				{
+					Entry.Actor->GetRootComponent()->TransformUpdated.Remove(Registration->TransformUpdatedHandle);
+				}
+
+				Entry.Actor->OnDestroyed.RemoveDynamic(this, &UPRDamageableSpatialHashSubsystem::OnDamageableDestroyed);
+			}
+		}
+	}
+
+	Cells.Empty();
+	Registrations.Empty();
+	MaxEntryRadius = 0.0f;
+
+	Super::Deinitialize();
+}
+
+void UPRDamageableSpatialHashSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	// 레벨에 배치된 액터를 등록합니다.
+	for(TActorIterator<AActor> It(&InWorld); It; ++It)
+	{
+		RegisterDamageable(*It);
+	}
+}
+
+void UPRDamageableSpatialHashSubsystem::RegisterDamageable(AActor* Actor)
+{
+	if(!IsValid(Actor)
+		|| !Actor->GetRootComponent()
+		|| !FPRClassCapabilityRegistry::IsDamageableClass(Actor->GetClass())
+		|| Registrations.Contains(Actor))
+	{
+		return;
+	}
+
+	const FVector Location = Actor->GetActorLocation();
+	float Radius = 0.0f;
+	float HalfHeight = 0.0f;
+	Actor->GetSimpleCollisionCylinder(Radius, HalfHeight);
+
+	FPRDamageableRegistration& Registration = Registrations.Add(Actor);
+	Registration.Cell = GetCell(Location);
+	Registration.TransformUpdatedHandle = Actor->GetRootComponent()->TransformUpdated.AddUObject(this, &UPRDamageableSpatialHashSubsystem::OnDamageableTransformUpdated);
+	Actor->OnDestroyed.AddUniqueDynamic(this, &UPRDamageableSpatialHashSubsystem::OnDamageableDestroyed);
+
+	Cells.FindOrAdd(Registration.Cell).Entries.Emplace(FPRDamageableCellEntry(Actor, Location, Radius, HalfHeight));
+	MaxEntryRadius = FMath::Max(MaxEntryRadius, Radius);
+}
+
+void UPRDamageableSpatialHashSubsystem::UnregisterDamageable(AActor* Actor)
+{
+	FPRDamageableRegistration Registration;
+	if(!Registrations.RemoveAndCopyValue(Actor, Registration))
+	{
+		return;
+	}
+
+	FPRDamageableCell* Cell = Cells.Find(Registration.Cell);
+	if(Cell)
+	{
+		Cell->Entries.RemoveAllSwap([Actor](const FPRDamageableCellEntry& Entry)
+		{
+			return Entry.Actor == Actor;
+		});
+
+		if(Cell->Entries.Num() == 0)
+		{
+			Cells.Remove(Registration.Cell);
+		}
+	}
+
+	if(IsValid(Actor))
+	{
+		if(Actor->GetRootComponent())
+		{
+			Actor->GetRootComponent()->TransformUpdated.Remove(Registration.TransformUpdatedHandle);
+		}
+
+		Actor->OnDestroyed.RemoveDynamic(this, &UPRDamageableSpatialHashSubsystem::OnDamageableDestroyed);
+	}
+}
+
+FIntPoint UPRDamageableSpatialHashSubsystem::GetCell(const FVector& Location) const
+{
+	return FIntPoint(FMath::FloorToInt32(Location.X / CellSize), FMath::FloorToInt32(Location.Y / CellSize));
+}
+
+template<typename FunctionType>
+void UPRDamageableSpatialHashSubsystem::ForEachEntryInBounds(const FBox& Bounds, FunctionType&& Function)
+{
+	// 셀의 경계에 걸친 액터를 검색하도록 액터의 최대 반지름만큼 영역을 넓힙니다.
+	const FIntPoint MinCell = GetCell(Bounds.Min - FVector(MaxEntryRadius));
+	const FIntPoint MaxCell = GetCell(Bounds.Max + FVector(MaxEntryRadius));
+	for(int32 CellX = MinCell.X; CellX <= MaxCell.X; CellX++)
+	{
+		for(int32 CellY = MinCell.Y; CellY <= MaxCell.Y; CellY++)
+		{
+			const FPRDamageableCell* Cell = Cells.Find(FIntPoint(CellX, CellY));
+			if(Cell)
+			{
+				SpatialHashStats.TestedEntries += Cell->Entries.Num();
+				for(const FPRDamageableCellEntry& Entry : Cell->Entries)
+				{
+					Function(Entry);
+				}
+			}
+		}
+	}
+}
+
+int32 UPRDamageableSpatialHashSubsystem::QuerySphere(const FVector& Center, float Radius, AActor* IgnoreActor, TArray<FPRDamageableQueryResult>& OutResults)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UPRDamageableSpatialHashSubsystem::QuerySphere);
+	const double QueryStartTime = FPlatformTime::Seconds();
+	const int32 StartNum = OutResults.Num();
+
+	ForEachEntryInBounds(FBox(Center - FVector(Radius), Center + FVector(Radius)), [&](const FPRDamageableCellEntry& Entry)
+	{
+		if(!IsQueryableEntry(Entry, IgnoreActor))
+		{
+			return;
+		}
+
+		const FVector AxisPoint = Entry.GetClosestAxisPoint(Center);
+		const FVector ToCenter = Center - AxisPoint;
+		const float Distance = ToCenter.Size();
+		if(Distance <= Radius + Entry.Radius)
+		{
+			const FVector ImpactPoint = AxisPoint + ToCenter.GetSafeNormal() * FMath::Min(Entry.Radius, Distance);
+			OutResults.Emplace(FPRDamageableQueryResult(Entry.Actor, ImpactPoint, Distance));
+		}
+	});
+
+	const int32 FoundActors = OutResults.Num() - StartNum;
+	SpatialHashStats.Queries++;
+	SpatialHashStats.FoundActors += FoundActors;
+	SpatialHashStats.TotalQueryTime += FPlatformTime::Seconds() - QueryStartTime;
+
+	return FoundActors;
+}
+
+int32 UPRDamageableSpatialHashSubsystem::QueryCylinder(const FVector& Base, float Radius, float Height, AActor* IgnoreActor, TArray<FPRDamageableQueryResult>& OutResults)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UPRDamageableSpatialHashSubsystem::QueryCylinder);
+	const double QueryStartTime = FPlatformTime::Seconds();
+	const int32 StartNum = OutResults.Num();
+
+	const float Top = Base.Z + FMath::Max(Height, 0.0f);
+	ForEachEntryInBounds(FBox(Base - FVector(Radius, Radius, 0.0f), FVector(Base.X + Radius, Base.Y + Radius, Top)), [&](const FPRDamageableCellEntry& Entry)
+	{
+		if(!IsQueryableEntry(Entry, IgnoreActor))
+		{
+			return;
+		}
+
+		// 액터 캡슐의 높이 범위가 원기둥과 겹치는지 검사합니다.
+		if(Entry.Location.Z + Entry.HalfHeight < Base.Z || Entry.Location.Z - Entry.HalfHeight > Top)
+		{
+			return;
+		}
+
+		const FVector2D ToBase = FVector2D(Base) - FVector2D(Entry.Location);
+		const float Distance = ToBase.Size();
+		if(Distance <= Radius + Entry.Radius)
+		{
+			const FVector2D ImpactPoint2D = FVector2D(Entry.Location) + ToBase.GetSafeNormal() * FMath::Min(Entry.Radius, Distance);
+			const float ImpactZ = FMath::Clamp(Entry.Location.Z, FMath::Max(Base.Z, Entry.Location.Z - Entry.HalfHeight), FMath::Min(Top, Entry.Location.Z + Entry.HalfHeight));
+			OutResults.Emplace(FPRDamageableQueryResult(Entry.Actor, FVector(ImpactPoint2D, ImpactZ), Distance));
+		}
+	});
+
+	const int32 FoundActors = OutResults.Num() - StartNum;
+	SpatialHashStats.Queries++;
+	SpatialHashStats.FoundActors += FoundActors;
+	SpatialHashStats.TotalQueryTime += FPlatformTime::Seconds() - QueryStartTime;
+
+	return FoundActors;
+}
+
+int32 UPRDamageableSpatialHashSubsystem::QueryCapsule(const FVector& Start, const FVector& End, float Radius, AActor* IgnoreActor, TArray<FPRDamageableQueryResult>& OutResults)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UPRDamageableSpatialHashSubsystem::QueryCapsule);
+	const double QueryStartTime = FPlatformTime::Seconds();
+	const int32 StartNum = OutResults.Num();
+
+	FBox Bounds(Start.ComponentMin(End), Start.ComponentMax(End));
+	ForEachEntryInBounds(Bounds.ExpandBy(Radius), [&](const FPRDamageableCellEntry& Entry)
+	{
+		if(!IsQueryableEntry(Entry, IgnoreActor))
+		{
+			return;
+		}
+
+		// 검색 캡슐의 중심선과 액터 캡슐의 중심선 사이의 가장 가까운 위치를 구합니다.
+		FVector ClosestPoint;
+		FVector AxisPoint;
+		FMath::SegmentDistToSegmentSafe(Start, End, Entry.GetAxisBottom(), Entry.GetAxisTop(), ClosestPoint, AxisPoint);
+
+		const FVector ToClosestPoint = ClosestPoint - AxisPoint;
+		const float Distance = ToClosestPoint.Size();
+		if(Distance <= Radius + Entry.Radius)
+		{
+			const FVector ImpactPoint = AxisPoint + ToClosestPoint.GetSafeNormal() * FMath::Min(Entry.Radius, Distance);
+			OutResults.Emplace(FPRDamageableQueryResult(Entry.Actor, ImpactPoint, FVector::Dist(Start, ClosestPoint)));
+		}
+	});
+
+	// Trace와 같이 시작점에서 가까운 순서로 정렬합니다.
+	const int32 FoundActors = OutResults.Num() - StartNum;
+	TArrayView<FPRDamageableQueryResult>(OutResults.GetData() + StartNum, FoundActors).StableSort([](const FPRDamageableQueryResult& A, const FPRDamageableQueryResult& B)
+	{
+		return A.Distance < B.Distance;
+	});
+
+	SpatialHashStats.Queries++;
+	SpatialHashStats.FoundActors += FoundActors;
+	SpatialHashStats.TotalQueryTime += FPlatformTime::Seconds() - QueryStartTime;
+
+	return FoundActors;
+}
+
+int32 UPRDamageableSpatialHashSubsystem::QueryCone(const FVector& Origin, const FVector& Direction, float Length, float HalfAngle, AActor* IgnoreActor, TArray<FPRDamageableQueryResult>& OutResults)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UPRDamageableSpatialHashSubsystem::QueryCone);
+	const double QueryStartTime = FPlatformTime::Seconds();
+	const int32 StartNum = OutResults.Num();
+
+	const FVector ConeDirection = Direction.GetSafeNormal();
+	const float TanHalfAngle = FMath::Tan(FMath::DegreesToRadians(FMath::Clamp(HalfAngle, 0.0f, 89.0f)));
+
+	// 원뿔은 꼭짓점을 중심으로 하고 길이를 반지름으로 하는 구 안에 있습니다.
+	ForEachEntryInBounds(FBox(Origin - FVector(Length), Origin + FVector(Length)), [&](const FPRDamageableCellEntry& Entry)
+	{
+		if(!IsQueryableEntry(Entry, IgnoreActor))
+		{
+			return;
+		}
+
+		// 액터 캡슐의 중심선에서 원뿔의 중심축과 가장 가까운 위치를 검사합니다.
+		FVector ConeAxisPoint;
+		FVector AxisPoint;
+		FMath::SegmentDistToSegmentSafe(Origin, Origin + ConeDirection * Length, Entry.GetAxisBottom(), Entry.GetAxisTop(), ConeAxisPoint, AxisPoint);
+
+		const FVector ToEntry = AxisPoint - Origin;
+		const float AxisDistance = FVector::DotProduct(ToEntry, ConeDirection);
+		if(AxisDistance < -Entry.Radius || AxisDistance > Length + Entry.Radius)
+		{
+			return;
+		}
+
+		// 중심축에서 떨어진 거리를 해당 위치의 원뿔 반지름과 비교합니다.
+		const float AxisOffset = (ToEntry - ConeDirection * AxisDistance).Size();
+		if(AxisOffset <= FMath::Max(AxisDistance, 0.0f) * TanHalfAngle + Entry.Radius)
+		{
+			const float Distance = ToEntry.Size();
+			const FVector ImpactPoint = AxisPoint - ToEntry.GetSafeNormal() * FMath::Min(Entry.Radius, Distance);
+			OutResults.Emplace(FPRDamageableQueryResult(Entry.Actor, ImpactPoint, Distance));
+		}
+	});
+
+	const int32 FoundActors = OutResults.Num() - StartNum;
+	SpatialHashStats.Queries++;
+	SpatialHashStats.FoundActors += FoundActors;
+	SpatialHashStats.TotalQueryTime += FPlatformTime::Seconds() - QueryStartTime;
+
+	return FoundActors;
+}
+
+FPRDamageableQueryBenchmarkResult UPRDamageableSpatialHashSubsystem::BenchmarkSphereQuery(const FVector& Center, float Radius, int32 Iterations)
+{
+	FPRDamageableQueryBenchmarkResult BenchmarkResult;
+	BenchmarkResult.Iterations = FMath::Max(Iterations, 1);
+
+	// 공간 해시로 검색합니다.
+	TArray<FPRDamageableQueryResult> QueryResults;
+	double StartTime = FPlatformTime::Seconds();
+	for(int32 Index = 0; Index < BenchmarkResult.Iterations; Index++)
+	{
+		QueryResults.Reset();
+		BenchmarkResult.SpatialHashFoundActors = QuerySphere(Center, Radius, nullptr, QueryResults);
+	}
+
+	BenchmarkResult.SpatialHashTime = FPlatformTime::Seconds() - StartTime;
+
+	// 기존의 공격과 같은 방식으로 물리 Trace로 검색하고 PRDamageableInterface로 거릅니다.
+	TArray<TEnumAsByte<EObjectTypeQuery>> ObjectTypes;
+	ObjectTypes.Emplace(EObjectTypeQuery::ObjectTypeQuery3);
+	const TArray<AActor*> ActorsToIgnore;
+	TArray<FHitResult> HitResults;
+	TSet<AActor*> UniqueActors;
+	StartTime = FPlatformTime::Seconds();
+	for(int32 Index = 0; Index < BenchmarkResult.Iterations; Index++)
+	{
+		HitResults.Reset();
+		UniqueActors.Reset();
+		UKismetSystemLibrary::SphereTraceMultiForObjects(GetWorld(), Center, Center, Radius, ObjectTypes, false, ActorsToIgnore, EDrawDebugTrace::None, HitResults, true);
+		for(const FHitResult& HitResult : HitResults)
+		{
+			if(IsValid(HitResult.GetActor())
+				&& HitResult.GetActor()->GetClass()->ImplementsInterface(UPRDamageableInterface::StaticClass()))
+			{
+				UniqueActors.Emplace(HitResult.GetActor());
+			}
+		}
+
+		BenchmarkResult.PhysicsTraceFoundActors = UniqueActors.Num();
+	}
+
+	BenchmarkResult.PhysicsTraceTime = FPlatformTime::Seconds() - StartTime;
+
+	PR_LOG(Log, "Sphere query x%d: SpatialHash %.3f ms (%d actors), PhysicsTrace %.3f ms (%d actors)",
+		BenchmarkResult.Iterations,
+		BenchmarkResult.SpatialHashTime * 1000.0,
+		BenchmarkResult.SpatialHashFoundActors,
+		BenchmarkResult.PhysicsTraceTime * 1000.0,
+		BenchmarkResult.PhysicsTraceFoundActors);
+
+	return BenchmarkResult;
+}
+
+void UPRDamageableSpatialHashSubsystem::ResetSpatialHashStats()
+{
+	SpatialHashStats = FPRDamageableSpatialHashStats();
+}
+
+bool UPRDamageableSpatialHashSubsystem::IsQueryableEntry(const FPRDamageableCellEntry& Entry, const AActor* IgnoreActor)
+{
+	return IsValid(Entry.Actor) && Entry.Actor != IgnoreActor && Entry.Actor->GetActorEnableCollision();
+}
+
+void UPRDamageableSpatialHashSubsystem::OnActorSpawned(AActor* SpawnedActor)
+{
+	RegisterDamageable(SpawnedActor);
+}
+
+void UPRDamageableSpatialHashSubsystem::OnLevelAddedToWorld(ULevel* Level, UWorld* InWorld)
+{
+	// BeginPlay 전에 추가된 레벨의 액터는 OnWorldBeginPlay에서 등록합니다.
+	if(!Level || InWorld != GetWorld() || !InWorld->HasBegunPlay())
+	{
+		return;
+	}
+
+	for(AActor* Actor : Level->Actors)
+	{
+		RegisterDamageable(Actor);
+	}
+}
+
+void UPRDamageableSpatialHashSubsystem::OnLevelRemovedFromWorld(ULevel* Level, UWorld* InWorld)
+{
+	// 월드 전체를 정리할 때는 Level이 nullptr이며, Deinitialize에서 모두 제거합니다.
+	if(!Level || InWorld != GetWorld())
+	{
+		return;
+	}
+
+	for(AActor* Actor : Level->Actors)
+	{
+		if(Actor)
+		{
+			UnregisterDamageable(Actor);
+		}
+	}
+}
+
+void UPRDamageableSpatialHashSubsystem::OnDamageableTransformUpdated(USceneComponent* UpdatedComponent, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport)
+{
+	AActor* Actor = UpdatedComponent ? UpdatedComponent->GetOwner() : nullptr;
+	FPRDamageableRegistration* Registration = Registrations.Find(Actor);
+	if(!Registration)
+	{
+		return;
+	}
+
+	const FVector NewLocation = UpdatedComponent->GetComponentLocation();
+	const FIntPoint NewCell = GetCell(NewLocation);
+
+	// 같은 셀 안에서 이동한 경우 위치만 갱신합니다.
+	FPRDamageableCell* OldCell = Cells.Find(Registration->Cell);
+	if(NewCell == Registration->Cell && OldCell)
+	{
+		FPRDamageableCellEntry* Entry = OldCell->Entries.FindByPredicate([Actor](const FPRDamageableCellEntry& CellEntry)
+		{
+			return CellEntry.Actor == Actor;
+		});
+
+		if(Entry)
+		{
+			Entry->Location = NewLocation;
+			return;
+		}
+	}
+
+	// 셀이 바뀐 경우 이전 셀에서 제거하고 새로운 셀에 추가합니다.
+	float Radius = 0.0f;
+	float HalfHeight = 0.0f;
+	Actor->GetSimpleCollisionCylinder(Radius, HalfHeight);
+	if(OldCell)
+	{
+		const int32 EntryIndex = OldCell->Entries.IndexOfByPredicate([Actor](const FPRDamageableCellEntry& CellEntry)
+		{
+			return CellEntry.Actor == Actor;
+		});
+
+		if(EntryIndex != INDEX_NONE)
+		{
+			Radius = OldCell->Entries[EntryIndex].Radius;
+			HalfHeight = OldCell->Entries[EntryIndex].HalfHeight;
+			OldCell->Entries.RemoveAtSwap(EntryIndex);
+		}
+
+		if(OldCell->Entries.Num() == 0)
+		{
+			Cells.Remove(Registration->Cell);
+		}
+	}
+
+	Registration->Cell = NewCell;
+	Cells.FindOrAdd(NewCell).Entries.Emplace(FPRDamageableCellEntry(Actor, NewLocation, Radius, HalfHeight));
+	SpatialHashStats.CellMoves++;
+}
+
+void UPRDamageableSpatialHashSubsystem::OnDamageableDestroyed(AActor* DestroyedActor)
+{
+	UnregisterDamageable(DestroyedActor);
+}
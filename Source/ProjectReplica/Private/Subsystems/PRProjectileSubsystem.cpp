@@ -0,0 +1,495 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Subsystems/PRProjectileSubsystem.h"
+#include "Subsystems/PRAsyncTraceSubsystem.h"
+#include "Subsystems/PRDamageQueueSubsystem.h"
+#include "Interfaces/PRDamageableInterface.h"
+#include "Interfaces/PRPoolableInterface.h"
+#include "Objects/PRPooledObject.h"
+#include "Async/ParallelFor.h"
+#include "GameFramework/PlayerController.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+#include "Interfaces/PRInterfaceDispatch.h"
+
+// 발사체의 프레임별 처리량과 처리 시간을 기록하는 CSV 프로파일러 카테고리입니다.
+CSV_DEFINE_CATEGORY(PRProjectile, true);
+
+#pragma region ProjectileArrays
+int32 FPRProjectileArrays::Add(int32 ProjectileID, AActor* Instigator, AActor* HomingTarget, const FVector& Location, const FVector& Velocity, const FPRProjectileSettings& Settings)
+{
+	Instigators.Emplace(Instigator);
+	HomingTargets.Emplace(HomingTarget);
+	Locations.Emplace(Location);
+	PreviousLocations.Emplace(Location);
+	Velocities.Emplace(Velocity);
+	Speeds.Emplace(Settings.Speed);
+	GravityScales.Emplace(Settings.GravityScale);
+	HomingAccelerations.Emplace(IsValid(HomingTarget) ? Settings.HomingAcceleration : 0.0f);
+	Radii.Emplace(Settings.Radius);
+	RemainingLifespans.Emplace(Settings.Lifespan);
+	CollideWithWorld.Emplace(Settings.bCollideWithWorld);
+	PendingWorldTraces.Emplace(0);
+	DamageInfos.Emplace(Settings.DamageInfo);
+	VisualClasses.Emplace(Settings.VisualClass);
+	Visuals.Emplace(nullptr);
+
+	return IDs.Emplace(ProjectileID);
+}
+
+void FPRProjectileArrays::RemoveAtSwap(int32 Index)
+{
+	IDs.RemoveAtSwap(Index);
+	Instigators.RemoveAtSwap(Index);
+	HomingTargets.RemoveAtSwap(Index);
+	Locations.RemoveAtSwap(Index);
+	PreviousLocations.RemoveAtSwap(Index);
+	Velocities.RemoveAtSwap(Index);
+	Speeds.RemoveAtSwap(Index);
+	GravityScales.RemoveAtSwap(Index);
+	HomingAccelerations.RemoveAtSwap(Index);
+	Radii.RemoveAtSwap(Index);
+	RemainingLifespans.RemoveAtSwap(Index);
+	CollideWithWorld.RemoveAtSwap(Index);
+	PendingWorldTraces.RemoveAtSwap(Index);
+	DamageInfos.RemoveAtSwap(Index);
+	VisualClasses.RemoveAtSwap(Index);
+	Visuals.RemoveAtSwap(Index);
+}
+
+void FPRProjectileArrays::Empty()
+{
+	IDs.Empty();
+	Instigators.Empty();
+	HomingTargets.Empty();
+	Locations.Empty();
+	PreviousLocations.Empty();
+	Velocities.Empty();
+	Speeds.Empty();
+	GravityScales.Empty();
+	HomingAccelerations.Empty();
+	Radii.Empty();
+	RemainingLifespans.Empty();
+	CollideWithWorld.Empty();
+	PendingWorldTraces.Empty();
+	DamageInfos.Empty();
+	VisualClasses.Empty();
+	Visuals.Empty();
+}
+#pragma endregion
+
+#pragma region ProjectileSubsystem
+UPRProjectileSubsystem::UPRProjectileSubsystem()
+{
+	VisualCullDistance = 5000.0f;
+	MaxActiveVisuals = 256;
+	ProjectilesPerTask = 256;
+	ProjectileStats = FPRProjectileStats();
+	NextProjectileID = 0;
+	ActiveVisualCount = 0;
+}
+
+void UPRProjectileSubsystem::Deinitialize()
+{
+	Projectiles.Empty();
+	ProjectileIndices.Empty();
+	VisualPools.Empty();
+	HomingTargetLocations.Empty();
+	RemovedIndices.Empty();
+	QueryResults.Empty();
+	ActiveVisualCount = 0;
+
+	Super::Deinitialize();
+}
+
+void UPRProjectileSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if(Projectiles.Num() == 0)
+	{
+		return;
+	}
+
+	CSV_SCOPED_TIMING_STAT(PRProjectile, TickProjectiles);
+	const double SimulationStartTime = FPlatformTime::Seconds();
+
+	SimulateProjectiles(DeltaTime);
+	ResolveProjectileHits();
+	RequestWorldTraces();
+	UpdateVisuals();
+
+	const double SimulationTime = FPlatformTime::Seconds() - SimulationStartTime;
+	ProjectileStats.LastSimulationTime = SimulationTime;
+	ProjectileStats.PeakSimulationTime = FMath::Max(ProjectileStats.PeakSimulationTime, SimulationTime);
+	ProjectileStats.PeakActiveVisuals = FMath::Max(ProjectileStats.PeakActiveVisuals, ActiveVisualCount);
+
+	CSV_CUSTOM_STAT(PRProjectile, Projectiles, Projectiles.Num(), ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(PRProjectile, ActiveVisuals, ActiveVisualCount, ECsvCustomStatOp::Set);
+}
+
+TStatId UPRProjectileSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UPRProjectileSubsystem, STATGROUP_Tickables);
+}
+
+int32 UPRProjectileSubsystem::SpawnProjectile(AActor* Instigator, const FVector& Location, const FVector& Direction, const FPRProjectileSettings& Settings, AActor* HomingTarget)
+{
+	const int32 ProjectileID = NextProjectileID++;
+	const int32 Index = Projectiles.Add(ProjectileID, Instigator, HomingTarget, Location, Direction.GetSafeNormal() * Settings.Speed, Settings);
+	ProjectileIndices.Add(ProjectileID, Index);
+
+	ProjectileStats.SpawnedProjectiles++;
+	ProjectileStats.PeakProjectiles = FMath::Max(ProjectileStats.PeakProjectiles, Projectiles.Num());
+
+	return ProjectileID;
+}
+
+void UPRProjectileSubsystem::DestroyProjectile(int32 ProjectileID)
+{
+	const int32* Index = ProjectileIndices.Find(ProjectileID);
+	if(Index)
+	{
+		RemoveProjectileAt(*Index);
+	}
+}
+
+void UPRProjectileSubsystem::ResetProjectileStats()
+{
+	ProjectileStats = FPRProjectileStats();
+	ProjectileStats.PeakProjectiles = Projectiles.Num();
+	ProjectileStats.PeakActiveVisuals = ActiveVisualCount;
+}
+
+void UPRProjectileSubsystem::SimulateProjectiles(float DeltaTime)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UPRProjectileSubsystem::SimulateProjectiles);
+
+	const int32 ProjectileCount = Projectiles.Num();
+
+	// 작업 스레드에서 액터에 접근하지 않도록 유도 대상의 위치를 게임 스레드에서 모아둡니다.
+	HomingTargetLocations.SetNumUninitialized(ProjectileCount, false);
+	for(int32 Index = 0; Index < ProjectileCount; Index++)
+	{
+		if(Projectiles.HomingAccelerations[Index] <= 0.0f)
+		{
+			continue;
+		}
+
+		const AActor* HomingTarget = Projectiles.HomingTargets[Index].Get();
+		if(IsValid(HomingTarget))
+		{
+			HomingTargetLocations[Index] = HomingTarget->GetActorLocation();
+		}
+		else
+		{
+			// 유도 대상이 사라지면 현재 방향으로 계속 이동합니다.
+			Projectiles.HomingAccelerations[Index] = 0.0f;
+		}
+	}
+
+	const float GravityZ = GetWorld()->GetGravityZ();
+	const int32 TaskSize = FMath::Max(ProjectilesPerTask, 1);
+	const int32 TaskCount = FMath::DivideAndRoundUp(ProjectileCount, TaskSize);
+	ParallelFor(TaskCount, [this, DeltaTime, GravityZ, TaskSize, ProjectileCount](int32 TaskIndex)
+	{
+		const int32 StartIndex = TaskIndex * TaskSize;
+		const int32 EndIndex = FMath::Min(StartIndex + TaskSize, ProjectileCount);
+		for(int32 Index = StartIndex; Index < EndIndex; Index++)
+		{
+			const FVector Location = Projectiles.Locations[Index];
+
+			// 수명이 다해 Trace 결과를 기다리는 발사체는 더 이동하지 않습니다.
+			if(Projectiles.RemainingLifespans[Index] <= 0.0f)
+			{
+				Projectiles.PreviousLocations[Index] = Location;
+				continue;
+			}
+			FVector Velocity = Projectiles.Velocities[Index];
+
+			const float HomingAcceleration = Projectiles.HomingAccelerations[Index];
+			if(HomingAcceleration > 0.0f)
+			{
+				// 유도 대상을 향해 가속하고 속력은 유지합니다.
+				Velocity += (HomingTargetLocations[Index] - Location).GetSafeNormal() * HomingAcceleration * DeltaTime;
+				Velocity = Velocity.GetSafeNormal() * Projectiles.Speeds[Index];
+			}
+
+			Velocity.Z += GravityZ * Projectiles.GravityScales[Index] * DeltaTime;
+
+			Projectiles.PreviousLocations[Index] = Location;
+			Projectiles.Locations[Index] = Location + Velocity * DeltaTime;
+			Projectiles.Velocities[Index] = Velocity;
+			Projectiles.RemainingLifespans[Index] -= DeltaTime;
+		}
+	}, TaskCount == 1 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+}
+
+void UPRProjectileSubsystem::ResolveProjectileHits()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UPRProjectileSubsystem::ResolveProjectileHits);
+
+	// 비동기 Trace를 사용할 수 없으면 월드의 지형과 충돌하는 발사체도 바로 처리합니다.
+	const bool bCanTraceWorld = GetWorld()->GetSubsystem<UPRAsyncTraceSubsystem>() != nullptr;
+
+	RemovedIndices.Reset();
+	for(int32 Index = 0; Index < Projectiles.Num(); Index++)
+	{
+		const bool bWaitWorldTrace = bCanTraceWorld && Projectiles.CollideWithWorld[Index];
+		if(Projectiles.RemainingLifespans[Index] <= 0.0f)
+		{
+			// 이동한 구간의 Trace 결과를 모두 받은 후 제거합니다.
+			if(!bWaitWorldTrace || Projectiles.PendingWorldTraces[Index] == 0)
+			{
+				ProjectileStats.ExpiredProjectiles++;
+				RemovedIndices.Add(Index);
+			}
+
+			continue;
+		}
+
+		if(!bWaitWorldTrace && ApplyDamageHit(Index, Projectiles.PreviousLocations[Index], Projectiles.Locations[Index]))
+		{
+			RemovedIndices.Add(Index);
+		}
+	}
+
+	RemoveProjectilesAt(RemovedIndices);
+}
+
+bool UPRProjectileSubsystem::ApplyDamageHit(int32 Index, const FVector& Start, const FVector& End)
+{
+	UPRDamageableSpatialHashSubsystem* SpatialHash = GetWorld()->GetSubsystem<UPRDamageableSpatialHashSubsystem>();
+	UPRDamageQueueSubsystem* DamageQueue = GetWorld()->GetSubsystem<UPRDamageQueueSubsystem>();
+	if(!SpatialHash || !DamageQueue)
+	{
+		return false;
+	}
+
+	// 구간에서 가장 먼저 충돌한 대상에게 대미지를 줍니다.
+	AActor* Instigator = Projectiles.Instigators[Index].Get();
+	QueryResults.Reset();
+	if(SpatialHash->QueryCapsule(Start, End, Projectiles.Radii[Index], Instigator, QueryResults) == 0)
+	{
+		return false;
+	}
+
+	FPRDamageInfo DamageInfo = Projectiles.DamageInfos[Index];
+	DamageInfo.ImpactLocation = QueryResults[0].ImpactPoint;
+	DamageQueue->QueueDamage(Instigator, QueryResults[0].Actor, DamageInfo);
+
+	ProjectileStats.DamageHits++;
+	return true;
+}
+
+void UPRProjectileSubsystem::RequestWorldTraces()
+{
+	UPRAsyncTraceSubsystem* AsyncTrace = GetWorld()->GetSubsystem<UPRAsyncTraceSubsystem>();
+	if(!AsyncTrace)
+	{
+		return;
+	}
+
+	TArray<FPRAsyncTraceRequest> Requests;
+	TArray<int32> ProjectileIDs;
+	Requests.Reserve(Projectiles.Num());
+	ProjectileIDs.Reserve(Projectiles.Num());
+	for(int32 Index = 0; Index < Projectiles.Num(); Index++)
+	{
+		if(Projectiles.CollideWithWorld[Index] && Projectiles.RemainingLifespans[Index] > 0.0f)
+		{
+			FPRAsyncTraceRequest& Request = Requests.Emplace_GetRef(Projectiles.PreviousLocations[Index], Projectiles.Locations[Index], Projectiles.Radii[Index], Projectiles.Instigators[Index].Get());
+			Request.TraceChannel = ECC_WorldStatic;
+			ProjectileIDs.Add(Projectiles.IDs[Index]);
+			Projectiles.PendingWorldTraces[Index]++;
+		}
+	}
+
+	if(Requests.Num() > 0)
+	{
+		AsyncTrace->RequestTraceBatch(EPRAsyncTraceFeature::AsyncTraceFeature_Projectile, MoveTemp(Requests),
+										FPRAsyncTraceBatchDelegate::CreateUObject(this, &UPRProjectileSubsystem::OnWorldTraceCompleted, MoveTemp(ProjectileIDs)));
+	}
+}
+
+void UPRProjectileSubsystem::OnWorldTraceCompleted(TConstArrayView<FHitResult> HitResults, TArray<int32> ProjectileIDs)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UPRProjectileSubsystem::OnWorldTraceCompleted);
+
+	// 결과는 다음 프레임 이후에 도착하므로 그 사이에 제거된 발사체는 무시합니다.
+	// 묶음에는 발사체마다 구간이 하나씩 있으므로 같은 발사체를 두 번 제거하지 않습니다.
+	RemovedIndices.Reset();
+	for(int32 ResultIndex = 0; ResultIndex < HitResults.Num() && ResultIndex < ProjectileIDs.Num(); ResultIndex++)
+	{
+		const int32* FoundIndex = ProjectileIndices.Find(ProjectileIDs[ResultIndex]);
+		if(!FoundIndex)
+		{
+			continue;
+		}
+
+		const int32 Index = *FoundIndex;
+		Projectiles.PendingWorldTraces[Index] = FMath::Max(Projectiles.PendingWorldTraces[Index] - 1, 0);
+
+		// 지형에 막혔으면 막힌 위치까지만 대상을 검사하여 지형 뒤의 대상에게 대미지를 주지 않습니다.
+		// 대미지를 받을 수 있는 액터에 막혔으면 그 액터를 찾을 수 있도록 구간 전체를 검사합니다.
+		const FHitResult& HitResult = HitResults[ResultIndex];
+		const bool bBlockedByWorld = HitResult.bBlockingHit && !FPRClassCapabilityRegistry::IsDamageable(HitResult.GetActor());
+		const FVector SegmentEnd = bBlockedByWorld ? HitResult.Location : HitResult.TraceEnd;
+		if(ApplyDamageHit(Index, HitResult.TraceStart, SegmentEnd))
+		{
+			RemovedIndices.Add(Index);
+		}
+		else if(bBlockedByWorld)
+		{
+			ProjectileStats.WorldHits++;
+			RemovedIndices.Add(Index);
+		}
+		else if(Projectiles.RemainingLifespans[Index] <= 0.0f && Projectiles.PendingWorldTraces[Index] == 0)
+		{
+			ProjectileStats.ExpiredProjectiles++;
+			RemovedIndices.Add(Index);
+		}
+	}
+
+	RemoveProjectilesAt(RemovedIndices);
+}
+
+void UPRProjectileSubsystem::UpdateVisuals()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UPRProjectileSubsystem::UpdateVisuals);
+
+	TArray<FVector, TInlineAllocator<4>> ViewLocations;
+	for(FConstPlayerControllerIterator Iterator = GetWorld()->GetPlayerControllerIterator(); Iterator; ++Iterator)
+	{
+		const APlayerController* PlayerController = Iterator->Get();
+		if(IsValid(PlayerController) && PlayerController->IsLocalController())
+		{
+			FVector ViewLocation;
+			FRotator ViewRotation;
+			PlayerController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+			ViewLocations.Add(ViewLocation);
+		}
+	}
+
+	const float VisualCullDistanceSquared = FMath::Square(VisualCullDistance);
+	for(int32 Index = 0; Index < Projectiles.Num(); Index++)
+	{
+		const TSubclassOf<APRPooledObject> VisualClass = Projectiles.VisualClasses[Index];
+		if(!VisualClass)
+		{
+			continue;
+		}
+
+		const FVector& Location = Projectiles.Locations[Index];
+		bool bIsVisible = false;
+		for(const FVector& ViewLocation : ViewLocations)
+		{
+			if(FVector::DistSquared(ViewLocation, Location) <= VisualCullDistanceSquared)
+			{
+				bIsVisible = true;
+				break;
+			}
+		}
+
+		DiscardDestroyedVisual(Index);
+		APRPooledObject* Visual = Projectiles.Visuals[Index].Get();
+		if(IsValid(Visual))
+		{
+			if(bIsVisible)
+			{
+				Visual->SetActorLocationAndRotation(Location, Projectiles.Velocities[Index].Rotation());
+			}
+			else
+			{
+				ReleaseVisual(VisualClass, Visual);
+				Projectiles.Visuals[Index] = nullptr;
+			}
+		}
+		else if(bIsVisible && ActiveVisualCount < MaxActiveVisuals)
+		{
+			Projectiles.Visuals[Index] = AcquireVisual(VisualClass, Location, Projectiles.Velocities[Index].Rotation());
+		}
+	}
+}
+
+void UPRProjectileSubsystem::RemoveProjectileAt(int32 Index)
+{
+	DiscardDestroyedVisual(Index);
+	APRPooledObject* Visual = Projectiles.Visuals[Index].Get();
+	if(IsValid(Visual))
+	{
+		ReleaseVisual(Projectiles.VisualClasses[Index], Visual);
+	}
+
+	ProjectileIndices.Remove(Projectiles.IDs[Index]);
+
+	Projectiles.RemoveAtSwap(Index);
+	if(Index < Projectiles.Num())
+	{
+		ProjectileIndices.Add(Projectiles.IDs[Index], Index);
+	}
+}
+
+void UPRProjectileSubsystem::RemoveProjectilesAt(TArray<int32>& Indices)
+{
+	// 큰 Index부터 제거하여 옮겨지는 마지막 발사체가 아직 제거하지 않은 발사체가 되지 않도록 합니다.
+	Indices.Sort(TGreater<int32>());
+	for(const int32 Index : Indices)
+	{
+		RemoveProjectileAt(Index);
+	}
+
+	Indices.Reset();
+}
+
+APRPooledObject* UPRProjectileSubsystem::AcquireVisual(TSubclassOf<APRPooledObject> VisualClass, const FVector& Location, const FRotator& Rotation)
+{
+	APRPooledObject* Visual = nullptr;
+	FPRProjectileVisualPool& VisualPool = VisualPools.FindOrAdd(VisualClass);
+	while(VisualPool.FreeVisuals.Num() > 0 && !IsValid(Visual))
+	{
+		Visual = VisualPool.FreeVisuals.Pop(false);
+	}
+
+	if(!IsValid(Visual))
+	{
+		FActorSpawnParameters SpawnParameters;
+		SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+		Visual = GetWorld()->SpawnActor<APRPooledObject>(VisualClass, Location, Rotation, SpawnParameters);
+		if(!IsValid(Visual))
+		{
+			return nullptr;
+		}
+
+		Visual->InitializeObject(nullptr, INDEX_NONE);
+	}
+
+	Visual->SetActorLocationAndRotation(Location, Rotation);
+	FPRPoolableDispatch::Activate(Visual);
+
+	// 발사체가 제거될 때 반환하므로 수명으로 비활성화하지 않습니다.
+	FPRPoolableDispatch::SetLifespan(Visual, 0.0f);
+
+	ActiveVisualCount++;
+	return Visual;
+}
+
+void UPRProjectileSubsystem::ReleaseVisual(TSubclassOf<APRPooledObject> VisualClass, APRPooledObject* Visual)
+{
+	FPRPoolableDispatch::Deactivate(Visual);
+	VisualPools.FindOrAdd(VisualClass).FreeVisuals.Add(Visual);
+	ActiveVisualCount--;
+}
+
+void UPRProjectileSubsystem::DiscardDestroyedVisual(int32 Index)
+{
+	// 외부에서 소멸된 오브젝트는 Pool에 반환할 수 없으므로 표시하고 있는 오브젝트의 수에서만 제외합니다.
+	TWeakObjectPtr<APRPooledObject>& Visual = Projectiles.Visuals[Index];
+	if(!Visual.IsExplicitlyNull() && !IsValid(Visual.Get()))
+	{
+		Visual.Reset();
+		ActiveVisualCount--;
+	}
+}
+#pragma endregion
@@ -0,0 +1,330 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Subsystems/PRSharedEffectPoolSubsystem.h"
+#include "Effects/PRNiagaraEffect.h"
+#include "Interfaces/PRInterfaceDispatch.h"
+#include "NiagaraSystem.h"
+
+UPRSharedEffectPoolSubsystem::UPRSharedEffectPoolSubsystem()
+{
+	DefaultMaxPoolSize = 64;
+	NiagaraPools.Empty();
+	SharedPoolStats = FPRSharedEffectPoolStats();
+	PooledEffectCount = 0;
+}
+
+void UPRSharedEffectPoolSubsystem::Deinitialize()
+{
+	// 공유 Pool의 모든 NiagaraEffect를 제거합니다.
+	for(auto& NiagaraPoolEntry : NiagaraPools)
+	{
+		for(APRNiagaraEffect* PooledEffect : NiagaraPoolEntry.Value.PooledEffects)
+		{
+			if(IsValid(PooledEffect))
+			{
+				PooledEffect->OnEffectDeactivateDelegate.RemoveAll(this);
+				PooledEffect->Destroy();
+			}
+		}
+	}
+
+	NiagaraPools.Empty();
+	PooledEffectCount = 0;
+
+	Super::Deinitialize();
+}
+
+void UPRSharedEffectPoolSubsystem::RegisterNiagaraPool(const FPRNiagaraEffectPoolSettings& NiagaraPoolSettings, bool bPrimeEffects)
+{
+	if(!NiagaraPoolSettings.NiagaraSystem)
+	{
+		return;
+	}
+
+	FPRSharedNiagaraEffectPool& SharedPool = NiagaraPools.FindOrAdd(NiagaraPoolSettings.NiagaraSystem);
+	SharedPool.EffectLifespan = NiagaraPoolSettings.EffectLifespan;
+	SharedPool.MaxPoolSize = FMath::Max3(SharedPool.MaxPoolSize, NiagaraPoolSettings.PoolSize, DefaultMaxPoolSize);
+
+#if WITH_EDITORONLY_DATA
+	// 에디터에서는 준비 단계에서 활성화하기 전에 NiagaraSystem의 컴파일이 끝나기를 기다립니다.
+	if(bPrimeEffects && SharedPool.PooledEffects.Num() < NiagaraPoolSettings.PoolSize)
+	{
+		NiagaraPoolSettings.NiagaraSystem->WaitForCompilationComplete();
+	}
+#endif
+
+	// 여러 Owner가 같은 설정 값을 등록해도 Pool의 크기는 합산하지 않고 가장 큰 PoolSize를 사용합니다.
+	while(SharedPool.PooledEffects.Num() < NiagaraPoolSettings.PoolSize)
+	{
+		APRNiagaraEffect* NiagaraEffect = SpawnSharedNiagaraEffect(NiagaraPoolSettings.NiagaraSystem, SharedPool);
+		if(!NiagaraEffect)
+		{
+			break;
+		}
+
+		// 전투 중 첫 번째 활성화에서 발생하는 System Instance 초기화 비용을 Pool 생성 시점으로 옮깁니다.
+		if(bPrimeEffects)
+		{
+			NiagaraEffect->PrimeNiagaraEffect();
+			SharedPoolStats.PrimedEffects++;
+		}
+	}
+}
+
+APRNiagaraEffect* UPRSharedEffectPoolSubsystem::AcquireNiagaraEffect(UNiagaraSystem* NiagaraSystem, AActor* Requester, int32 OwnerQuota)
+{
+	FPRSharedNiagaraEffectPool* SharedPool = NiagaraPools.Find(NiagaraSystem);
+	if(!SharedPool || !IsValid(Requester))
+	{
+		return nullptr;
+	}
+
+	SharedPoolStats.AcquireRequests++;
+
+	// Owner가 할당량을 모두 사용했다면 Owner의 가장 오래된 NiagaraEffect를 재사용합니다.
+	const int32* RequesterActiveCount = SharedPool->ActiveEffectCounts.Find(Requester);
+	if(OwnerQuota > 0 && RequesterActiveCount && *RequesterActiveCount >= OwnerQuota)
+	{
+		if(RecycleOldestNiagaraEffect(*SharedPool, Requester))
+		{
+			SharedPoolStats.QuotaRecycles++;
+		}
+	}
+
+	if(SharedPool->FreeEffects.Num() > 0)
+	{
+		SharedPoolStats.PoolHits++;
+	}
+	else if(SharedPool->PooledEffects.Num() < SharedPool->MaxPoolSize)
+	{
+		// Pool이 최대 크기보다 작으면 NiagaraEffect를 생성하여 Pool을 늘립니다.
+		SpawnSharedNiagaraEffect(NiagaraSystem, *SharedPool);
+	}
+	else if(ReclaimNiagaraEffectForFairShare(*SharedPool, Requester))
+	{
+		SharedPoolStats.FairShareReclaims++;
+	}
+
+	// 사용할 수 있는 NiagaraEffect가 없으면 요청을 거절합니다.
+	if(SharedPool->FreeEffects.Num() == 0)
+	{
+		SharedPoolStats.Rejections++;
+
+		return nullptr;
+	}
+
+	APRNiagaraEffect* AcquiredNiagaraEffect = SharedPool->FreeEffects.Pop(false);
+	AcquiredNiagaraEffect->SetEffectOwner(Requester);
+	SharedPool->ActiveEffects.Add(AcquiredNiagaraEffect);
+	SharedPool->ActiveEffectCounts.FindOrAdd(Requester)++;
+	SharedPool->ActiveEffectOwners.Add(AcquiredNiagaraEffect, Requester);
+
+	return AcquiredNiagaraEffect;
+}
+
+int32 UPRSharedEffectPoolSubsystem::ReleaseOwnerNiagaraEffects(AActor* Owner)
+{
+	if(!Owner)
+	{
+		return 0;
+	}
+
+	int32 ReleasedEffectCount = 0;
+	TArray<APRNiagaraEffect*, TInlineAllocator<16>> ReleaseNiagaraEffects;
+	for(auto& NiagaraPoolEntry : NiagaraPools)
+	{
+		FPRSharedNiagaraEffectPool& SharedPool = NiagaraPoolEntry.Value;
+		if(!SharedPool.ActiveEffectCounts.Contains(Owner))
+		{
+			continue;
+		}
+
+		// 비활성화하면 ActiveEffects에서 제거되므로 반환할 NiagaraEffect를 먼저 모읍니다.
+		ReleaseNiagaraEffects.Reset();
+		for(const auto& ActiveEffectOwner : SharedPool.ActiveEffectOwners)
+		{
+			if(ActiveEffectOwner.Value == Owner && ActiveEffectOwner.Key.IsValid())
+			{
+				ReleaseNiagaraEffects.Add(ActiveEffectOwner.Key.Get());
+			}
+		}
+
+		for(APRNiagaraEffect* ReleaseNiagaraEffect : ReleaseNiagaraEffects)
+		{
+			// 비활성화하면 OnSharedNiagaraEffectDeactivate에서 Pool에 반환됩니다.
+			FPRPoolableDispatch::Deactivate(ReleaseNiagaraEffect);
+			ReleasedEffectCount++;
+		}
+	}
+
+	return ReleasedEffectCount;
+}
+
+bool UPRSharedEffectPoolSubsystem::IsCreateNiagaraPool(UNiagaraSystem* NiagaraSystem) const
+{
+	return NiagaraPools.Contains(NiagaraSystem);
+}
+
+bool UPRSharedEffectPoolSubsystem::IsSharedNiagaraEffect(APRNiagaraEffect* NiagaraEffect) const
+{
+	if(!IsValid(NiagaraEffect))
+	{
+		return false;
+	}
+
+	const FPRSharedNiagaraEffectPool* SharedPool = NiagaraPools.Find(NiagaraEffect->GetNiagaraEffectAsset());
+	return SharedPool && SharedPool->PooledEffects.Contains(NiagaraEffect);
+}
+
+int32 UPRSharedEffectPoolSubsystem::GetActiveNiagaraEffectCount(UNiagaraSystem* NiagaraSystem, AActor* Owner) const
+{
+	const FPRSharedNiagaraEffectPool* SharedPool = NiagaraPools.Find(NiagaraSystem);
+	if(SharedPool)
+	{
+		const int32* ActiveEffectCount = SharedPool->ActiveEffectCounts.Find(Owner);
+		if(ActiveEffectCount)
+		{
+			return *ActiveEffectCount;
+		}
+	}
+
+	return 0;
+}
+
+void UPRSharedEffectPoolSubsystem::ResetSharedPoolStats()
+{
+	SharedPoolStats = FPRSharedEffectPoolStats();
+	SharedPoolStats.PeakPooledEffects = PooledEffectCount;
+}
+
+APRNiagaraEffect* UPRSharedEffectPoolSubsystem::SpawnSharedNiagaraEffect(UNiagaraSystem* NiagaraSystem, FPRSharedNiagaraEffectPool& SharedPool)
+{
+	if(!GetWorld() || !NiagaraSystem)
+	{
+		return nullptr;
+	}
+
+	APRNiagaraEffect* NiagaraEffect = GetWorld()->SpawnActor<APRNiagaraEffect>(APRNiagaraEffect::StaticClass());
+	if(!IsValid(NiagaraEffect))
+	{
+		return nullptr;
+	}
+
+	// 공유 Pool의 NiagaraEffect는 사용할 때 Owner를 설정합니다.
+	NiagaraEffect->InitializeNiagaraEffect(NiagaraSystem, nullptr, SharedPool.PooledEffects.Num(), SharedPool.EffectLifespan);
+	NiagaraEffect->OnEffectDeactivateDelegate.AddUObject(this, &UPRSharedEffectPoolSubsystem::OnSharedNiagaraEffectDeactivate);
+
+	SharedPool.PooledEffects.Add(NiagaraEffect);
+	SharedPool.FreeEffects.Add(NiagaraEffect);
+
+	PooledEffectCount++;
+	SharedPoolStats.Creations++;
+	SharedPoolStats.PeakPooledEffects = FMath::Max(SharedPoolStats.PeakPooledEffects, PooledEffectCount);
+
+	return NiagaraEffect;
+}
+
+bool UPRSharedEffectPoolSubsystem::RecycleOldestNiagaraEffect(FPRSharedNiagaraEffectPool& SharedPool, AActor* Owner)
+{
+	// ActiveEffects는 사용한 순서대로 보관되어 있으므로 처음 찾은 NiagaraEffect가 가장 오래된 NiagaraEffect입니다.
+	const TObjectPtr<APRNiagaraEffect>* OldestNiagaraEffect = SharedPool.ActiveEffects.FindByPredicate([&SharedPool, Owner](const TObjectPtr<APRNiagaraEffect>& ActiveEffect)
+	{
+		const TWeakObjectPtr<AActor>* EffectOwner = IsValid(ActiveEffect) ? SharedPool.ActiveEffectOwners.Find(ActiveEffect.Get()) : nullptr;
+		if(!EffectOwner)
+		{
+			return false;
+		}
+
+		return Owner ? *EffectOwner == Owner : !EffectOwner->IsValid();
+	});
+	
+	if(OldestNiagaraEffect)
+	{
+		// 다른 Pool과 같이 Poolable Interface로 비활성화하면 OnSharedNiagaraEffectDeactivate에서 Pool에 반환됩니다.
+		APRNiagaraEffect* RecycleNiagaraEffect = *OldestNiagaraEffect;
+		FPRPoolableDispatch::Deactivate(RecycleNiagaraEffect);
+
+		return true;
+	}
+
+	return false;
+}
+
+bool UPRSharedEffectPoolSubsystem::ReclaimNiagaraEffectForFairShare(FPRSharedNiagaraEffectPool& SharedPool, AActor* Requester)
+{
+	const int32* RequesterActiveCountPtr = SharedPool.ActiveEffectCounts.Find(Requester);
+	const int32 RequesterActiveCount = RequesterActiveCountPtr ? *RequesterActiveCountPtr : 0;
+
+	// 요청한 Owner를 포함하여 NiagaraEffect를 사용 중인 Owner의 수와 가장 많이 사용하는 Owner를 구합니다.
+	int32 ActiveOwnerCount = RequesterActiveCount > 0 ? 0 : 1;
+	AActor* HeaviestOwner = nullptr;
+	int32 HeaviestOwnerActiveCount = 0;
+	bool bHasOrphanedEffects = false;
+	for(const auto& ActiveEffectCount : SharedPool.ActiveEffectCounts)
+	{
+		if(ActiveEffectCount.Value <= 0)
+		{
+			continue;
+		}
+
+		// 제거된 Owner가 사용하던 NiagaraEffect입니다.
+		if(!ActiveEffectCount.Key.IsValid())
+		{
+			bHasOrphanedEffects = true;
+			continue;
+		}
+
+		ActiveOwnerCount++;
+		if(ActiveEffectCount.Value > HeaviestOwnerActiveCount && ActiveEffectCount.Key.Get() != Requester)
+		{
+			HeaviestOwner = ActiveEffectCount.Key.Get();
+			HeaviestOwnerActiveCount = ActiveEffectCount.Value;
+		}
+	}
+
+	// 제거된 Owner가 사용하던 NiagaraEffect를 가장 먼저 회수합니다.
+	if(bHasOrphanedEffects && RecycleOldestNiagaraEffect(SharedPool, nullptr))
+	{
+		return true;
+	}
+
+	// 요청한 Owner가 이미 공정한 몫 이상을 사용하고 있거나, 더 많이 사용하는 Owner가 없으면 회수하지 않습니다.
+	const int32 FairShare = FMath::DivideAndRoundUp(SharedPool.MaxPoolSize, FMath::Max(ActiveOwnerCount, 1));
+	if(RequesterActiveCount >= FairShare || HeaviestOwnerActiveCount <= RequesterActiveCount + 1)
+	{
+		return false;
+	}
+
+	return RecycleOldestNiagaraEffect(SharedPool, HeaviestOwner);
+}
+
+void UPRSharedEffectPoolSubsystem::OnSharedNiagaraEffectDeactivate(APREffect* TargetEffect)
+{
+	APRNiagaraEffect* TargetNiagaraEffect = Cast<APRNiagaraEffect>(TargetEffect);
+	if(!IsValid(TargetNiagaraEffect))
+	{
+		return;
+	}
+
+	FPRSharedNiagaraEffectPool* SharedPool = NiagaraPools.Find(TargetNiagaraEffect->GetNiagaraEffectAsset());
+	if(!SharedPool || SharedPool->ActiveEffects.Remove(TargetNiagaraEffect) == 0)
+	{
+		// 이미 Pool에 반환된 NiagaraEffect입니다.
+		return;
+	}
+
+	// NiagaraEffect를 가져갈 때 기록한 Owner의 사용 중인 NiagaraEffect의 수를 줄입니다. Owner가 제거되었어도 같은 Key를 사용합니다.
+	TWeakObjectPtr<AActor> EffectOwner;
+	SharedPool->ActiveEffectOwners.RemoveAndCopyValue(TargetNiagaraEffect, EffectOwner);
+	int32* ActiveEffectCount = SharedPool->ActiveEffectCounts.Find(EffectOwner);
+	if(ActiveEffectCount && --(*ActiveEffectCount) <= 0)
+	{
+		SharedPool->ActiveEffectCounts.Remove(EffectOwner);
+	}
+
+	// Owner에서 분리하여 Pool에 반환합니다.
+	TargetNiagaraEffect->DetachFromActor(FDetachmentTransformRules::KeepWorldTransform);
+	TargetNiagaraEffect->SetEffectOwner(nullptr);
+	SharedPool->FreeEffects.Add(TargetNiagaraEffect);
+}
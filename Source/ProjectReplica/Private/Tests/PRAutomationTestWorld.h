@@ -0,0 +1,202 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "ProjectReplica.h"
+#include "Characters/PRBaseCharacter.h"
+#include "Components/PRStatSystemComponent.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "Components/SceneComponent.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/**
+ * 자동화 테스트에서 사용하는 렌더링하지 않는 게임 월드입니다.
+ * 생성할 때 월드를 만들어 BeginPlay까지 실행하고, 소멸할 때 월드를 제거합니다.
+ * 로컬 플레이어와 카메라가 없으므로 EffectSystem의 Spawn 컬링은 동작하지 않습니다.
+ */
+struct FPRAutomationTestWorld
+{
+public:
+	FPRAutomationTestWorld()
+		: World(nullptr)
+	{
+		World = UWorld::CreateWorld(EWorldType::Game, false, TEXT("PRAutomationTestWorld"));
+		FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+		WorldContext.SetCurrentWorld(World);
+
+		World->InitializeActorsForPlay(FURL());
+		World->BeginPlay();
+	}
+
+	~FPRAutomationTestWorld()
+	{
+		if(World)
+		{
+			GEngine->DestroyWorldContext(World);
+			World->DestroyWorld(false);
+			World = nullptr;
+		}
+	}
+
+	FPRAutomationTestWorld(const FPRAutomationTestWorld&) = delete;
+	FPRAutomationTestWorld& operator=(const FPRAutomationTestWorld&) = delete;
+
+public:
+	/** 테스트에 사용하는 월드입니다. */
+	UWorld* World;
+
+	/** 대미지 테스트에서 적중마다 입히는 대미지입니다. 체력을 float로 정확하게 비교할 수 있도록 정수를 사용합니다. */
+	static constexpr float DamageAmount = 1.0f;
+
+	/** 대미지 테스트 동안 대상이 사망하지 않도록 설정하는 체력입니다. */
+	static constexpr float DamageTargetHealth = 1000000.0f;
+
+public:
+	/**
+	 * 월드를 주어진 시간만큼 Tick하는 함수입니다. 월드의 타이머와 Tickable 서브시스템이 실행됩니다.
+	 *
+	 * @param DeltaSeconds Tick할 시간(초)입니다.
+	 */
+	void Tick(float DeltaSeconds = 1.0f / 60.0f) const
+	{
+		World->Tick(LEVELTICK_All, DeltaSeconds);
+	}
+
+	/**
+	 * 주어진 위치에 RootComponent를 가진 액터를 Spawn하는 함수입니다.
+	 *
+	 * @param Location 액터를 Spawn할 위치입니다.
+	 * @return Spawn한 액터입니다.
+	 */
+	template <typename ActorType = AActor>
+	ActorType* SpawnActor(const FVector& Location = FVector::ZeroVector) const
+	{
+		ActorType* SpawnedActor = World->SpawnActor<ActorType>(ActorType::StaticClass(), FTransform(Location));
+		if(SpawnedActor && !SpawnedActor->GetRootComponent())
+		{
+			USceneComponent* RootComponent = NewObject<USceneComponent>(SpawnedActor, TEXT("RootComponent"));
+			SpawnedActor->SetRootComponent(RootComponent);
+			RootComponent->RegisterComponent();
+			RootComponent->SetWorldLocation(Location);
+		}
+
+		return SpawnedActor;
+	}
+
+	/**
+	 * 주어진 액터에 Component를 추가하는 함수입니다.
+	 * Configure는 Component를 등록하기 전에 호출되므로 BeginPlay 전에 설정해야 하는 값을 지정할 수 있습니다.
+	 *
+	 * @param Owner Component를 추가할 액터입니다.
+	 * @param Configure Component를 등록하기 전에 호출할 함수입니다.
+	 * @return 추가한 Component입니다.
+	 */
+	template <typename ComponentType>
+	static ComponentType* AddComponent(AActor* Owner, TFunctionRef<void(ComponentType*)> Configure = [](ComponentType*) {})
+	{
+		ComponentType* Component = NewObject<ComponentType>(Owner);
+		Configure(Component);
+		Owner->AddInstanceComponent(Component);
+		Component->RegisterComponent();
+
+		return Component;
+	}
+
+	/**
+	 * 테스트에서 private 프로퍼티의 값을 설정하는 함수입니다. 에디터에서 설정하는 값을 리플렉션으로 지정합니다.
+	 *
+	 * @param Object 값을 설정할 오브젝트입니다.
+	 * @param PropertyName 설정할 프로퍼티의 이름입니다.
+	 * @param Value 설정할 값입니다.
+	 * @return 프로퍼티를 찾아 값을 설정했으면 true를 반환합니다.
+	 */
+	template <typename ValueType>
+	static bool SetPropertyValue(UObject* Object, FName PropertyName, const ValueType& Value)
+	{
+		const FProperty* Property = FindFProperty<FProperty>(Object->GetClass(), PropertyName);
+		if(!Property || Property->GetSize() != sizeof(ValueType))
+		{
+			return false;
+		}
+
+		*Property->ContainerPtrToValuePtr<ValueType>(Object) = Value;
+
+		return true;
+	}
+
+	/**
+	 * 대미지를 받을 캐릭터를 X축을 따라 Spawn하고 체력을 설정하는 함수입니다.
+	 *
+	 * @param TargetCount Spawn할 캐릭터의 수입니다.
+	 * @param OutTargets Spawn한 캐릭터입니다.
+	 * @param Health 캐릭터의 체력입니다.
+	 */
+	void SpawnDamageTargets(int32 TargetCount, TArray<APRBaseCharacter*>& OutTargets, float Health = DamageTargetHealth) const
+	{
+		OutTargets.Reset(TargetCount);
+		for(int32 Index = 0; Index < TargetCount; Index++)
+		{
+			APRBaseCharacter* Target = World->SpawnActor<APRBaseCharacter>(APRBaseCharacter::StaticClass(), FTransform(FVector(Index * 200.0f, 0.0f, 0.0f)));
+			if(IsValid(Target) && Target->GetStatSystem())
+			{
+				OutTargets.Add(Target);
+			}
+		}
+
+		SetTargetsHealth(OutTargets, Health);
+	}
+
+	/**
+	 * 대미지를 받을 캐릭터의 최대 체력과 체력을 설정하는 함수입니다.
+	 *
+	 * @param Targets 체력을 설정할 캐릭터입니다.
+	 * @param Health 설정할 체력입니다.
+	 */
+	static void SetTargetsHealth(TConstArrayView<APRBaseCharacter*> Targets, float Health = DamageTargetHealth)
+	{
+		for(APRBaseCharacter* Target : Targets)
+		{
+			FPRCharacterStat CharacterStat = Target->GetStatSystem()->GetCharacterStat();
+			CharacterStat.MaxHealth = Health;
+			CharacterStat.Health = Health;
+			Target->GetStatSystem()->SetCharacterStat(CharacterStat);
+		}
+	}
+
+	/**
+	 * 대상의 위치에 DamageAmount만큼의 근접 대미지를 입히는 대미지 정보를 만드는 함수입니다.
+	 *
+	 * @param Target 대미지를 받을 액터입니다.
+	 * @return 대미지 정보입니다.
+	 */
+	static FPRDamageInfo MakeDamageInfo(const AActor* Target)
+	{
+		FPRDamageInfo DamageInfo;
+		DamageInfo.Amount = DamageAmount;
+		DamageInfo.DamageType = EPRDamageType::DamageType_Melee;
+		DamageInfo.ImpactLocation = Target->GetActorLocation();
+
+		return DamageInfo;
+	}
+
+	/**
+	 * 모든 대상의 체력이 주어진 값인지 확인하는 함수입니다.
+	 *
+	 * @param Test 결과를 기록할 테스트입니다.
+	 * @param Targets 확인할 캐릭터입니다.
+	 * @param ExpectedHealth 기대하는 체력입니다.
+	 */
+	static void TestTargetsHealth(FAutomationTestBase& Test, TConstArrayView<APRBaseCharacter*> Targets, float ExpectedHealth)
+	{
+		for(const APRBaseCharacter* Target : Targets)
+		{
+			Test.TestEqual(*FString::Printf(TEXT("%s health"), *Target->GetName()), Target->GetStatSystem()->GetCharacterStat().Health, ExpectedHealth);
+		}
+	}
+};
+
+#endif
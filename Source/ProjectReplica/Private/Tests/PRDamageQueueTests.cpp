@@ -0,0 +1,153 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Tests/PRAutomationTestWorld.h"
+#include "Components/PRDamageSystemComponent.h"
+#include "Subsystems/PRDamageQueueSubsystem.h"
+#include "Interfaces/PRInterfaceDispatch.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace PRDamageQueueTests
+{
+	/** 벤치마크에서 대미지를 받는 캐릭터의 수입니다. */
+	constexpr int32 BenchmarkTargetCount = 100;
+
+	/** 벤치마크에서 한 프레임에 발생하는 적중의 수입니다. */
+	constexpr int32 BenchmarkHitsPerFrame = 1000;
+
+	/** 벤치마크를 실행할 프레임의 수입니다. */
+	constexpr int32 BenchmarkFrames = 60;
+}
+
+/**
+ * 한 프레임에 1,000번 적중하는 상황에서 대미지 큐의 처리 비용을 적중마다 바로 처리하는 방식과 비교하는 마이크로 벤치마크입니다.
+ * 대미지 큐는 대상별로 묶어서 처리하므로 결과 체력은 바로 처리하는 방식과 같아야 합니다.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPRDamageQueueBenchmarkTest, "ProjectReplica.DamageQueue.Benchmark.ThousandHitsPerFrame", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FPRDamageQueueBenchmarkTest::RunTest(const FString& Parameters)
+{
+	using namespace PRDamageQueueTests;
+
+	FPRAutomationTestWorld TestWorld;
+	UPRDamageQueueSubsystem* DamageQueue = TestWorld.World->GetSubsystem<UPRDamageQueueSubsystem>();
+	if(!TestNotNull(TEXT("DamageQueueSubsystem"), DamageQueue))
+	{
+		return false;
+	}
+
+	AActor* Instigator = TestWorld.SpawnActor();
+	TArray<APRBaseCharacter*> Targets;
+	TestWorld.SpawnDamageTargets(BenchmarkTargetCount, Targets);
+	if(!TestEqual(TEXT("Spawned targets"), Targets.Num(), BenchmarkTargetCount))
+	{
+		return false;
+	}
+
+	TArray<FPRDamageInfo> DamageInfos;
+	DamageInfos.Reserve(Targets.Num());
+	for(const APRBaseCharacter* Target : Targets)
+	{
+		DamageInfos.Add(FPRAutomationTestWorld::MakeDamageInfo(Target));
+	}
+
+	// 적중마다 PRDamageableInterface로 바로 처리합니다.
+	double DirectTime = 0.0;
+	for(int32 Frame = 0; Frame < BenchmarkFrames; Frame++)
+	{
+		const double FrameStartTime = FPlatformTime::Seconds();
+		for(int32 Hit = 0; Hit < BenchmarkHitsPerFrame; Hit++)
+		{
+			const int32 TargetIndex = Hit % Targets.Num();
+			FPRDamageableDispatch::TakeDamage(Targets[TargetIndex], DamageInfos[TargetIndex]);
+		}
+
+		DirectTime += FPlatformTime::Seconds() - FrameStartTime;
+	}
+
+	const float HealthAfterDirect = FPRAutomationTestWorld::DamageTargetHealth - FPRAutomationTestWorld::DamageAmount * (BenchmarkHitsPerFrame / BenchmarkTargetCount) * BenchmarkFrames;
+	FPRAutomationTestWorld::TestTargetsHealth(*this, Targets, HealthAfterDirect);
+
+	// 같은 적중을 대미지 큐에 추가하고 프레임마다 한 번에 처리합니다.
+	DamageQueue->ResetDamageQueueStats();
+	double QueuedTime = 0.0;
+	for(int32 Frame = 0; Frame < BenchmarkFrames; Frame++)
+	{
+		const double FrameStartTime = FPlatformTime::Seconds();
+		for(int32 Hit = 0; Hit < BenchmarkHitsPerFrame; Hit++)
+		{
+			const int32 TargetIndex = Hit % Targets.Num();
+			DamageQueue->QueueDamage(Instigator, Targets[TargetIndex], DamageInfos[TargetIndex]);
+		}
+
+		DamageQueue->ResolveDamageQueue();
+		QueuedTime += FPlatformTime::Seconds() - FrameStartTime;
+	}
+
+	FPRAutomationTestWorld::TestTargetsHealth(*this, Targets, HealthAfterDirect - FPRAutomationTestWorld::DamageAmount * (BenchmarkHitsPerFrame / BenchmarkTargetCount) * BenchmarkFrames);
+
+	const FPRDamageQueueStats DamageQueueStats = DamageQueue->GetDamageQueueStats();
+	TestEqual(TEXT("ResolvedFrames"), DamageQueueStats.ResolvedFrames, BenchmarkFrames);
+	TestEqual(TEXT("ResolvedEvents"), DamageQueueStats.ResolvedEvents, BenchmarkHitsPerFrame * BenchmarkFrames);
+	TestEqual(TEXT("ResolvedTargets"), DamageQueueStats.ResolvedTargets, BenchmarkTargetCount * BenchmarkFrames);
+	TestEqual(TEXT("PeakEventsPerFrame"), DamageQueueStats.PeakEventsPerFrame, BenchmarkHitsPerFrame);
+
+	AddInfo(FString::Printf(TEXT("%d hits/frame on %d targets over %d frames: direct %.3f ms/frame, queued %.3f ms/frame (resolve %.3f ms/frame, peak %.3f ms)."),
+		BenchmarkHitsPerFrame, BenchmarkTargetCount, BenchmarkFrames,
+		DirectTime * 1000.0 / BenchmarkFrames, QueuedTime * 1000.0 / BenchmarkFrames,
+		DamageQueueStats.TotalResolveTime * 1000.0 / BenchmarkFrames, DamageQueueStats.PeakResolveTime * 1000.0));
+
+	return true;
+}
+
+/**
+ * 한 대상이 한 프레임에 반응할 수 있는 대미지를 여러 번 받아도 반응은 한 번만 실행하고, 반응한 대미지 이벤트도 하나만 기록하는지 확인하는 테스트입니다.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPRDamageQueueAppliedEventsTest, "ProjectReplica.DamageQueue.AppliedEvents", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FPRDamageQueueAppliedEventsTest::RunTest(const FString& Parameters)
+{
+	using namespace PRDamageQueueTests;
+
+	constexpr int32 HitCount = 3;
+
+	FPRAutomationTestWorld TestWorld;
+	UPRDamageQueueSubsystem* DamageQueue = TestWorld.World->GetSubsystem<UPRDamageQueueSubsystem>();
+	if(!TestNotNull(TEXT("DamageQueueSubsystem"), DamageQueue))
+	{
+		return false;
+	}
+
+	AActor* Instigator = TestWorld.SpawnActor();
+	TArray<APRBaseCharacter*> Targets;
+	TestWorld.SpawnDamageTargets(1, Targets);
+	if(!TestEqual(TEXT("Spawned targets"), Targets.Num(), 1) || !TestNotNull(TEXT("DamageSystem"), Targets[0]->GetDamageSystem()))
+	{
+		return false;
+	}
+
+	int32 DamageResponseCount = 0;
+	Targets[0]->GetDamageSystem()->OnDamageResponseNativeDelegate.AddLambda([&DamageResponseCount](EPRDamageResponse DamageResponse)
+	{
+		DamageResponseCount++;
+	});
+
+	FPRDamageInfo DamageInfo = FPRAutomationTestWorld::MakeDamageInfo(Targets[0]);
+	DamageInfo.bShouldForceInterrupt = true;
+	for(int32 Hit = 0; Hit < HitCount; Hit++)
+	{
+		DamageQueue->QueueDamage(Instigator, Targets[0], DamageInfo);
+	}
+
+	DamageQueue->ResetDamageQueueStats();
+	DamageQueue->ResolveDamageQueue();
+
+	FPRAutomationTestWorld::TestTargetsHealth(*this, Targets, FPRAutomationTestWorld::DamageTargetHealth - FPRAutomationTestWorld::DamageAmount * HitCount);
+	TestEqual(TEXT("DamageResponse broadcasts"), DamageResponseCount, 1);
+	TestEqual(TEXT("AppliedEvents"), DamageQueue->GetDamageQueueStats().AppliedEvents, 1);
+
+	return true;
+}
+
+#endif
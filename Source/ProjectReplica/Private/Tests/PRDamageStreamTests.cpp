@@ -0,0 +1,192 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Tests/PRAutomationTestWorld.h"
+#include "Components/PRStatSystemComponent.h"
+#include "Subsystems/PRDamageQueueSubsystem.h"
+#include "Subsystems/PRDamageStreamSubsystem.h"
+#include "Interfaces/PRInterfaceDispatch.h"
+#include "HAL/FileManager.h"
+#include "Misc/Paths.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace PRDamageStreamTests
+{
+	/** 대미지를 받는 캐릭터의 수입니다. */
+	constexpr int32 TargetCount = 20;
+
+	/** 한 프레임에 대미지 큐에 추가하는 적중의 수입니다. */
+	constexpr int32 QueuedHitsPerFrame = 100;
+
+	/** 한 프레임에 대미지 큐를 거치지 않고 바로 처리하는 적중의 수입니다. */
+	constexpr int32 DirectHitsPerFrame = 20;
+
+	/** 대미지를 기록할 프레임의 수입니다. */
+	constexpr int32 RecordFrames = 30;
+
+	/** 테스트에서 기록한 대미지 스트림을 저장할 파일의 이름입니다. */
+	const TCHAR* DamageStreamFileName = TEXT("PRDamageStreamTest.prds");
+
+	/**
+	 * 대미지 큐를 거치는 적중과 바로 처리하는 적중을 섞어서 대미지 스트림을 기록하는 함수입니다.
+	 *
+	 * @param TestWorld 대미지를 처리할 월드입니다.
+	 * @param Instigator 대미지를 주는 액터입니다.
+	 * @param Targets 대미지를 받을 캐릭터입니다.
+	 * @param FilePath 기록한 대미지 스트림을 저장할 파일의 경로입니다.
+	 * @return 저장에 성공했을 경우 true를 반환합니다.
+	 */
+	bool RecordDamageStream(const FPRAutomationTestWorld& TestWorld, AActor* Instigator, TConstArrayView<APRBaseCharacter*> Targets, const FString& FilePath)
+	{
+		UPRDamageQueueSubsystem* DamageQueue = TestWorld.World->GetSubsystem<UPRDamageQueueSubsystem>();
+		UPRDamageStreamSubsystem* DamageStream = TestWorld.World->GetSubsystem<UPRDamageStreamSubsystem>();
+		if(!DamageQueue || !DamageStream)
+		{
+			return false;
+		}
+
+		DamageStream->StartRecording();
+		for(int32 Frame = 0; Frame < RecordFrames; Frame++)
+		{
+			for(int32 Hit = 0; Hit < QueuedHitsPerFrame + DirectHitsPerFrame; Hit++)
+			{
+				APRBaseCharacter* Target = Targets[Hit % Targets.Num()];
+				const FPRDamageInfo DamageInfo = FPRAutomationTestWorld::MakeDamageInfo(Target);
+				if(Hit < QueuedHitsPerFrame)
+				{
+					DamageQueue->QueueDamage(Instigator, Target, DamageInfo);
+				}
+				else
+				{
+					FPRDamageableDispatch::TakeDamage(Target, DamageInfo, Instigator);
+				}
+			}
+
+			// 대미지 큐는 월드의 Tick이 끝날 때 처리됩니다.
+			TestWorld.Tick();
+		}
+
+		return DamageStream->StopRecording(FilePath);
+	}
+}
+
+/**
+ * 대미지 큐를 거치는 대미지와 바로 처리하는 대미지를 대미지 호출마다 한 번씩만 기록하고,
+ * 대미지 큐를 거친 대미지는 대미지를 준 액터와 함께 기록하는지 확인하는 테스트입니다.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPRDamageStreamCaptureTest, "ProjectReplica.DamageStream.CaptureOnce", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FPRDamageStreamCaptureTest::RunTest(const FString& Parameters)
+{
+	using namespace PRDamageStreamTests;
+
+	FPRAutomationTestWorld TestWorld;
+	AActor* Instigator = TestWorld.SpawnActor();
+	TArray<APRBaseCharacter*> Targets;
+	TestWorld.SpawnDamageTargets(TargetCount, Targets);
+
+	const FString FilePath = FPaths::AutomationTransientDir() / DamageStreamFileName;
+	if(!TestTrue(TEXT("Recorded damage stream"), RecordDamageStream(TestWorld, Instigator, Targets, FilePath)))
+	{
+		return false;
+	}
+
+	TArray<FPRDamageStreamEvent> Events;
+	const bool bLoaded = UPRDamageStreamSubsystem::LoadDamageStream(FilePath, Events);
+	IFileManager::Get().Delete(*FilePath);
+	if(!TestTrue(TEXT("Loaded damage stream"), bLoaded))
+	{
+		return false;
+	}
+
+	int32 QueuedEvents = 0;
+	int32 EventsWithInstigator = 0;
+	for(const FPRDamageStreamEvent& Event : Events)
+	{
+		QueuedEvents += Event.bQueued ? 1 : 0;
+		EventsWithInstigator += Event.Instigator == Instigator->GetFName() ? 1 : 0;
+	}
+
+	TestEqual(TEXT("Captured events"), Events.Num(), (QueuedHitsPerFrame + DirectHitsPerFrame) * RecordFrames);
+	TestEqual(TEXT("Captured queued events"), QueuedEvents, QueuedHitsPerFrame * RecordFrames);
+	TestEqual(TEXT("Captured events with instigator"), EventsWithInstigator, Events.Num());
+
+	return true;
+}
+
+/**
+ * 기록한 대미지 스트림을 재생하여 대미지 처리의 프레임 시간을 측정하는 벤치마크입니다.
+ * 재생은 기록할 때와 같은 경로로 대미지를 처리하므로 결과 체력은 기록할 때와 같아야 합니다.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPRDamageStreamReplayBenchmarkTest, "ProjectReplica.DamageStream.Benchmark.Replay", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FPRDamageStreamReplayBenchmarkTest::RunTest(const FString& Parameters)
+{
+	using namespace PRDamageStreamTests;
+
+	FPRAutomationTestWorld TestWorld;
+	UPRDamageStreamSubsystem* DamageStream = TestWorld.World->GetSubsystem<UPRDamageStreamSubsystem>();
+	if(!TestNotNull(TEXT("DamageStreamSubsystem"), DamageStream))
+	{
+		return false;
+	}
+
+	AActor* Instigator = TestWorld.SpawnActor();
+	TArray<APRBaseCharacter*> Targets;
+	TestWorld.SpawnDamageTargets(TargetCount, Targets);
+
+	const FString FilePath = FPaths::AutomationTransientDir() / DamageStreamFileName;
+	if(!TestTrue(TEXT("Recorded damage stream"), RecordDamageStream(TestWorld, Instigator, Targets, FilePath)))
+	{
+		return false;
+	}
+
+	TArray<float> RecordedHealths;
+	for(const APRBaseCharacter* Target : Targets)
+	{
+		RecordedHealths.Add(Target->GetStatSystem()->GetCharacterStat().Health);
+	}
+
+	FPRAutomationTestWorld::SetTargetsHealth(Targets);
+
+	const bool bReplayStarted = DamageStream->StartReplay(FilePath);
+	IFileManager::Get().Delete(*FilePath);
+	if(!TestTrue(TEXT("Started replay"), bReplayStarted))
+	{
+		return false;
+	}
+
+	// 재생이 끝나지 않아도 테스트가 멈추지 않도록 기록한 프레임보다 넉넉하게 Tick합니다.
+	const int32 MaxReplayFrames = RecordFrames * 2 + 10;
+	for(int32 Frame = 0; Frame < MaxReplayFrames && DamageStream->IsReplaying(); Frame++)
+	{
+		TestWorld.Tick();
+	}
+
+	// 마지막 프레임에 대미지 큐에 추가한 대미지를 처리합니다.
+	TestWorld.Tick();
+
+	if(!TestFalse(TEXT("Replay finished"), DamageStream->IsReplaying()))
+	{
+		DamageStream->StopReplay();
+		return false;
+	}
+
+	const FPRDamageStreamReplayStats ReplayStats = DamageStream->GetReplayStats();
+	TestEqual(TEXT("ReplayedEvents"), ReplayStats.ReplayedEvents, (QueuedHitsPerFrame + DirectHitsPerFrame) * RecordFrames);
+	TestEqual(TEXT("MissingTargetEvents"), ReplayStats.MissingTargetEvents, 0);
+	for(int32 Index = 0; Index < Targets.Num(); Index++)
+	{
+		TestEqual(*FString::Printf(TEXT("%s health"), *Targets[Index]->GetName()), Targets[Index]->GetStatSystem()->GetCharacterStat().Health, RecordedHealths[Index]);
+	}
+
+	AddInfo(FString::Printf(TEXT("Replayed %d damage calls over %d frames: dispatch %.3f ms/frame, average frame %.3f ms, peak frame %.3f ms."),
+		ReplayStats.ReplayedEvents, ReplayStats.Frames,
+		ReplayStats.Frames > 0 ? ReplayStats.DispatchTime * 1000.0 / ReplayStats.Frames : 0.0,
+		ReplayStats.AverageFrameTime * 1000.0, ReplayStats.PeakFrameTime * 1000.0));
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,250 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Tests/PRAutomationTestWorld.h"
+#include "Characters/PRBaseCharacter.h"
+#include "Subsystems/PRDamageableSpatialHashSubsystem.h"
+#include "Interfaces/PRClassCapabilityRegistry.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "Engine/OverlapResult.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace PRDamageableSpatialHashTests
+{
+	/** 대상을 배치하는 원의 수입니다. */
+	constexpr int32 RingCount = 10;
+
+	/** 가장 안쪽 원의 반지름입니다. */
+	constexpr float FirstRingRadius = 300.0f;
+
+	/** 원 사이의 간격입니다. */
+	constexpr float RingSpacing = 200.0f;
+
+	/** 한 원에 배치하는 대상 사이의 각도(도)입니다. */
+	constexpr float TargetAngleStep = 20.0f;
+
+	/** 검색 시간을 측정할 때 반복할 횟수입니다. */
+	constexpr int32 TimingIterations = 1000;
+
+	/**
+	 * 대미지를 받을 캐릭터를 원점을 중심으로 하는 여러 원 위에 Spawn하는 함수입니다.
+	 * 검색 영역의 경계가 대상의 충돌 반지름보다 멀리 떨어지도록 원과 각도의 간격을 설정합니다.
+	 *
+	 * @param TestWorld 캐릭터를 Spawn할 월드입니다.
+	 * @param OutTargets Spawn한 캐릭터입니다.
+	 */
+	void SpawnRingTargets(const FPRAutomationTestWorld& TestWorld, TArray<APRBaseCharacter*>& OutTargets)
+	{
+		const int32 TargetsPerRing = FMath::RoundToInt32(360.0f / TargetAngleStep);
+		OutTargets.Reset(RingCount * TargetsPerRing);
+		for(int32 Ring = 0; Ring < RingCount; Ring++)
+		{
+			for(int32 Step = 0; Step < TargetsPerRing; Step++)
+			{
+				const FVector Location = FRotator(0.0f, Step * TargetAngleStep, 0.0f).Vector() * (FirstRingRadius + Ring * RingSpacing);
+				APRBaseCharacter* Target = TestWorld.World->SpawnActor<APRBaseCharacter>(APRBaseCharacter::StaticClass(), FTransform(Location));
+				if(IsValid(Target))
+				{
+					// 중력으로 떨어지지 않도록 이동을 비활성화합니다.
+					Target->GetCharacterMovement()->DisableMovement();
+					OutTargets.Add(Target);
+				}
+			}
+		}
+	}
+
+	/**
+	 * 물리 검색 결과에서 대미지를 받을 수 있는 액터를 추가하는 함수입니다.
+	 *
+	 * @param Results 물리 검색 결과입니다. FOverlapResult나 FHitResult를 사용합니다.
+	 * @param OutActors 대미지를 받을 수 있는 액터를 추가할 집합입니다.
+	 */
+	template <typename ResultType>
+	void CollectDamageableActors(const TArray<ResultType>& Results, TSet<AActor*>& OutActors)
+	{
+		for(const ResultType& Result : Results)
+		{
+			AActor* Actor = Result.GetActor();
+			if(IsValid(Actor) && FPRClassCapabilityRegistry::IsDamageableClass(Actor->GetClass()))
+			{
+				OutActors.Add(Actor);
+			}
+		}
+	}
+
+	/**
+	 * 같은 영역을 공간 해시와 물리 검색으로 검색하여 검색한 액터가 같은지 확인하고 검색 시간을 기록하는 함수입니다.
+	 *
+	 * @param Test 결과를 기록할 테스트입니다.
+	 * @param ShapeName 검색 영역의 이름입니다.
+	 * @param SpatialHashQuery 공간 해시로 검색하는 함수입니다.
+	 * @param PhysicsQuery 물리 검색으로 대미지를 받을 수 있는 액터를 검색하는 함수입니다.
+	 */
+	void TestSameActors(FAutomationTestBase& Test, const TCHAR* ShapeName,
+		TFunctionRef<void(TArray<FPRDamageableQueryResult>&)> SpatialHashQuery, TFunctionRef<void(TSet<AActor*>&)> PhysicsQuery)
+	{
+		TArray<FPRDamageableQueryResult> QueryResults;
+		SpatialHashQuery(QueryResults);
+		TSet<AActor*> SpatialHashActors;
+		for(const FPRDamageableQueryResult& QueryResult : QueryResults)
+		{
+			SpatialHashActors.Add(QueryResult.Actor);
+		}
+
+		TSet<AActor*> PhysicsActors;
+		PhysicsQuery(PhysicsActors);
+
+		Test.TestTrue(*FString::Printf(TEXT("%s found actors"), ShapeName), PhysicsActors.Num() > 0);
+		Test.TestEqual(*FString::Printf(TEXT("%s result count"), ShapeName), QueryResults.Num(), SpatialHashActors.Num());
+		Test.TestEqual(*FString::Printf(TEXT("%s actor count"), ShapeName), SpatialHashActors.Num(), PhysicsActors.Num());
+		for(const AActor* PhysicsActor : PhysicsActors)
+		{
+			Test.TestTrue(*FString::Printf(TEXT("%s found %s"), ShapeName, *PhysicsActor->GetName()), SpatialHashActors.Contains(PhysicsActor));
+		}
+
+		// 같은 검색을 반복하여 검색 시간을 비교합니다.
+		double StartTime = FPlatformTime::Seconds();
+		for(int32 Index = 0; Index < TimingIterations; Index++)
+		{
+			QueryResults.Reset();
+			SpatialHashQuery(QueryResults);
+		}
+
+		const double SpatialHashTime = FPlatformTime::Seconds() - StartTime;
+
+		StartTime = FPlatformTime::Seconds();
+		for(int32 Index = 0; Index < TimingIterations; Index++)
+		{
+			PhysicsActors.Reset();
+			PhysicsQuery(PhysicsActors);
+		}
+
+		const double PhysicsTime = FPlatformTime::Seconds() - StartTime;
+
+		Test.AddInfo(FString::Printf(TEXT("%s query x%d (%d actors): spatial hash %.3f ms, physics %.3f ms."),
+			ShapeName, TimingIterations, SpatialHashActors.Num(), SpatialHashTime * 1000.0, PhysicsTime * 1000.0));
+	}
+}
+
+/**
+ * 공간 해시의 구, 캡슐, 원기둥, 원뿔 검색이 같은 영역의 물리 검색과 같은 액터를 검색하는지 확인하고 검색 시간을 비교하는 테스트입니다.
+ * 물리 검색에는 원기둥과 원뿔 모양이 없으므로 원기둥은 세로로 이동한 구로 검색하고, 원뿔은 구 영역으로 검색한 뒤 액터의 위치로 각도와 길이를 검사합니다.
+ * 대상의 세로 범위가 원기둥의 높이를 모두 덮고 원뿔의 경계가 대상과 충돌 반지름보다 멀리 떨어지도록 배치하므로 두 검색의 결과는 같아야 합니다.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPRDamageableSpatialHashQueryTest, "ProjectReplica.DamageableSpatialHash.QueriesMatchPhysics", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FPRDamageableSpatialHashQueryTest::RunTest(const FString& Parameters)
+{
+	using namespace PRDamageableSpatialHashTests;
+
+	FPRAutomationTestWorld TestWorld;
+	UPRDamageableSpatialHashSubsystem* SpatialHash = TestWorld.World->GetSubsystem<UPRDamageableSpatialHashSubsystem>();
+	if(!TestNotNull(TEXT("DamageableSpatialHashSubsystem"), SpatialHash))
+	{
+		return false;
+	}
+
+	TArray<APRBaseCharacter*> Targets;
+	SpawnRingTargets(TestWorld, Targets);
+	if(!TestEqual(TEXT("Registered damageables"), SpatialHash->GetDamageableCount(), Targets.Num()))
+	{
+		return false;
+	}
+
+	TestWorld.Tick();
+
+	UWorld* World = TestWorld.World;
+	const FCollisionObjectQueryParams ObjectQueryParams(ECC_Pawn);
+
+	// 구
+	{
+		const FVector Center = FVector::ZeroVector;
+		constexpr float Radius = 1000.0f;
+		TestSameActors(*this, TEXT("Sphere"),
+			[&](TArray<FPRDamageableQueryResult>& OutResults)
+			{
+				SpatialHash->QuerySphere(Center, Radius, nullptr, OutResults);
+			},
+			[&](TSet<AActor*>& OutActors)
+			{
+				TArray<FOverlapResult> OverlapResults;
+				World->OverlapMultiByObjectType(OverlapResults, Center, FQuat::Identity, ObjectQueryParams, FCollisionShape::MakeSphere(Radius));
+				CollectDamageableActors(OverlapResults, OutActors);
+			});
+	}
+
+	// 캡슐
+	{
+		const FVector Start(-2500.0f, 0.0f, 0.0f);
+		const FVector End(2500.0f, 0.0f, 0.0f);
+		constexpr float Radius = 100.0f;
+		TestSameActors(*this, TEXT("Capsule"),
+			[&](TArray<FPRDamageableQueryResult>& OutResults)
+			{
+				SpatialHash->QueryCapsule(Start, End, Radius, nullptr, OutResults);
+			},
+			[&](TSet<AActor*>& OutActors)
+			{
+				TArray<FHitResult> HitResults;
+				World->SweepMultiByObjectType(HitResults, Start, End, FQuat::Identity, ObjectQueryParams, FCollisionShape::MakeSphere(Radius));
+				CollectDamageableActors(HitResults, OutActors);
+			});
+	}
+
+	// 원기둥
+	{
+		const FVector Base(0.0f, 0.0f, -50.0f);
+		constexpr float Radius = 800.0f;
+		constexpr float Height = 100.0f;
+		TestSameActors(*this, TEXT("Cylinder"),
+			[&](TArray<FPRDamageableQueryResult>& OutResults)
+			{
+				SpatialHash->QueryCylinder(Base, Radius, Height, nullptr, OutResults);
+			},
+			[&](TSet<AActor*>& OutActors)
+			{
+				TArray<FHitResult> HitResults;
+				World->SweepMultiByObjectType(HitResults, Base, Base + FVector(0.0f, 0.0f, Height), FQuat::Identity, ObjectQueryParams, FCollisionShape::MakeSphere(Radius));
+				CollectDamageableActors(HitResults, OutActors);
+			});
+	}
+
+	// 원뿔
+	{
+		const FVector Origin = FVector::ZeroVector;
+		const FVector Direction = FVector::ForwardVector;
+		constexpr float Length = 950.0f;
+		constexpr float HalfAngle = 50.0f;
+		TestSameActors(*this, TEXT("Cone"),
+			[&](TArray<FPRDamageableQueryResult>& OutResults)
+			{
+				SpatialHash->QueryCone(Origin, Direction, Length, HalfAngle, nullptr, OutResults);
+			},
+			[&](TSet<AActor*>& OutActors)
+			{
+				// 원뿔을 감싸는 구로 검색한 뒤 액터의 위치가 원뿔 안에 있는지 검사합니다.
+				TArray<FOverlapResult> OverlapResults;
+				const float BoundingRadius = Length / FMath::Cos(FMath::DegreesToRadians(HalfAngle));
+				World->OverlapMultiByObjectType(OverlapResults, Origin, FQuat::Identity, ObjectQueryParams, FCollisionShape::MakeSphere(BoundingRadius));
+
+				TSet<AActor*> CandidateActors;
+				CollectDamageableActors(OverlapResults, CandidateActors);
+				const float CosHalfAngle = FMath::Cos(FMath::DegreesToRadians(HalfAngle));
+				for(AActor* CandidateActor : CandidateActors)
+				{
+					const FVector ToActor = CandidateActor->GetActorLocation() - Origin;
+					if(FVector::DotProduct(ToActor, Direction) <= Length
+						&& FVector::DotProduct(ToActor.GetSafeNormal(), Direction) >= CosHalfAngle)
+					{
+						OutActors.Add(CandidateActor);
+					}
+				}
+			});
+	}
+
+	return true;
+}
+
+#endif
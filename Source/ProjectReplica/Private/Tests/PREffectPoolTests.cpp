@@ -0,0 +1,356 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Tests/PRAutomationTestWorld.h"
+#include "Components/PREffectSystemComponent.h"
+#include "Effects/PRNiagaraEffect.h"
+#include "Effects/PRParticleEffect.h"
+#include "Effects/PREffectPoolBenchmark.h"
+#include "Engine/DataTable.h"
+#include "HAL/FileManager.h"
+#include "Misc/AutomationTest.h"
+#include "NiagaraSystem.h"
+#include "Particles/ParticleSystem.h"
+#include "UObject/Package.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace PREffectPoolTests
+{
+	/** 테스트에서 생성하는 ParticlePool의 크기입니다. */
+	constexpr int32 ParticlePoolSize = 8;
+
+	/** Pool의 크기만큼 Spawn하고 모두 비활성화하는 과정을 반복할 횟수입니다. */
+	constexpr int32 ParticleSpawnRounds = 4;
+
+	/** 첫 번째 Spawn 테스트에서 NiagaraSystem을 가져오는 플레이어 캐릭터의 NiagaraPool 설정 값 데이터 테이블입니다. */
+	const TCHAR* PlayerNiagaraPoolSettingsPath = TEXT("/Game/Data/Player/DT_PlayerCharacter_NiagaraPoolSettings.DT_PlayerCharacter_NiagaraPoolSettings");
+
+	/** 첫 번째 Spawn 테스트에서 동시에 Spawn할 NiagaraEffect의 최대 수입니다. */
+	constexpr int32 MaxFirstSpawnSamples = 8;
+
+	/** 첫 번째 활성화가 이후 활성화의 평균보다 이 배수까지 느린 것을 허용합니다. */
+	constexpr float FirstSpawnTolerance = 4.0f;
+
+	/** 활성화 시간이 측정 오차 수준일 때 비교하지 않도록 허용하는 최소 시간(초)입니다. */
+	constexpr float FirstSpawnMinTolerance = 0.0005f;
+
+	/** 이펙트 Pool 벤치마크에서 매 프레임 Spawn할 이펙트의 수입니다. */
+	constexpr int32 BenchmarkEffectsPerFrame = 20;
+
+	/** 이펙트 Pool 벤치마크에서 Spawn 방식별로 측정할 프레임의 수입니다. */
+	constexpr int32 BenchmarkMeasureFrames = 120;
+
+	/** 이펙트 Pool 벤치마크에서 Spawn 방식을 바꾼 후 기다릴 프레임의 수입니다. */
+	constexpr int32 BenchmarkCooldownFrames = 30;
+
+	/**
+	 * 주어진 ParticleSystem의 Pool 설정 값을 가진 데이터 테이블을 생성하는 함수입니다.
+	 *
+	 * @param ParticleSystem Pool을 생성할 ParticleSystem입니다.
+	 * @param PoolSize Pool의 크기입니다.
+	 * @return 생성한 데이터 테이블입니다.
+	 */
+	UDataTable* CreateParticlePoolSettingsDataTable(UParticleSystem* ParticleSystem, int32 PoolSize)
+	{
+		UDataTable* ParticlePoolSettingsDataTable = NewObject<UDataTable>(GetTransientPackage());
+		ParticlePoolSettingsDataTable->RowStruct = FPRParticleEffectPoolSettings::StaticStruct();
+		ParticlePoolSettingsDataTable->AddRow(TEXT("TestParticleSystem"), FPRParticleEffectPoolSettings(ParticleSystem, PoolSize, 0.0f));
+
+		return ParticlePoolSettingsDataTable;
+	}
+
+	/**
+	 * 주어진 데이터 테이블로 ParticlePool을 생성한 EffectSystem을 액터에 추가하는 함수입니다.
+	 *
+	 * @param Owner EffectSystem을 추가할 액터입니다.
+	 * @param ParticlePoolSettingsDataTable ParticlePool의 설정 값을 가진 데이터 테이블입니다.
+	 * @return Pool을 생성하고 통계를 초기화한 EffectSystem입니다.
+	 */
+	UPREffectSystemComponent* AddParticleEffectSystem(AActor* Owner, UDataTable* ParticlePoolSettingsDataTable)
+	{
+		UPREffectSystemComponent* EffectSystem = FPRAutomationTestWorld::AddComponent<UPREffectSystemComponent>(Owner, [ParticlePoolSettingsDataTable](UPREffectSystemComponent* Component)
+		{
+			FPRAutomationTestWorld::SetPropertyValue<TObjectPtr<UDataTable>>(Component, TEXT("ParticlePoolSettingsDataTable"), ParticlePoolSettingsDataTable);
+		});
+
+		EffectSystem->InitializeObjectPool();
+		EffectSystem->ResetPoolStats();
+
+		return EffectSystem;
+	}
+}
+
+/**
+ * 크기가 지정된 ParticlePool에서 Spawn한 ParticleEffect가 모두 Pool에서 재사용되는지 확인하는 테스트입니다.
+ * Pool의 크기를 넘지 않는 동안 Pool 적중률은 1이어야 하고 동적으로 생성한 ParticleEffect가 없어야 합니다.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPRParticlePoolHitRateTest, "ProjectReplica.EffectSystem.ParticlePool.HitRate", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FPRParticlePoolHitRateTest::RunTest(const FString& Parameters)
+{
+	using namespace PREffectPoolTests;
+
+	FPRAutomationTestWorld TestWorld;
+	UParticleSystem* ParticleSystem = NewObject<UParticleSystem>(GetTransientPackage());
+	AActor* Owner = TestWorld.SpawnActor();
+	UPREffectSystemComponent* EffectSystem = AddParticleEffectSystem(Owner, CreateParticlePoolSettingsDataTable(ParticleSystem, ParticlePoolSize));
+	if(!TestTrue(TEXT("ParticlePool is created from the data table"), EffectSystem->IsCreateParticlePool(ParticleSystem)))
+	{
+		return false;
+	}
+
+	// Pool의 크기만큼 동시에 Spawn한 후 모두 비활성화하는 과정을 반복합니다. 위치 Spawn과 부착 Spawn을 번갈아 사용합니다.
+	TArray<APRParticleEffect*> SpawnedParticleEffects;
+	for(int32 Round = 0; Round < ParticleSpawnRounds; Round++)
+	{
+		for(int32 Index = 0; Index < ParticlePoolSize; Index++)
+		{
+			APRParticleEffect* ParticleEffect = Index % 2 == 0
+				? EffectSystem->SpawnParticleEffectAtLocation(ParticleSystem, FVector(Index * 100.0f, 0.0f, 0.0f))
+				: EffectSystem->SpawnParticleEffectAttached(ParticleSystem, Owner->GetRootComponent(), NAME_None, FVector::ZeroVector, FRotator::ZeroRotator);
+			if(!TestNotNull(TEXT("Spawned pooled ParticleEffect"), ParticleEffect))
+			{
+				return false;
+			}
+
+			TestTrue(TEXT("Spawned ParticleEffect is active"), EffectSystem->IsActivateParticleEffect(ParticleEffect));
+			TestFalse(TEXT("Spawned ParticleEffect is not dynamic"), EffectSystem->IsDynamicParticleEffect(ParticleEffect));
+			SpawnedParticleEffects.Add(ParticleEffect);
+		}
+
+		for(APRParticleEffect* ParticleEffect : SpawnedParticleEffects)
+		{
+			EffectSystem->DeactivateObject(ParticleEffect);
+		}
+
+		SpawnedParticleEffects.Reset();
+		TestWorld.Tick();
+	}
+
+	const FPREffectPoolStats ParticlePoolStats = EffectSystem->GetParticlePoolStats();
+	TestEqual(TEXT("SpawnRequests"), ParticlePoolStats.SpawnRequests, ParticlePoolSize * ParticleSpawnRounds);
+	TestEqual(TEXT("PoolHits"), ParticlePoolStats.PoolHits, ParticlePoolSize * ParticleSpawnRounds);
+	TestEqual(TEXT("PoolMisses"), ParticlePoolStats.PoolMisses, 0);
+	TestEqual(TEXT("DynamicCreations"), ParticlePoolStats.DynamicCreations, 0);
+	TestEqual(TEXT("PoolHitRate"), ParticlePoolStats.GetPoolHitRate(), 1.0f);
+
+	return true;
+}
+
+/**
+ * ParticlePool의 모든 ParticleEffect가 사용 중일 때 요청한 만큼만 동적으로 생성하는지 확인하는 테스트입니다.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPRParticlePoolOverflowTest, "ProjectReplica.EffectSystem.ParticlePool.Overflow", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FPRParticlePoolOverflowTest::RunTest(const FString& Parameters)
+{
+	using namespace PREffectPoolTests;
+
+	FPRAutomationTestWorld TestWorld;
+	UParticleSystem* ParticleSystem = NewObject<UParticleSystem>(GetTransientPackage());
+	AActor* Owner = TestWorld.SpawnActor();
+	UPREffectSystemComponent* EffectSystem = AddParticleEffectSystem(Owner, CreateParticlePoolSettingsDataTable(ParticleSystem, ParticlePoolSize));
+
+	// Pool의 크기보다 하나 더 Spawn합니다.
+	APRParticleEffect* OverflowParticleEffect = nullptr;
+	for(int32 Index = 0; Index <= ParticlePoolSize; Index++)
+	{
+		OverflowParticleEffect = EffectSystem->SpawnParticleEffectAtLocation(ParticleSystem, FVector::ZeroVector);
+		if(!TestNotNull(TEXT("Spawned ParticleEffect"), OverflowParticleEffect))
+		{
+			return false;
+		}
+	}
+
+	TestTrue(TEXT("Overflow ParticleEffect is dynamic"), EffectSystem->IsDynamicParticleEffect(OverflowParticleEffect));
+
+	const FPREffectPoolStats ParticlePoolStats = EffectSystem->GetParticlePoolStats();
+	TestEqual(TEXT("PoolHits"), ParticlePoolStats.PoolHits, ParticlePoolSize);
+	TestEqual(TEXT("PoolMisses"), ParticlePoolStats.PoolMisses, 1);
+	TestEqual(TEXT("DynamicCreations"), ParticlePoolStats.DynamicCreations, 1);
+
+	return true;
+}
+
+/**
+ * 플레이어 캐릭터의 NiagaraPool 설정 값에 있는 NiagaraSystem마다 첫 번째 Spawn과 이후 Spawn의 비용을 비교하는 테스트입니다.
+ * Pool을 생성할 때 NiagaraEffect를 준비하므로 Pool의 각 NiagaraEffect를 처음 활성화하는 비용이 이후 활성화와 비슷해야 합니다.
+ */
+IMPLEMENT_COMPLEX_AUTOMATION_TEST(FPRNiagaraPoolFirstSpawnTest, "ProjectReplica.EffectSystem.NiagaraPool.FirstSpawn", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+void FPRNiagaraPoolFirstSpawnTest::GetTests(TArray<FString>& OutBeautifiedNames, TArray<FString>& OutTestCommands) const
+{
+	const UDataTable* PlayerNiagaraPoolSettingsDataTable = LoadObject<UDataTable>(nullptr, PREffectPoolTests::PlayerNiagaraPoolSettingsPath);
+	if(!PlayerNiagaraPoolSettingsDataTable)
+	{
+		return;
+	}
+
+	for(const FName& RowName : PlayerNiagaraPoolSettingsDataTable->GetRowNames())
+	{
+		OutBeautifiedNames.Add(RowName.ToString());
+		OutTestCommands.Add(RowName.ToString());
+	}
+}
+
+bool FPRNiagaraPoolFirstSpawnTest::RunTest(const FString& Parameters)
+{
+	using namespace PREffectPoolTests;
+
+	const UDataTable* PlayerNiagaraPoolSettingsDataTable = LoadObject<UDataTable>(nullptr, PlayerNiagaraPoolSettingsPath);
+	if(!TestNotNull(TEXT("Player NiagaraPool settings data table"), PlayerNiagaraPoolSettingsDataTable))
+	{
+		return false;
+	}
+
+	const FPRNiagaraEffectPoolSettings* NiagaraPoolSettings = PlayerNiagaraPoolSettingsDataTable->FindRow<FPRNiagaraEffectPoolSettings>(FName(*Parameters), FString(""));
+	if(!TestNotNull(TEXT("NiagaraPool settings row"), NiagaraPoolSettings) || !TestNotNull(TEXT("NiagaraSystem"), NiagaraPoolSettings->NiagaraSystem.Get()))
+	{
+		return false;
+	}
+
+	const int32 SampleCount = FMath::Min(NiagaraPoolSettings->PoolSize, MaxFirstSpawnSamples);
+	if(SampleCount < 2)
+	{
+		AddInfo(FString::Printf(TEXT("Skipped: PoolSize %d is too small to compare the first spawn with later spawns."), NiagaraPoolSettings->PoolSize));
+		return true;
+	}
+
+	// 테스트할 NiagaraSystem의 Pool만 생성합니다.
+	UDataTable* NiagaraPoolSettingsDataTable = NewObject<UDataTable>(GetTransientPackage());
+	NiagaraPoolSettingsDataTable->RowStruct = FPRNiagaraEffectPoolSettings::StaticStruct();
+	NiagaraPoolSettingsDataTable->AddRow(FName(*Parameters), *NiagaraPoolSettings);
+
+	FPRAutomationTestWorld TestWorld;
+	AActor* Owner = TestWorld.SpawnActor();
+	UPREffectSystemComponent* EffectSystem = FPRAutomationTestWorld::AddComponent<UPREffectSystemComponent>(Owner, [NiagaraPoolSettingsDataTable](UPREffectSystemComponent* Component)
+	{
+		FPRAutomationTestWorld::SetPropertyValue<TObjectPtr<UDataTable>>(Component, TEXT("NiagaraPoolSettingsDataTable"), NiagaraPoolSettingsDataTable);
+		FPRAutomationTestWorld::SetPropertyValue<bool>(Component, TEXT("bUseNiagaraEffectLOD"), false);
+	});
+
+	EffectSystem->InitializeObjectPool();
+	EffectSystem->ResetPoolStats();
+
+	// Pool의 서로 다른 NiagaraEffect를 동시에 Spawn하여 각 NiagaraEffect를 처음 활성화하는 비용을 측정합니다.
+	TArray<APRNiagaraEffect*> SpawnedNiagaraEffects;
+	for(int32 Index = 0; Index < SampleCount; Index++)
+	{
+		APRNiagaraEffect* NiagaraEffect = EffectSystem->SpawnNiagaraEffectAtLocation(NiagaraPoolSettings->NiagaraSystem, FVector(Index * 100.0f, 0.0f, 0.0f));
+		if(!TestNotNull(TEXT("Spawned pooled NiagaraEffect"), NiagaraEffect))
+		{
+			return false;
+		}
+
+		SpawnedNiagaraEffects.Add(NiagaraEffect);
+	}
+
+	for(APRNiagaraEffect* NiagaraEffect : SpawnedNiagaraEffects)
+	{
+		EffectSystem->DeactivateObject(NiagaraEffect);
+	}
+
+	const FPREffectActivationStats ActivationStats = EffectSystem->GetNiagaraActivationStats(NiagaraPoolSettings->NiagaraSystem);
+	const FPREffectPoolStats NiagaraPoolStats = EffectSystem->GetNiagaraPoolStats();
+	AddInfo(FString::Printf(TEXT("%s: first spawn %.3f ms, later spawns %.3f ms on average over %d samples, %d primed effects."),
+		*Parameters, ActivationStats.FirstActivationTime * 1000.0f, ActivationStats.GetAverageLaterActivationTime() * 1000.0f, ActivationStats.Activations, NiagaraPoolStats.PrimedEffects));
+
+	TestEqual(TEXT("Activations"), ActivationStats.Activations, SampleCount);
+	TestEqual(TEXT("DynamicCreations"), NiagaraPoolStats.DynamicCreations, 0);
+
+	const float AllowedFirstActivationTime = FMath::Max(ActivationStats.GetAverageLaterActivationTime() * FirstSpawnTolerance, FirstSpawnMinTolerance);
+	TestTrue(FString::Printf(TEXT("First spawn %.3f ms is within %.3f ms"), ActivationStats.FirstActivationTime * 1000.0f, AllowedFirstActivationTime * 1000.0f),
+		ActivationStats.FirstActivationTime <= AllowedFirstActivationTime);
+
+	return true;
+}
+
+/**
+ * 헤드리스 월드에서 CustomPool, AutoRelease, NoPooling 방식의 이펙트 Spawn 비용을 측정하고 결과를 CSV로 저장하는 벤치마크입니다.
+ * 플레이어 캐릭터의 NiagaraPool 설정 값에 있는 첫 번째 NiagaraSystem을 사용합니다.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPREffectPoolBenchmarkTest, "ProjectReplica.EffectSystem.Benchmark.PoolModes", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FPREffectPoolBenchmarkTest::RunTest(const FString& Parameters)
+{
+	using namespace PREffectPoolTests;
+
+	const UDataTable* PlayerNiagaraPoolSettingsDataTable = LoadObject<UDataTable>(nullptr, PlayerNiagaraPoolSettingsPath);
+	if(!TestNotNull(TEXT("Player NiagaraPool settings data table"), PlayerNiagaraPoolSettingsDataTable))
+	{
+		return false;
+	}
+
+	UNiagaraSystem* BenchmarkNiagaraSystem = nullptr;
+	for(const FName& RowName : PlayerNiagaraPoolSettingsDataTable->GetRowNames())
+	{
+		const FPRNiagaraEffectPoolSettings* NiagaraPoolSettings = PlayerNiagaraPoolSettingsDataTable->FindRow<FPRNiagaraEffectPoolSettings>(RowName, FString(""));
+		if(NiagaraPoolSettings && NiagaraPoolSettings->NiagaraSystem)
+		{
+			BenchmarkNiagaraSystem = NiagaraPoolSettings->NiagaraSystem;
+			break;
+		}
+	}
+
+	if(!TestNotNull(TEXT("Benchmark NiagaraSystem"), BenchmarkNiagaraSystem))
+	{
+		return false;
+	}
+
+	// BeginPlay에서 벤치마크가 시작되지 않도록 설정 값을 지정한 후 Spawn을 끝냅니다.
+	FPRAutomationTestWorld TestWorld;
+	APREffectPoolBenchmark* Benchmark = TestWorld.World->SpawnActorDeferred<APREffectPoolBenchmark>(APREffectPoolBenchmark::StaticClass(), FTransform::Identity);
+	if(!TestNotNull(TEXT("Benchmark actor"), Benchmark))
+	{
+		return false;
+	}
+
+	FPRAutomationTestWorld::SetPropertyValue<TObjectPtr<UNiagaraSystem>>(Benchmark, TEXT("BenchmarkNiagaraSystem"), BenchmarkNiagaraSystem);
+	FPRAutomationTestWorld::SetPropertyValue<int32>(Benchmark, TEXT("EffectsPerFrame"), BenchmarkEffectsPerFrame);
+	FPRAutomationTestWorld::SetPropertyValue<int32>(Benchmark, TEXT("MeasureFrames"), BenchmarkMeasureFrames);
+	FPRAutomationTestWorld::SetPropertyValue<int32>(Benchmark, TEXT("CooldownFrames"), BenchmarkCooldownFrames);
+	FPRAutomationTestWorld::SetPropertyValue<bool>(Benchmark, TEXT("bStartOnBeginPlay"), false);
+	Benchmark->FinishSpawning(FTransform::Identity);
+
+	Benchmark->StartBenchmark();
+	if(!TestTrue(TEXT("Benchmark started"), Benchmark->IsBenchmarkRunning()))
+	{
+		return false;
+	}
+
+	// 벤치마크가 끝나지 않아도 테스트가 멈추지 않도록 필요한 프레임보다 넉넉하게 Tick합니다.
+	const int32 MaxBenchmarkFrames = (BenchmarkMeasureFrames + BenchmarkCooldownFrames) * 3 + 10;
+	for(int32 Frame = 0; Frame < MaxBenchmarkFrames && Benchmark->IsBenchmarkRunning(); Frame++)
+	{
+		TestWorld.Tick();
+	}
+
+	if(!TestFalse(TEXT("Benchmark finished"), Benchmark->IsBenchmarkRunning()))
+	{
+		return false;
+	}
+
+	const TArray<FPREffectPoolBenchmarkResult> BenchmarkResults = Benchmark->GetBenchmarkResults();
+	TestEqual(TEXT("Measured modes"), BenchmarkResults.Num(), 3);
+	for(const FPREffectPoolBenchmarkResult& BenchmarkResult : BenchmarkResults)
+	{
+		const FString ModeName = UEnum::GetDisplayValueAsText(BenchmarkResult.Mode).ToString();
+		TestEqual(*FString::Printf(TEXT("%s frames"), *ModeName), BenchmarkResult.Frames, BenchmarkMeasureFrames);
+		TestEqual(*FString::Printf(TEXT("%s spawned effects"), *ModeName), BenchmarkResult.SpawnedEffects, BenchmarkMeasureFrames * BenchmarkEffectsPerFrame);
+		AddInfo(FString::Printf(TEXT("%s: %.3f ms/frame average, %.3f ms/frame max, %.2f MB, %d GC (%.3f ms)."),
+			*ModeName, BenchmarkResult.TotalSpawnTime * 1000.0 / FMath::Max(BenchmarkResult.Frames, 1), BenchmarkResult.MaxFrameSpawnTime * 1000.0,
+			BenchmarkResult.MemoryDeltaMB, BenchmarkResult.GarbageCollections, BenchmarkResult.GarbageCollectionTime * 1000.0));
+	}
+
+	const FString CsvFilePath = Benchmark->GetBenchmarkCsvFilePath();
+	if(TestFalse(TEXT("CSV file path"), CsvFilePath.IsEmpty()))
+	{
+		TestTrue(TEXT("CSV file exists"), IFileManager::Get().FileExists(*CsvFilePath));
+		AddInfo(FString::Printf(TEXT("Benchmark results saved to %s"), *CsvFilePath));
+	}
+
+	return true;
+}
+
+#endif
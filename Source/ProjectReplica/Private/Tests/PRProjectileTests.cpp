@@ -0,0 +1,121 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Tests/PRAutomationTestWorld.h"
+#include "Subsystems/PRProjectileSubsystem.h"
+#include "Objects/PRPooledObject.h"
+#include "Interfaces/PRInterfaceDispatch.h"
+#include "EngineUtils.h"
+#include "GameFramework/PlayerController.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace PRProjectileTests
+{
+	/** 테스트에서 생성하는 발사체의 수입니다. 동시에 표시할 수 있는 발사체의 최대 수로도 사용하여 한도에 도달한 상태에서 확인합니다. */
+	constexpr int32 ProjectileCount = 4;
+
+	/** 발사체를 표시하는 오브젝트를 외부에서 소멸시키는 횟수입니다. */
+	constexpr int32 DestroyRounds = 3;
+
+	/**
+	 * 월드에서 활성화되어 있는 발사체를 표시하는 오브젝트를 가져오는 함수입니다.
+	 *
+	 * @param World 오브젝트를 찾을 월드입니다.
+	 * @param OutVisuals 활성화되어 있는 오브젝트입니다.
+	 */
+	void GetActiveVisuals(UWorld* World, TArray<APRPooledObject*>& OutVisuals)
+	{
+		OutVisuals.Reset();
+		for(TActorIterator<APRPooledObject> It(World); It; ++It)
+		{
+			if(FPRPoolableDispatch::IsActivate(*It))
+			{
+				OutVisuals.Add(*It);
+			}
+		}
+	}
+}
+
+/**
+ * 발사체를 표시하는 오브젝트가 Pool에 반환되기 전에 외부에서 소멸되어도 표시하고 있는 오브젝트의 수가 실제 오브젝트의 수와 같게 유지되는지 확인하는 테스트입니다.
+ * 수가 줄지 않으면 최대 수에 도달한 후 발사체를 더 이상 표시하지 않으므로, 최대 수에 도달한 상태에서 오브젝트를 반복해서 소멸시킵니다.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPRProjectileDestroyedVisualTest, "ProjectReplica.Projectile.DestroyedVisuals", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FPRProjectileDestroyedVisualTest::RunTest(const FString& Parameters)
+{
+	using namespace PRProjectileTests;
+
+	FPRAutomationTestWorld TestWorld;
+	UPRProjectileSubsystem* ProjectileSubsystem = TestWorld.World->GetSubsystem<UPRProjectileSubsystem>();
+	if(!TestNotNull(TEXT("ProjectileSubsystem"), ProjectileSubsystem)
+		|| !TestTrue(TEXT("Set MaxActiveVisuals"), FPRAutomationTestWorld::SetPropertyValue<int32>(ProjectileSubsystem, TEXT("MaxActiveVisuals"), ProjectileCount)))
+	{
+		return false;
+	}
+
+	// 발사체는 로컬 플레이어의 시점에서 가까울 때만 표시하므로 원점에 로컬 PlayerController를 배치합니다.
+	APlayerController* PlayerController = TestWorld.World->SpawnActor<APlayerController>();
+	if(!TestNotNull(TEXT("PlayerController"), PlayerController))
+	{
+		return false;
+	}
+
+	PlayerController->SetAsLocalPlayerController();
+
+	FPRProjectileSettings ProjectileSettings;
+	ProjectileSettings.Speed = 0.0f;
+	ProjectileSettings.Lifespan = 60.0f;
+	ProjectileSettings.bCollideWithWorld = false;
+	ProjectileSettings.VisualClass = APRPooledObject::StaticClass();
+
+	TArray<int32> ProjectileIDs;
+	for(int32 Index = 0; Index < ProjectileCount; Index++)
+	{
+		ProjectileIDs.Add(ProjectileSubsystem->SpawnProjectile(nullptr, FVector(Index * 100.0f, 0.0f, 0.0f), FVector::ForwardVector, ProjectileSettings));
+	}
+
+	TestWorld.Tick();
+
+	TArray<APRPooledObject*> Visuals;
+	GetActiveVisuals(TestWorld.World, Visuals);
+	if(!TestEqual(TEXT("Initial visuals"), Visuals.Num(), ProjectileCount)
+		|| !TestEqual(TEXT("Initial ActiveVisualCount"), ProjectileSubsystem->GetActiveVisualCount(), ProjectileCount))
+	{
+		return false;
+	}
+
+	// 모든 오브젝트를 외부에서 소멸시켜도 다음 Tick에 다시 표시해야 합니다.
+	for(int32 Round = 0; Round < DestroyRounds; Round++)
+	{
+		for(APRPooledObject* Visual : Visuals)
+		{
+			Visual->Destroy();
+		}
+
+		TestWorld.Tick();
+
+		GetActiveVisuals(TestWorld.World, Visuals);
+		TestEqual(*FString::Printf(TEXT("Round %d visuals"), Round), Visuals.Num(), ProjectileCount);
+		TestEqual(*FString::Printf(TEXT("Round %d ActiveVisualCount"), Round), ProjectileSubsystem->GetActiveVisualCount(), Visuals.Num());
+	}
+
+	// 발사체를 제거하기 전에 소멸된 오브젝트도 수에서 제외해야 합니다.
+	if(Visuals.Num() > 0)
+	{
+		Visuals[0]->Destroy();
+	}
+
+	for(const int32 ProjectileID : ProjectileIDs)
+	{
+		ProjectileSubsystem->DestroyProjectile(ProjectileID);
+	}
+
+	TestEqual(TEXT("Projectiles after destroy"), ProjectileSubsystem->GetProjectileCount(), 0);
+	TestEqual(TEXT("ActiveVisualCount after destroy"), ProjectileSubsystem->GetActiveVisualCount(), 0);
+
+	return true;
+}
+
+#endif
@@ -4,6 +4,7 @@
 #include "Widgets/PRBaseHealthBarWidget.h"
 #include "Interfaces/PRDamageableInterface.h"
 #include "Components/ProgressBar.h"
+#include "Interfaces/PRInterfaceDispatch.h"
 
 UPRBaseHealthBarWidget::UPRBaseHealthBarWidget(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
@@ -37,8 +38,8 @@ void UPRBaseHealthBarWidget::UpdateHealthBarBuffer()
 {
 	if(HealthBarBuffer && IsImplementsDamageableInterface(DamageableTarget.GetObject()))
 	{
-		const float CurrentHealth = DamageableTarget->Execute_GetCurrentHealth(DamageableTarget.GetObject());
-		const float MaxHealth = DamageableTarget->Execute_GetMaxHealth(DamageableTarget.GetObject());
+		const float CurrentHealth = FPRDamageableDispatch::GetCurrentHealth(DamageableTarget.GetObject());
+		const float MaxHealth = FPRDamageableDispatch::GetMaxHealth(DamageableTarget.GetObject());
 		HealthBuffer = FMath::Lerp(HealthBuffer, CurrentHealth / MaxHealth, HealthBufferLerpSpeed);
 		HealthBarBuffer->SetPercent(HealthBuffer);
 	}
@@ -48,8 +49,8 @@ float UPRBaseHealthBarWidget::GetHealthBarPercent() const
 {
 	if(HealthBar && IsImplementsDamageableInterface(DamageableTarget.GetObject()))
 	{
-		const float CurrentHealth = DamageableTarget->Execute_GetCurrentHealth(DamageableTarget.GetObject());
-		const float MaxHealth = DamageableTarget->Execute_GetMaxHealth(DamageableTarget.GetObject());
+		const float CurrentHealth = FPRDamageableDispatch::GetCurrentHealth(DamageableTarget.GetObject());
+		const float MaxHealth = FPRDamageableDispatch::GetMaxHealth(DamageableTarget.GetObject());
 
 		return CurrentHealth / MaxHealth;
 	}
@@ -65,7 +66,7 @@ void UPRBaseHealthBarWidget::InitializeDamageableTarget(TScriptInterface<IPRDama
 
 bool UPRBaseHealthBarWidget::IsImplementsDamageableInterface(UObject* DamageableObject) const
 {
-	return IsValid(DamageableObject) && DamageableObject->GetClass()->ImplementsInterface(UPRDamageableInterface::StaticClass());
+	return FPRClassCapabilityRegistry::IsDamageable(DamageableObject);
 }
 #pragma endregion
 
@@ -23,6 +23,30 @@ void UPRDamageAmountWidget::InitializeDamageAmountWidget(float DamageAmount, boo
 		PlayAnimationForward(FadeOutWidgetAnim);
 	}
 	
+	SetDamageAmount(DamageAmount, bIsCritical);
+
+	// 색상 변경
+	UProjectReplicaGameInstance* PRGameInstance = Cast<UProjectReplicaGameInstance>(GetGameInstance());
+	if(PRGameInstance)
+	{
+		SetColorAndOpacity(PRGameInstance->GetElementColor(ElementType));
+	}
+}
+
+void UPRDamageAmountWidget::UpdateDamageAmountWidget(float DamageAmount, bool bIsCritical)
+{
+	// FadeOut을 처음부터 다시 재생하여 합산한 대미지가 표시되는 시간을 늘립니다.
+	if(FadeOutWidgetAnim)
+	{
+		PlayAnimationForward(FadeOutWidgetAnim);
+		SetAnimationCurrentTime(FadeOutWidgetAnim, 0.0f);
+	}
+
+	SetDamageAmount(DamageAmount, bIsCritical);
+}
+
+void UPRDamageAmountWidget::SetDamageAmount(float DamageAmount, bool bIsCritical)
+{
 	if(DamageAmountTextBlock)
 	{
 		// Text 변경
@@ -44,11 +68,4 @@ void UPRDamageAmountWidget::InitializeDamageAmountWidget(float DamageAmount, boo
 			CriticalImageCanvasPanel->SetVisibility(ESlateVisibility::Hidden);
 		}
 	}
-
-	// 색상 변경
-	UProjectReplicaGameInstance* PRGameInstance = Cast<UProjectReplicaGameInstance>(GetGameInstance());
-	if(PRGameInstance)
-	{
-		SetColorAndOpacity(PRGameInstance->GetElementColor(ElementType));
-	}
 }
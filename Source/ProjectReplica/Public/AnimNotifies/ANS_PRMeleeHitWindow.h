@@ -0,0 +1,107 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "ProjectReplica.h"
+#include "Animation/AnimNotifies/AnimNotifyState.h"
+#include "AnimNotifies/PRAnimNotifyInstanceKey.h"
+#include "UObject/ObjectKey.h"
+#include "ANS_PRMeleeHitWindow.generated.h"
+
+class APRBaseCharacter;
+class USceneComponent;
+
+/**
+ * 히트 윈도우의 Notify 인스턴스별 상태입니다.
+ * 하나의 인스턴스는 한 번의 휘두르기에 해당합니다.
+ */
+struct FPRMeleeHitWindowState
+{
+public:
+	FPRMeleeHitWindowState()
+		: PreviousWeaponStart(FVector::ZeroVector)
+		, PreviousWeaponEnd(FVector::ZeroVector)
+		, bHasPreviousPose(false)
+	{}
+
+public:
+	/** 이전 Tick에서 샘플링한 무기 충돌 형태의 WorldSpace 시작 위치입니다. */
+	FVector PreviousWeaponStart;
+
+	/** 이전 Tick에서 샘플링한 무기 충돌 형태의 WorldSpace 끝 위치입니다. */
+	FVector PreviousWeaponEnd;
+
+	/** 이전 Tick의 무기 자세가 존재하는지 나타내는 변수입니다. */
+	bool bHasPreviousPose;
+
+	/** 이번 휘두르기에서 이미 대미지를 준 액터입니다. 같은 대상을 한 번만 공격하기 위해 사용합니다. */
+	TArray<FObjectKey, TInlineAllocator<8>> HitActors;
+};
+
+/**
+ * 히트 윈도우 동안 장착한 무기의 충돌 형태를 이전 Tick과 현재 Tick의 자세 사이에서 Sweep하여 근접 공격의 대미지를 주는 AnimNotifyState 클래스입니다.
+ * 무기의 충돌 형태는 시작 Socket과 끝 Socket을 잇는 캡슐이며, 프레임레이트가 낮아 무기의 이동 거리가 길면 Sweep을 여러 번으로 나누어 실행합니다.
+ * 같은 휘두르기 동안 한 번 맞은 대상은 다시 공격하지 않습니다.
+ */
+UCLASS()
+class PROJECTREPLICA_API UANS_PRMeleeHitWindow : public UAnimNotifyState
+{
+	GENERATED_BODY()
+
+public:
+	UANS_PRMeleeHitWindow(const FObjectInitializer& ObjectInitializer);
+
+public:
+	virtual void NotifyBegin(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, float TotalDuration, const FAnimNotifyEventReference& EventReference) override;
+	virtual void NotifyTick(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, float FrameDeltaTime, const FAnimNotifyEventReference& EventReference) override;
+	virtual void NotifyEnd(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, const FAnimNotifyEventReference& EventReference) override;
+
+protected:
+	/**
+	 * 이전 자세에서 현재 자세까지 무기를 Sweep하여 새로 맞은 대상에게 대미지를 주는 함수입니다.
+	 *
+	 * @param MeshComp NotifyState를 실행한 MeshComponent입니다.
+	 * @param EventReference 실행 중인 Notify 이벤트입니다.
+	 */
+	void SweepWeapon(USkeletalMeshComponent* MeshComp, const FAnimNotifyEventReference& EventReference);
+
+	/**
+	 * 무기의 충돌 형태를 반환하는 함수입니다.
+	 * 장착한 무기의 메시에 Socket이 있으면 무기의 메시를, 없으면 NotifyState를 실행한 MeshComponent의 Socket을 사용합니다.
+	 * 어느 쪽에도 Socket이 없으면 무기 메시의 Bounds에서 가장 긴 축을 사용합니다.
+	 *
+	 * @param MeshComp NotifyState를 실행한 MeshComponent입니다.
+	 * @param OutStart WorldSpace에서 캡슐의 시작 위치입니다.
+	 * @param OutEnd WorldSpace에서 캡슐의 끝 위치입니다.
+	 * @return 충돌 형태를 찾았을 경우 true를 반환합니다.
+	 */
+	bool GetWeaponShape(USkeletalMeshComponent* MeshComp, FVector& OutStart, FVector& OutEnd) const;
+
+protected:
+	/** 무기 충돌 형태의 시작 Socket의 이름입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PRMeleeHitWindow")
+	FName WeaponStartSocketName;
+
+	/** 무기 충돌 형태의 끝 Socket의 이름입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PRMeleeHitWindow")
+	FName WeaponEndSocketName;
+
+	/** 무기 충돌 형태인 캡슐의 반지름입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PRMeleeHitWindow", meta = (ClampMin = "0.0"))
+	float WeaponRadius;
+
+	/** Sweep을 나누는 무기의 최대 이동 거리입니다. 무기가 한 Tick에 이 거리보다 많이 이동하면 Sweep을 나누어 실행합니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PRMeleeHitWindow|Substep", meta = (ClampMin = "1.0"))
+	float MaxSubstepDistance;
+
+	/** 한 Tick에 실행할 수 있는 최대 Sweep의 수입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PRMeleeHitWindow|Substep", meta = (ClampMin = "1"))
+	int32 MaxSubsteps;
+
+private:
+	/** Notify 인스턴스별 히트 윈도우의 상태입니다. */
+	TMap<FPRAnimNotifyInstanceKey, FPRMeleeHitWindowState> HitWindowStates;
+
+	/** HitWindowStates에서 소멸된 MeshComponent의 항목을 정리할 크기입니다. */
+	int32 HitWindowStatesPurgeThreshold;
+};
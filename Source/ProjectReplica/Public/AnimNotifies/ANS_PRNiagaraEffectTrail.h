@@ -6,6 +6,106 @@
 #include "AnimNotifies/ANS_PRTimedNiagaraEffect.h"
 #include "ANS_PRNiagaraEffectTrail.generated.h"
 
+class UNiagaraComponent;
+class USkinnedAsset;
+
+/**
+ * Trail의 Socket을 Bone Index와 Bone에 대한 상대 Transform으로 미리 찾아둔 구조체입니다.
+ * Tick마다 Socket의 이름으로 Socket과 Bone을 검색하지 않고 ComponentSpace Bone Transform에서 바로 위치를 계산합니다.
+ */
+struct FPRTrailSocketBinding
+{
+public:
+	FPRTrailSocketBinding()
+		: SocketName(NAME_None)
+		, BoneIndex(INDEX_NONE)
+		, LocalTransform(FTransform::Identity)
+	{}
+
+public:
+	/** 찾은 Socket 또는 Bone의 이름입니다. */
+	FName SocketName;
+
+	/** Socket이 부착된 Bone의 Index입니다. 찾지 못했을 경우 INDEX_NONE입니다. */
+	int32 BoneIndex;
+
+	/** Bone에 대한 Socket의 상대 Transform입니다. Bone의 이름일 경우 Identity입니다. */
+	FTransform LocalTransform;
+
+public:
+	/**
+	 * 주어진 Mesh에서 Socket 또는 Bone을 찾아 Bone Index와 상대 Transform을 기록하는 함수입니다.
+	 *
+	 * @param MeshComp Socket을 가진 Mesh입니다.
+	 * @param NewSocketName 찾을 Socket 또는 Bone의 이름입니다.
+	 */
+	void Bind(const USkeletalMeshComponent* MeshComp, FName NewSocketName);
+
+	/**
+	 * Socket의 ComponentSpace 위치를 반환하는 함수입니다.
+	 * Bone을 찾지 못했거나 Mesh가 ComponentSpace Transform을 가지지 않을 경우 이름으로 계산합니다.
+	 *
+	 * @param MeshComp Socket을 가진 Mesh입니다.
+	 * @return Socket의 ComponentSpace 위치입니다.
+	 */
+	FVector GetComponentSpaceLocation(USkeletalMeshComponent* MeshComp) const;
+};
+
+/**
+ * Trail의 Socket 위치를 Sub-frame 단위로 샘플링하기 위한 Notify 인스턴스별 상태입니다.
+ */
+struct FPRTrailSamplerState
+{
+public:
+	FPRTrailSamplerState()
+		: OlderStartLocation(FVector::ZeroVector)
+		, OlderEndLocation(FVector::ZeroVector)
+		, PreviousStartLocation(FVector::ZeroVector)
+		, PreviousEndLocation(FVector::ZeroVector)
+		, PreviousDeltaTime(0.0f)
+		, AccumulatedTime(0.0f)
+		, bHasOlderSample(false)
+		, bHasPreviousSample(false)
+		, BoundSkinnedAsset(nullptr)
+		, StartSocketBinding()
+		, EndSocketBinding()
+	{}
+
+public:
+	/** 이전 Tick보다 한 Tick 전에 샘플링한 시작 Socket의 ComponentSpace 위치입니다. */
+	FVector OlderStartLocation;
+
+	/** 이전 Tick보다 한 Tick 전에 샘플링한 끝 Socket의 ComponentSpace 위치입니다. */
+	FVector OlderEndLocation;
+
+	/** 이전 Tick에서 샘플링한 시작 Socket의 ComponentSpace 위치입니다. */
+	FVector PreviousStartLocation;
+
+	/** 이전 Tick에서 샘플링한 끝 Socket의 ComponentSpace 위치입니다. */
+	FVector PreviousEndLocation;
+
+	/** Older 샘플과 Previous 샘플 사이의 시간입니다. */
+	float PreviousDeltaTime;
+
+	/** 샘플링 간격을 채우지 못하고 남은 시간입니다. */
+	float AccumulatedTime;
+
+	/** Older 샘플이 존재하는지 나타내는 변수입니다. */
+	bool bHasOlderSample;
+
+	/** 이전 샘플이 존재하는지 나타내는 변수입니다. */
+	bool bHasPreviousSample;
+
+	/** Socket을 찾을 때 Mesh가 사용한 에셋입니다. 에셋이 바뀌면 Socket을 다시 찾습니다. 식별 용도로만 사용합니다. */
+	const USkinnedAsset* BoundSkinnedAsset;
+
+	/** 시작 Socket입니다. */
+	FPRTrailSocketBinding StartSocketBinding;
+
+	/** 끝 Socket입니다. */
+	FPRTrailSocketBinding EndSocketBinding;
+};
+
 /**
  * 캐릭터의 EffectSystem에서 가져온 NiagaraEffect Trail을 가져와 Spawn하는 AnimNotifyState 클래스입니다.
  */
@@ -18,7 +118,9 @@ public:
 	UANS_PRNiagaraEffectTrail(const FObjectInitializer& ObjectInitializer);
 
 public:
+	virtual void NotifyBegin(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, float TotalDuration, const FAnimNotifyEventReference& EventReference) override;
 	virtual void NotifyTick(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, float FrameDeltaTime, const FAnimNotifyEventReference& EventReference) override;
+	virtual void NotifyEnd(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, const FAnimNotifyEventReference& EventReference) override;
 
 protected:
 	/** Trail의 시작 Socket의 이름입니다. */
@@ -28,4 +130,75 @@ protected:
 	/** Trail의 끝 Socket의 이름입니다. */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "EffectSystem|NiagaraEffect")
 	FName EndSocket;
+
+#pragma region SubFrameSampling
+private:
+	/**
+	 * Trail에 사용할 NiagaraComponent를 반환하는 함수입니다.
+	 *
+	 * @param MeshComp NotifyState를 실행한 MeshComponent입니다.
+	 * @param EventReference 실행 중인 Notify 이벤트입니다.
+	 * @return EffectSystem의 NiagaraEffect 또는 부모 클래스가 Spawn한 NiagaraComponent입니다.
+	 */
+	UNiagaraComponent* GetTrailNiagaraComponent(USkeletalMeshComponent* MeshComp, const FAnimNotifyEventReference& EventReference);
+
+	/**
+	 * Notify 인스턴스의 Socket을 찾아 샘플링 상태에 기록하는 함수입니다. Mesh의 에셋이 바뀌었을 때만 다시 찾습니다.
+	 *
+	 * @param MeshComp NotifyState를 실행한 MeshComponent입니다.
+	 * @param SamplerState Socket을 기록할 샘플링 상태입니다.
+	 */
+	void BindTrailSockets(const USkeletalMeshComponent* MeshComp, FPRTrailSamplerState& SamplerState) const;
+
+	/**
+	 * 이전 Tick과 현재 Tick 사이의 Socket 위치를 보간하여 샘플링하고 NiagaraComponent에 한 번에 업로드하는 함수입니다.
+	 * 최근 세 샘플로 접선을 구하는 Catmull-Rom(Hermite) 곡선으로 보간하므로 빠르게 휘두르는 호를 직선으로 자르지 않습니다.
+	 *
+	 * @param MeshComp NotifyState를 실행한 MeshComponent입니다.
+	 * @param EventReference 실행 중인 Notify 이벤트입니다.
+	 * @param TrailComponent Socket 위치를 업로드할 NiagaraComponent입니다.
+	 * @param FrameDeltaTime 이전 Tick과 현재 Tick 사이의 시간입니다.
+	 */
+	void UpdateTrailSamples(USkeletalMeshComponent* MeshComp, const FAnimNotifyEventReference& EventReference, UNiagaraComponent* TrailComponent, float FrameDeltaTime);
+
+protected:
+	/** Socket 위치를 Sub-frame 단위로 보간하여 Array 파라미터로 업로드할지 나타내는 변수입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "EffectSystem|NiagaraEffect|SubFrameSampling")
+	bool bUseSubFrameSampling;
+
+	/** 초당 샘플링 횟수입니다. 프레임레이트가 낮을수록 한 Tick에 더 많은 샘플을 생성합니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "EffectSystem|NiagaraEffect|SubFrameSampling", meta = (EditCondition = "bUseSubFrameSampling", ClampMin = "1.0"))
+	float SubFrameSampleRate;
+
+	/** 한 Tick에 생성할 수 있는 최대 샘플의 수입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "EffectSystem|NiagaraEffect|SubFrameSampling", meta = (EditCondition = "bUseSubFrameSampling", ClampMin = "1"))
+	int32 MaxSamplesPerTick;
+
+	/** 시작 Socket의 샘플 위치를 업로드할 NiagaraSystem의 Vector Array 파라미터 이름입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "EffectSystem|NiagaraEffect|SubFrameSampling", meta = (EditCondition = "bUseSubFrameSampling"))
+	FName StartSocketSamplesParameterName;
+
+	/** 끝 Socket의 샘플 위치를 업로드할 NiagaraSystem의 Vector Array 파라미터 이름입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "EffectSystem|NiagaraEffect|SubFrameSampling", meta = (EditCondition = "bUseSubFrameSampling"))
+	FName EndSocketSamplesParameterName;
+
+private:
+	/** 시작 Socket의 위치를 업로드할 NiagaraSystem의 Vector 파라미터 이름입니다. */
+	FName StartSocketParameterName;
+
+	/** 끝 Socket의 위치를 업로드할 NiagaraSystem의 Vector 파라미터 이름입니다. */
+	FName EndSocketParameterName;
+
+	/** Notify 인스턴스별 샘플링 상태입니다. */
+	TMap<FPRAnimNotifyInstanceKey, FPRTrailSamplerState> TrailSamplerStates;
+
+	/** TrailSamplerStates에서 소멸된 MeshComponent의 항목을 정리할 크기입니다. */
+	int32 TrailSamplerStatesPurgeThreshold;
+
+	/** 시작 Socket의 샘플을 담는 재사용 버퍼입니다. */
+	TArray<FVector> StartSocketSamples;
+
+	/** 끝 Socket의 샘플을 담는 재사용 버퍼입니다. */
+	TArray<FVector> EndSocketSamples;
+#pragma endregion 
 };
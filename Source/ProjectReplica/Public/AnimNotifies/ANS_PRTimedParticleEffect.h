@@ -4,10 +4,15 @@
 
 #include "ProjectReplica.h"
 #include "Animation/AnimNotifies/AnimNotifyState_TimedParticleEffect.h"
+#include "AnimNotifies/PRAnimNotifyInstanceKey.h"
+#include "Effects/PREffect.h"
 #include "ANS_PRTimedParticleEffect.generated.h"
 
+class APRParticleEffect;
+
 /**
  * 캐릭터의 EffectSystem에서 ParticleEffect를 가져와 Spawn하는 AnimNotifyState 클래스입니다.
+ * AnimNotifyState 에셋은 해당 몽타주를 재생하는 모든 캐릭터가 공유하므로 Spawn한 ParticleEffect는 Notify 인스턴스별로 저장합니다.
  */
 UCLASS()
 class PROJECTREPLICA_API UANS_PRTimedParticleEffect : public UAnimNotifyState_TimedParticleEffect
@@ -26,9 +31,35 @@ protected:
 	UFUNCTION(BlueprintCallable, Category = "EffectSystem|ParticleEffect")
 	APRParticleEffect* SpawnParticleEffect(USkeletalMeshComponent* MeshComp);
 
+	/**
+	 * 인자로 받은 Notify 인스턴스가 Spawn한 ParticleEffect를 반환하는 함수입니다.
+	 *
+	 * @param MeshComp Notify를 실행한 MeshComponent입니다.
+	 * @param EventReference 실행 중인 Notify 이벤트입니다.
+	 * @return Notify 인스턴스가 Spawn한 ParticleEffect입니다. EffectSystem에서 Spawn하지 못했거나 이미 Pool로 반환되었을 경우 nullptr를 반환합니다.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "EffectSystem|ParticleEffect")
+	APRParticleEffect* FindSpawnedParticleEffect(USkeletalMeshComponent* MeshComp, const FAnimNotifyEventReference& EventReference) const;
+
 protected:
-	/** Spawn한 ParticleEffect입니다. */
-	UPROPERTY(BlueprintReadWrite, Category ="EffectSystem|ParticleEffect")
+	/**
+	 * 마지막으로 Spawn한 ParticleEffect입니다. 이전 버전의 블루프린트와 호환하기 위해 유지합니다.
+	 * 여러 캐릭터가 같은 Notify를 동시에 실행하면 덮어쓰므로 FindSpawnedParticleEffect를 사용합니다.
+	 */
+	UPROPERTY(Transient, BlueprintReadWrite, Category = "EffectSystem|ParticleEffect", meta = (DeprecatedProperty, DeprecationMessage = "ParticleEffect is overwritten when several characters play this notify at once. Use FindSpawnedParticleEffect instead."))
 	TObjectPtr<APRParticleEffect> ParticleEffect;
-	
+
+	/**
+	 * 카메라에 보이지 않는 Spawn 요청을 EffectSystem에서 컬링할지 나타내는 변수입니다.
+	 * 컬링된 이펙트는 다시 Spawn하지 않으므로 게임플레이에 필요한 이펙트에서는 사용하지 않습니다.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "EffectSystem|SpawnCulling")
+	bool bAllowSpawnCulling;
+
+private:
+	/** Notify 인스턴스별로 Spawn한 ParticleEffect입니다. */
+	TMap<FPRAnimNotifyInstanceKey, TPRSpawnedEffectHandle<APRParticleEffect>> SpawnedParticleEffects;
+
+	/** SpawnedParticleEffects에서 소멸된 MeshComponent의 항목을 정리할 크기입니다. */
+	int32 SpawnedParticleEffectsPurgeThreshold;
 };
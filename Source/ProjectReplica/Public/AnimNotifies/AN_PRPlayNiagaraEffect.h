@@ -4,17 +4,64 @@
 
 #include "ProjectReplica.h"
 #include "AnimNotify_PlayNiagaraEffect.h"
+#include "Components/PREffectSystemComponent.h"
 #include "AN_PRPlayNiagaraEffect.generated.h"
 
 /**
  * 캐릭터의 EffectSystem에서 NiagaraEffect를 가져와 Spawn하는 AnimNotify 클래스입니다.
+ * 반복 재생되는 NiagaraEffect는 EffectSystem이 있을 경우에만 Pool에서 가져와 Spawn하고,
+ * MeshComponent별로 Handle을 보관하여 UAN_PRStopNiagaraEffect에서 이 Notify가 Spawn한 NiagaraEffect만 정지할 수 있습니다.
  */
 UCLASS()
 class PROJECTREPLICA_API UAN_PRPlayNiagaraEffect : public UAnimNotify_PlayNiagaraEffect
 {
 	GENERATED_BODY()
 
+public:
+	UAN_PRPlayNiagaraEffect();
+	
 public:
 	/** NiagaraSystemComponent를 Spawn하는 함수입니다. Notify에서 호출됩니다. */
 	virtual UFXSystemComponent* SpawnEffect(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation) override;
+
+	/**
+	 * 이 Notify가 주어진 MeshComponent에서 Spawn한 반복 재생 중인 NiagaraEffect를 정지하는 함수입니다.
+	 *
+	 * @param MeshComp NiagaraEffect를 Spawn한 MeshComponent입니다.
+	 * @return NiagaraEffect를 정지했을 경우 true를 반환합니다.
+	 */
+	bool StopLoopingEffect(USkeletalMeshComponent* MeshComp);
+
+	/** 반복 재생되는 NiagaraEffect의 이름을 반환하는 함수입니다. */
+	FORCEINLINE FName GetLoopingEffectName() const { return LoopingEffectName; }
+
+protected:
+	/**
+	 * 반복 재생되는 NiagaraEffect를 재생할 시간입니다.
+	 * 0보다 작을 경우 EffectSystem의 Pool 수명을, 0일 경우 EffectSystem에서 정지하거나 캐릭터가 사망할 때까지 재생합니다.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "EffectSystem|LoopingNiagaraEffect")
+	float LoopingEffectLifespan;
+
+	/** EffectSystem의 StopLoopingNiagaraEffectsByName 함수로 반복 재생되는 NiagaraEffect를 정지할 때 사용하는 이름입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "EffectSystem|LoopingNiagaraEffect")
+	FName LoopingEffectName;
+
+	/** 같은 MeshComponent에서 다시 실행될 때 이전에 Spawn한 반복 재생 중인 NiagaraEffect를 정지할지 나타내는 변수입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "EffectSystem|LoopingNiagaraEffect")
+	bool bStopPreviousLoopingEffect;
+
+	/**
+	 * 카메라에 보이지 않는 Spawn 요청을 EffectSystem에서 컬링할지 나타내는 변수입니다.
+	 * 컬링된 이펙트는 다시 Spawn하지 않으므로 게임플레이에 필요한 이펙트에서는 사용하지 않습니다.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "EffectSystem|SpawnCulling")
+	bool bAllowSpawnCulling;
+
+private:
+	/** MeshComponent별로 Spawn한 반복 재생되는 NiagaraEffect의 Handle입니다. Notify 에셋은 여러 캐릭터가 공유하므로 MeshComponent로 구분합니다. */
+	TMap<TWeakObjectPtr<USkeletalMeshComponent>, FPRLoopingEffectHandle> LoopingEffectHandles;
+
+	/** LoopingEffectHandles에서 소멸된 MeshComponent의 항목을 정리할 Map의 크기입니다. */
+	int32 LoopingEffectHandlesPurgeThreshold;
 };
@@ -14,7 +14,18 @@ class PROJECTREPLICA_API UAN_PRPlayParticleEffect : public UAnimNotify_PlayParti
 {
 	GENERATED_BODY()
 
+public:
+	UAN_PRPlayParticleEffect();
+
 public:
 	/** ParticleSystemComponent를 Spawn하는 함수입니다. Notify에서 호출됩니다. */
 	virtual UParticleSystemComponent* SpawnParticleSystem(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation) override;
+
+protected:
+	/**
+	 * 카메라에 보이지 않는 Spawn 요청을 EffectSystem에서 컬링할지 나타내는 변수입니다.
+	 * 컬링된 이펙트는 다시 Spawn하지 않으므로 게임플레이에 필요한 이펙트에서는 사용하지 않습니다.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "EffectSystem|SpawnCulling")
+	bool bAllowSpawnCulling;
 };
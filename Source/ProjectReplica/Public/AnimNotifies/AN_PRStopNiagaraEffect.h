@@ -0,0 +1,32 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "ProjectReplica.h"
+#include "Animation/AnimNotifies/AnimNotify.h"
+#include "AN_PRStopNiagaraEffect.generated.h"
+
+/**
+ * 같은 애니메이션의 UAN_PRPlayNiagaraEffect가 Spawn한 반복 재생 중인 NiagaraEffect를 정지하는 AnimNotify 클래스입니다.
+ * UAN_PRPlayNiagaraEffect가 보관한 Handle로 정지하므로 다른 애니메이션이나 캐릭터가 Spawn한 같은 이름의 NiagaraEffect는 정지하지 않습니다.
+ */
+UCLASS()
+class PROJECTREPLICA_API UAN_PRStopNiagaraEffect : public UAnimNotify
+{
+	GENERATED_BODY()
+
+public:
+	UAN_PRStopNiagaraEffect(const FObjectInitializer& ObjectInitializer);
+
+public:
+	virtual void Notify(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, const FAnimNotifyEventReference& EventReference) override;
+	virtual FString GetNotifyName_Implementation() const override;
+
+protected:
+	/**
+	 * 정지할 NiagaraEffect의 이름입니다. UAN_PRPlayNiagaraEffect의 LoopingEffectName과 같은 NiagaraEffect를 정지합니다.
+	 * None일 경우 애니메이션의 모든 UAN_PRPlayNiagaraEffect가 Spawn한 NiagaraEffect를 정지합니다.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "EffectSystem|LoopingNiagaraEffect")
+	FName LoopingEffectName;
+};
@@ -0,0 +1,99 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "ProjectReplica.h"
+#include "Animation/AnimNotifyQueue.h"
+#include "Animation/AnimTypes.h"
+#include "Components/SkeletalMeshComponent.h"
+
+/**
+ * 여러 캐릭터가 공유하는 AnimNotify 에셋에서 실행 중인 Notify 인스턴스를 식별하는 Key 구조체입니다.
+ * Notify를 실행한 MeshComponent와 Notify 이벤트의 조합으로 인스턴스를 구분합니다.
+ */
+struct FPRAnimNotifyInstanceKey
+{
+public:
+	FPRAnimNotifyInstanceKey()
+		: MeshComp(nullptr)
+		, NotifyEvent(nullptr)
+	{}
+
+	FPRAnimNotifyInstanceKey(USkeletalMeshComponent* NewMeshComp, const FAnimNotifyEventReference& NewEventReference)
+		: MeshComp(NewMeshComp)
+		, NotifyEvent(NewEventReference.GetNotify())
+	{}
+
+public:
+	/** Notify를 실행한 MeshComponent입니다. */
+	TWeakObjectPtr<USkeletalMeshComponent> MeshComp;
+
+	/** 실행 중인 Notify 이벤트입니다. 식별 용도로만 사용하며 역참조하지 않습니다. */
+	const FAnimNotifyEvent* NotifyEvent;
+
+public:
+	/**
+	 * Key가 가리키는 MeshComponent가 유효한지 판별하는 함수입니다.
+	 *
+	 * @return MeshComponent가 유효할 경우 true를 반환합니다.
+	 */
+	FORCEINLINE bool IsValid() const
+	{
+		return MeshComp.IsValid();
+	}
+
+	/**
+	 * 인자로 받은 Key와 같은지 판별하는 == 연산자 오버로딩입니다.
+	 * 
+	 * @param NewKey 비교하는 Key입니다.
+	 * @return 인자로 받은 Key와 같을 경우 true를 다를 경우 false를 반환합니다.
+	 */
+	FORCEINLINE bool operator==(const FPRAnimNotifyInstanceKey& NewKey) const
+	{
+		return this->MeshComp == NewKey.MeshComp
+				&& this->NotifyEvent == NewKey.NotifyEvent;
+	}
+
+	/**
+	 * 인자로 받은 Key와 다른지 판별하는 != 연산자 오버로딩입니다.
+	 * 
+	 * @param NewKey 비교하는 Key입니다.
+	 * @return 인자로 받은 Key와 다를 경우 true를 같을 경우 false를 반환합니다.
+	 */
+	FORCEINLINE bool operator!=(const FPRAnimNotifyInstanceKey& NewKey) const
+	{
+		return !(*this == NewKey);
+	}
+
+	friend FORCEINLINE uint32 GetTypeHash(const FPRAnimNotifyInstanceKey& Key)
+	{
+		return HashCombine(GetTypeHash(Key.MeshComp), PointerHash(Key.NotifyEvent));
+	}
+};
+
+/**
+ * 인자로 받은 Notify 인스턴스 Map에서 MeshComponent가 소멸된 항목을 제거하는 함수입니다.
+ * Map의 크기가 이전에 정리한 크기의 두 배를 넘을 때만 정리하여 NotifyBegin마다 전체를 순회하지 않도록 합니다.
+ * Key는 FPRAnimNotifyInstanceKey 또는 MeshComponent의 TWeakObjectPtr처럼 IsValid 함수를 가져야 합니다.
+ *
+ * @param InstanceMap 정리할 Notify 인스턴스 Map입니다.
+ * @param PurgeThreshold 다음 정리를 실행할 Map의 크기입니다. 정리 후 갱신됩니다.
+ */
+template <typename KeyType, typename ValueType>
+void PurgeStaleAnimNotifyInstances(TMap<KeyType, ValueType>& InstanceMap, int32& PurgeThreshold)
+{
+	if(InstanceMap.Num() < PurgeThreshold)
+	{
+		return;
+	}
+
+	for(auto Iterator = InstanceMap.CreateIterator(); Iterator; ++Iterator)
+	{
+		if(!Iterator.Key().IsValid())
+		{
+			Iterator.RemoveCurrent();
+		}
+	}
+
+	PurgeThreshold = FMath::Max(InstanceMap.Num() * 2, 16);
+}
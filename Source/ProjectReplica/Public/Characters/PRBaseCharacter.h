@@ -4,6 +4,7 @@
 
 #include "ProjectReplica.h"
 #include "Common/PRCommonStruct.h"
+#include "Common/PRCombatRandomStream.h"
 #include "GameFramework/Character.h"
 #include "Interfaces/PRDamageableInterface.h"
 #include "PRBaseCharacter.generated.h"
@@ -25,6 +26,7 @@ class UPREffectSystemComponent;
 class UPRMovementSystemComponent;
 class UPRWeaponSystemComponent;
 class UMotionWarpingComponent;
+struct FPRDamageableQueryResult;
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnAttackEnd);
 
@@ -91,6 +93,30 @@ public:
 	/** 캐릭터가 대미지를 주는 함수입니다. */
 	UFUNCTION(BlueprintCallable, Category = "DamagaSystem")
 	virtual void DoDamage();	
+
+	/**
+	 * 근접 공격에 맞은 대상들에게 대미지를 주는 함수입니다.
+	 * 치명타 판정과 대미지 공식 계산을 대상 전체에 대해 한 번에 실행한 후 대미지 큐에 추가합니다.
+	 *
+	 * @param HitResults 근접 공격에 맞은 대상입니다.
+	 */
+	void ApplyMeleeDamage(TConstArrayView<FPRDamageableQueryResult> HitResults);
+
+	/**
+	 * 대미지 큐에서 이 캐릭터가 준 대미지에 대상이 반응했을 때 호출하는 함수입니다.
+	 *
+	 * @param ImpactLocation 대미지를 준 위치입니다.
+	 */
+	virtual void OnDamageApplied(const FVector& ImpactLocation);
+
+	/**
+	 * 치명타 판정에 사용하는 난수 스트림의 시드를 설정하는 함수입니다.
+	 * 같은 시드와 같은 입력으로 전투를 실행하면 같은 판정 결과를 얻습니다.
+	 *
+	 * @param NewSeed 설정할 시드입니다. 0일 경우 캐릭터의 이름으로 시드를 만듭니다.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "DamagaSystem")
+	void SetCombatRandomSeed(int32 NewSeed);
 	
 private:
 	/** 대미지를 관리하는 ActorComponent 클래스입니다. */
@@ -110,12 +136,36 @@ private:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "임시", meta = (AllowPrivateAccess = "true"))
 	EPRElementType DamageElementType;
 
+	/** 치명타 판정에 사용하는 난수 스트림의 시드입니다. 0일 경우 캐릭터의 이름으로 시드를 만듭니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "DamageSystem", meta = (AllowPrivateAccess = "true"))
+	int32 CombatRandomSeed;
+
+	/** 치명타 판정에 사용하는 캐릭터별 난수 스트림입니다. */
+	FPRCombatRandomStream CombatRandomStream;
+
+	/** 공격의 대미지 계수입니다. 대미지 공식의 BaseDamage 변수로 사용합니다. */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "임시", meta = (AllowPrivateAccess = "true"))
 	float DamageAmount;
+
+	/**
+	 * 근접 공격의 대미지를 공격 몽타주의 히트 윈도우(ANS_PRMeleeHitWindow)에서 줄지 나타내는 변수입니다.
+	 * true일 경우 공격할 때 DoDamage를 호출하지 않습니다.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "DamageSystem", meta = (AllowPrivateAccess = "true"))
+	bool bUseMeleeHitWindow;
 	
 public:
 	/** DamageSystem을 반환하는 함수입니다. */
 	FORCEINLINE class UPRDamageSystemComponent* GetDamageSystem() const { return DamageSystem; }
+
+	/** 치명타 판정에 사용하는 난수 스트림을 반환하는 함수입니다. */
+	FORCEINLINE FPRCombatRandomStream& GetCombatRandomStream() { return CombatRandomStream; }
+
+	/** 근접 공격의 대미지를 히트 윈도우에서 주는지 반환하는 함수입니다. */
+	FORCEINLINE bool IsUsingMeleeHitWindow() const { return bUseMeleeHitWindow; }
+
+	/** DamageSystem의 디버그의 실행 여부를 반환하는 함수입니다. */
+	FORCEINLINE bool IsDamageSystemDebug() const { return bDamageSystemDebug; }
 #pragma endregion
 
 #pragma region StatSystem
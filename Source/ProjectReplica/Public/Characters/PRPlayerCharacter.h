@@ -270,11 +270,45 @@ public:
 	void ResetVaultState();
 
 protected:
-	/** Trace의 충돌한 지점을 기준으로 뛰어넘을 수 있는 오브젝트의 치수를 계산하는 함수입니다. */
+	/**
+	 * 뛰어넘을 오브젝트를 탐색한 Trace의 결과를 받는 함수입니다.
+	 *
+	 * @param HitResults 높이별로 요청한 Trace의 결과입니다.
+	 */
+	void OnVaultableObjectTraceCompleted(TConstArrayView<FHitResult> HitResults);
+	
+	/** Trace의 충돌한 지점을 기준으로 뛰어넘을 수 있는 오브젝트의 치수를 계산하는 Trace를 요청하는 함수입니다. */
 	void CalculateVaultableObjectDepth(FVector TraceImpactPoint);
 
-	/** Trace의 마지막 위치를 기준으로 캐릭터가 착지할 위치를 계산하는 함수입니다. */
-	void CalculateVaultLandLocation(FVector TraceEndLocation);
+	/**
+	 * 뛰어넘을 수 있는 오브젝트의 치수를 계산한 Trace의 결과를 받는 함수입니다.
+	 * 장애물을 넘어선 위치를 찾으면 그 위치에서만 착지 Trace를 요청하고, 찾지 못하면 바로 MotionWarp를 실행합니다.
+	 *
+	 * @param HitResults 거리별로 요청한 치수 Trace의 결과입니다.
+	 */
+	void OnVaultableObjectDepthTraceCompleted(TConstArrayView<FHitResult> HitResults);
+
+	/**
+	 * 장애물을 넘어선 치수 Trace의 위치에서 착지할 위치를 계산하는 Trace를 요청하는 함수입니다.
+	 * 치수 Trace의 결과를 알기 전에 모든 위치의 착지 Trace를 함께 요청하지 않으므로 Trace의 수는 줄지만 한 프레임 늦게 MotionWarp를 실행합니다.
+	 *
+	 * @param DepthTraceStart 장애물을 넘어선 치수 Trace의 시작 위치입니다.
+	 */
+	void RequestVaultLandTrace(const FVector& DepthTraceStart);
+
+	/**
+	 * 착지 Trace의 결과를 받아 착지할 위치를 계산하고 MotionWarp를 실행하는 함수입니다.
+	 *
+	 * @param HitResults 착지 Trace의 결과입니다.
+	 */
+	void OnVaultLandTraceCompleted(TConstArrayView<FHitResult> HitResults);
+
+	/**
+	 * 착지 Trace의 결과로 캐릭터가 착지할 위치를 계산하는 함수입니다.
+	 *
+	 * @param LandHitResult 장애물을 넘어선 치수 Trace의 위치에서 요청한 착지 Trace의 결과입니다.
+	 */
+	void CalculateVaultLandLocation(const FHitResult& LandHitResult);
 
 	/** 장애물을 뛰어넘는 AnimMontage의 MotionWarp를 실행하는 함수입니다. */
 	void ExecuteVaultMotionWarp();
@@ -298,6 +332,10 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Vaulting|Debug")
 	bool bVaultDebug;
 	
+	/** 뛰어넘을 오브젝트를 탐색하는 비동기 Trace의 결과를 기다리는지 나타내는 변수입니다. */
+	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category = "Vaulting")
+	bool bVaultTracePending;
+	
 	/** 장애물을 뛰어넘을 때 MotionWarp를 실행할 수 있는지 나타내는 변수입니다. */
 	UPROPERTY(VisibleInstanceOnly, BlueprintReadWrite, Category = "Vaulting")
 	bool bCanVaultWarp;
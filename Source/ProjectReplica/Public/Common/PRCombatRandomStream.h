@@ -0,0 +1,97 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "ProjectReplica.h"
+
+/**
+ * 전투 판정에 사용하는 시드 기반 난수 스트림입니다.
+ * 시드와 호출 횟수(Counter)를 정수 해시로 섞어서 난수를 만드는 카운터 기반 방식이므로
+ * 같은 시드와 같은 입력으로 실행하면 플랫폼과 관계없이 같은 결과를 반환합니다.
+ * 각 난수가 이전 난수에 의존하지 않으므로 여러 판정을 한 번에 생성하는 반복문을 컴파일러가 SIMD로 벡터화할 수 있습니다.
+ */
+struct PROJECTREPLICA_API FPRCombatRandomStream
+{
+public:
+	FPRCombatRandomStream()
+		: Seed(0)
+		, Counter(0)
+	{}
+
+	explicit FPRCombatRandomStream(uint32 NewSeed)
+		: Seed(NewSeed)
+		, Counter(0)
+	{}
+
+	/**
+	 * 시드를 설정하고 호출 횟수를 초기화하는 함수입니다.
+	 *
+	 * @param NewSeed 설정할 시드입니다.
+	 */
+	void Initialize(uint32 NewSeed);
+
+	/** 0.0f 이상 1.0f 미만의 난수를 반환하는 함수입니다. */
+	float FRand();
+
+	/**
+	 * 치명타 여부를 판정하는 함수입니다.
+	 *
+	 * @param CriticalRate 치명타 확률(%)입니다.
+	 * @return 치명타일 경우 true를 반환합니다.
+	 */
+	bool RollCritical(float CriticalRate);
+
+	/**
+	 * 여러 공격의 치명타 여부를 한 번에 판정하는 함수입니다.
+	 * RollCritical을 OutCriticals의 크기만큼 호출한 것과 같은 결과를 반환합니다.
+	 *
+	 * @param CriticalRate 치명타 확률(%)입니다.
+	 * @param OutCriticals 치명타 여부를 기록할 배열입니다. 치명타일 경우 1, 아닐 경우 0을 기록합니다.
+	 */
+	void RollCriticals(float CriticalRate, TArrayView<uint8> OutCriticals);
+
+	/**
+	 * 공격마다 다른 치명타 확률로 여러 공격의 치명타 여부를 한 번에 판정하는 함수입니다.
+	 *
+	 * @param CriticalRates 공격별 치명타 확률(%)입니다.
+	 * @param OutCriticals 치명타 여부를 기록할 배열입니다. CriticalRates와 크기가 같아야 합니다.
+	 */
+	void RollCriticals(TConstArrayView<float> CriticalRates, TArrayView<uint8> OutCriticals);
+
+	/** 시드를 반환하는 함수입니다. */
+	FORCEINLINE uint32 GetSeed() const { return Seed; }
+
+	/** 지금까지 생성한 난수의 수를 반환하는 함수입니다. 재현할 때 같은 위치에서 시작하기 위해 사용합니다. */
+	FORCEINLINE uint32 GetCounter() const { return Counter; }
+
+	/** 생성할 난수의 위치를 설정하는 함수입니다. */
+	FORCEINLINE void SetCounter(uint32 NewCounter) { Counter = NewCounter; }
+
+	/**
+	 * 시드와 위치에 해당하는 0.0f 이상 1.0f 미만의 난수를 반환하는 함수입니다.
+	 *
+	 * @param Seed 난수의 시드입니다.
+	 * @param Index 난수의 위치입니다.
+	 * @return 0.0f 이상 1.0f 미만의 난수입니다.
+	 */
+	static FORCEINLINE float Hash(uint32 Seed, uint32 Index)
+	{
+		// 32비트 정수 연산만 사용하여 벡터화할 수 있는 해시 함수입니다.
+		uint32 Value = Seed ^ (Index * 0x9E3779B9u);
+		Value ^= Value >> 16;
+		Value *= 0x7FEB352Du;
+		Value ^= Value >> 15;
+		Value *= 0x846CA68Bu;
+		Value ^= Value >> 16;
+
+		// 상위 24비트를 사용하므로 float으로 정확하게 변환됩니다.
+		return static_cast<float>(Value >> 8) * (1.0f / 16777216.0f);
+	}
+
+private:
+	/** 난수의 시드입니다. */
+	uint32 Seed;
+
+	/** 지금까지 생성한 난수의 수입니다. */
+	uint32 Counter;
+};
@@ -0,0 +1,223 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "ProjectReplica.h"
+#include "HAL/Runnable.h"
+#include <atomic>
+
+class FArchive;
+class FRunnableThread;
+class FEvent;
+
+/** 전투 텔레메트리 기록의 플래그를 나타내는 열거형입니다. */
+enum class EPRCombatTelemetryFlags : uint8
+{
+	None		= 0,
+	Critical	= 1 << 0,		// 치명타
+	Applied		= 1 << 1		// 대상이 대미지에 반응함
+};
+ENUM_CLASS_FLAGS(EPRCombatTelemetryFlags);
+
+/**
+ * 처리한 대미지 이벤트 하나의 전투 텔레메트리 기록입니다.
+ * 액터는 문자열 대신 FName으로 보관하므로 기록할 때 메모리를 할당하지 않습니다.
+ */
+struct FPRCombatTelemetryRecord
+{
+public:
+	FPRCombatTelemetryRecord()
+		: Timestamp(0.0)
+		, Attacker(NAME_None)
+		, Target(NAME_None)
+		, Amount(0.0f)
+		, ElementType(EPRElementType::ElementType_None)
+		, DamageResponse(EPRDamageResponse::DamageResponse_None)
+		, Flags(EPRCombatTelemetryFlags::None)
+	{}
+
+public:
+	/** 기록을 시작한 후 대미지 이벤트를 처리한 시간(초)입니다. */
+	double Timestamp;
+
+	/** 대미지를 준 액터의 이름입니다. */
+	FName Attacker;
+
+	/** 대미지를 받은 액터의 이름입니다. */
+	FName Target;
+
+	/** 대미지의 양입니다. */
+	float Amount;
+
+	/** 대미지의 속성입니다. */
+	EPRElementType ElementType;
+
+	/** 대미지에 대한 반응입니다. */
+	EPRDamageResponse DamageResponse;
+
+	/** 기록의 플래그입니다. */
+	EPRCombatTelemetryFlags Flags;
+};
+
+/**
+ * 전투 텔레메트리 기록을 보관하는 단일 생산자, 단일 소비자 Lock-free 링 버퍼입니다.
+ * 게임 스레드가 기록을 추가하고 텔레메트리 Writer 스레드가 기록을 꺼냅니다.
+ * 버퍼는 생성할 때 한 번만 할당하며, 가득 찬 경우 기다리지 않고 기록을 버린 후 버린 수를 셉니다.
+ */
+class PROJECTREPLICA_API FPRCombatTelemetryRingBuffer
+{
+public:
+	/**
+	 * @param NewCapacity 보관할 수 있는 기록의 수입니다. 2의 거듭제곱으로 올림합니다.
+	 */
+	explicit FPRCombatTelemetryRingBuffer(uint32 NewCapacity);
+
+	/**
+	 * 기록을 추가하는 함수입니다. 생산자 스레드에서만 호출합니다.
+	 *
+	 * @param Record 추가할 기록입니다.
+	 * @return 버퍼가 가득 차서 기록을 버렸을 경우 false를 반환합니다.
+	 */
+	bool Push(const FPRCombatTelemetryRecord& Record);
+
+	/**
+	 * 보관한 기록을 꺼내는 함수입니다. 소비자 스레드에서만 호출합니다.
+	 *
+	 * @param OutRecords 꺼낸 기록을 복사할 배열입니다.
+	 * @return 꺼낸 기록의 수입니다.
+	 */
+	int32 Pop(TArrayView<FPRCombatTelemetryRecord> OutRecords);
+
+	/** 보관할 수 있는 기록의 수를 반환하는 함수입니다. */
+	FORCEINLINE uint32 GetCapacity() const { return static_cast<uint32>(Records.Num()); }
+
+	/** 추가한 기록의 수를 반환하는 함수입니다. */
+	FORCEINLINE uint64 GetPushedCount() const { return Head.load(std::memory_order_relaxed); }
+
+	/** 버퍼가 가득 차서 버린 기록의 수를 반환하는 함수입니다. */
+	FORCEINLINE uint64 GetDroppedCount() const { return DroppedCount.load(std::memory_order_relaxed); }
+
+private:
+	/** 기록을 보관하는 배열입니다. */
+	TArray<FPRCombatTelemetryRecord> Records;
+
+	/** Index를 배열의 크기로 나눈 나머지를 구하는 Mask입니다. */
+	uint32 IndexMask;
+
+	/** 다음에 추가할 기록의 위치입니다. 생산자만 변경합니다. */
+	alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<uint64> Head;
+
+	/** 다음에 꺼낼 기록의 위치입니다. 소비자만 변경합니다. */
+	alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<uint64> Tail;
+
+	/** 버린 기록의 수입니다. */
+	alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<uint64> DroppedCount;
+};
+
+/**
+ * 전투 텔레메트리 파일의 형식입니다.
+ * 파일은 Header 뒤에 Chunk가 이어지며, 액터의 이름은 처음 나올 때 한 번만 Name Chunk로 기록하고 Record Chunk에서는 이름의 ID를 사용합니다.
+ */
+struct PROJECTREPLICA_API FPRCombatTelemetryFile
+{
+public:
+	/** 파일의 시작을 나타내는 값입니다. 'PRCT' */
+	static constexpr uint32 Magic = 0x54435250;
+
+	/** 파일 형식의 버전입니다. */
+	static constexpr uint32 Version = 1;
+
+	/** Chunk의 유형입니다. */
+	enum class EChunkType : uint8
+	{
+		Name	= 1,		// uint32 NameID, FString Name
+		Records	= 2			// int32 Count, Count * (double Timestamp, uint32 AttackerID, uint32 TargetID, float Amount, uint8 ElementType, uint8 DamageResponse, uint8 Flags)
+	};
+
+	/**
+	 * 전투 텔레메트리 파일을 CSV 파일로 변환하는 함수입니다.
+	 *
+	 * @param TelemetryFilePath 변환할 전투 텔레메트리 파일의 경로입니다.
+	 * @param CSVFilePath 저장할 CSV 파일의 경로입니다.
+	 * @return 변환에 성공했을 경우 true를 반환합니다.
+	 */
+	static bool ConvertToCSV(const FString& TelemetryFilePath, const FString& CSVFilePath);
+};
+
+/**
+ * 링 버퍼의 전투 텔레메트리 기록을 백그라운드 스레드에서 주기적으로 꺼내서 파일에 기록하는 클래스입니다.
+ */
+class PROJECTREPLICA_API FPRCombatTelemetryWriter : public FRunnable
+{
+public:
+	/**
+	 * @param NewRingBuffer 기록을 꺼낼 링 버퍼입니다. Writer보다 오래 유지되어야 합니다.
+	 * @param NewFilePath 기록을 저장할 파일의 경로입니다.
+	 * @param NewFlushInterval 링 버퍼를 비우는 간격(초)입니다.
+	 */
+	FPRCombatTelemetryWriter(FPRCombatTelemetryRingBuffer& NewRingBuffer, const FString& NewFilePath, float NewFlushInterval);
+	virtual ~FPRCombatTelemetryWriter() override;
+
+	/**
+	 * 파일을 열고 Writer 스레드를 시작하는 함수입니다.
+	 *
+	 * @return 파일을 열지 못했을 경우 false를 반환합니다.
+	 */
+	bool Start();
+
+	/** 남은 기록을 모두 파일에 기록하고 Writer 스레드를 종료하는 함수입니다. */
+	void Shutdown();
+
+	/** 기록을 저장하는 파일의 경로를 반환하는 함수입니다. */
+	FORCEINLINE const FString& GetFilePath() const { return FilePath; }
+
+	/** 파일에 기록한 기록의 수를 반환하는 함수입니다. */
+	FORCEINLINE uint64 GetWrittenCount() const { return WrittenCount.load(std::memory_order_relaxed); }
+
+public:
+	virtual uint32 Run() override;
+	virtual void Stop() override;
+
+private:
+	/** 링 버퍼의 모든 기록을 파일에 기록하는 함수입니다. */
+	void Drain();
+
+	/**
+	 * 이름의 ID를 반환하는 함수입니다. 처음 나온 이름은 Name Chunk를 기록합니다.
+	 *
+	 * @param Name ID를 찾을 이름입니다.
+	 * @return 이름의 ID입니다.
+	 */
+	uint32 GetOrWriteNameID(FName Name);
+
+private:
+	/** 기록을 꺼낼 링 버퍼입니다. */
+	FPRCombatTelemetryRingBuffer& RingBuffer;
+
+	/** 기록을 저장할 파일의 경로입니다. */
+	FString FilePath;
+
+	/** 링 버퍼를 비우는 간격(초)입니다. */
+	float FlushInterval;
+
+	/** 기록을 저장할 파일입니다. */
+	TUniquePtr<FArchive> FileWriter;
+
+	/** Writer 스레드입니다. */
+	FRunnableThread* Thread;
+
+	/** Writer 스레드를 깨우는 이벤트입니다. */
+	FEvent* WakeEvent;
+
+	/** Writer 스레드의 종료를 요청했는지 나타내는 변수입니다. */
+	std::atomic<bool> bStopRequested;
+
+	/** 파일에 기록한 기록의 수입니다. */
+	std::atomic<uint64> WrittenCount;
+
+	/** 링 버퍼에서 꺼낸 기록을 담는 배열입니다. Writer 스레드에서만 사용합니다. */
+	TArray<FPRCombatTelemetryRecord> DrainedRecords;
+
+	/** 파일에 기록한 이름의 ID입니다. Writer 스레드에서만 사용합니다. */
+	TMap<FName, uint32> NameIDs;
+};
@@ -0,0 +1,200 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "ProjectReplica.h"
+#include "PRDamageFormula.generated.h"
+
+/**
+ * 대미지 공식의 설정 값을 나타내는 구조체입니다.
+ * Expression은 사칙연산, 괄호, 숫자, min(a, b), max(a, b)와 FPRDamageFormula::GetVariableName의 변수 이름으로 작성합니다.
+ * ex) (AttackPoint * (1 + WeaponAttackPercent * 0.01) + WeaponAttack) * BaseDamage * 0.01 * CriticalMultiplier
+ */
+USTRUCT(Atomic, BlueprintType)
+struct FPRDamageFormulaSettings : public FTableRowBase
+{
+	GENERATED_BODY()
+
+public:
+	FPRDamageFormulaSettings()
+		: DamageType(EPRDamageType::DamageType_None)
+		, Expression()
+	{}
+
+	FPRDamageFormulaSettings(EPRDamageType NewDamageType, const FString& NewExpression)
+		: DamageType(NewDamageType)
+		, Expression(NewExpression)
+	{}
+
+public:
+	/** 공식을 사용할 대미지 유형입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "DamageFormula")
+	EPRDamageType DamageType;
+
+	/** 대미지 공식입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "DamageFormula", meta = (MultiLine = "true"))
+	FString Expression;
+};
+
+/**
+ * 대미지 공식에서 사용하는 변수를 나타내는 열거형입니다.
+ */
+enum class EPRDamageFormulaVariable : uint8
+{
+	AttackPoint,				// 공격자의 공격력
+	DefencePoint,				// 공격자의 방어력
+	MaxHealth,					// 공격자의 최대 체력
+	CriticalDamage,				// 공격자의 치명타 피해(%)
+	WeaponAttack,				// 무기의 기초 공격력과 공격력 부 옵션의 합
+	WeaponAttackPercent,		// 무기의 공격력 % 부 옵션
+	WeaponCriticalDamage,		// 무기의 치명타 피해 부 옵션
+	ElementBonus,				// 대미지 속성에 해당하는 무기의 속성 피해 보너스 부 옵션
+	TargetDefencePoint,			// 대상의 방어력
+	TargetMaxHealth,			// 대상의 최대 체력
+	TargetHealth,				// 대상의 현재 체력
+	Critical,					// 치명타일 경우 1, 아닐 경우 0
+	CriticalMultiplier,			// 치명타일 경우 (CriticalDamage + WeaponCriticalDamage) * 0.01, 아닐 경우 1
+	BaseDamage,					// 공격의 대미지 계수
+	Count
+};
+
+/**
+ * 대미지 공식을 계산할 때 사용하는 변수의 값을 보관한 구조체입니다.
+ */
+struct PROJECTREPLICA_API FPRDamageFormulaInputs
+{
+public:
+	FPRDamageFormulaInputs()
+	{
+		FMemory::Memzero(Values);
+	}
+
+	/**
+	 * 공격자와 대상의 능력치로 변수의 값을 설정하는 함수입니다.
+	 * 무기의 부 옵션은 SubStatType에 해당하는 변수에 더합니다.
+	 *
+	 * @param AttackerStat 공격자의 능력치입니다.
+	 * @param WeaponStat 공격자가 장착한 무기의 능력치입니다.
+	 * @param TargetStat 대상의 능력치입니다.
+	 * @param ElementType 대미지의 속성입니다.
+	 * @param bIsCritical 치명타 여부입니다.
+	 * @param BaseDamage 공격의 대미지 계수입니다.
+	 * @return 변수의 값을 설정한 구조체입니다.
+	 */
+	static FPRDamageFormulaInputs Make(const FPRCharacterStat& AttackerStat, const FPRWeaponStat& WeaponStat, const FPRCharacterStat& TargetStat,
+										EPRElementType ElementType, bool bIsCritical, float BaseDamage);
+
+	/** 변수의 값을 반환하는 함수입니다. */
+	FORCEINLINE float Get(EPRDamageFormulaVariable Variable) const { return Values[static_cast<uint8>(Variable)]; }
+
+	/** 변수의 값을 설정하는 함수입니다. */
+	FORCEINLINE void Set(EPRDamageFormulaVariable Variable, float Value) { Values[static_cast<uint8>(Variable)] = Value; }
+
+public:
+	/** 변수의 값입니다. EPRDamageFormulaVariable을 Index로 사용합니다. */
+	float Values[static_cast<uint8>(EPRDamageFormulaVariable::Count)];
+};
+
+/**
+ * 문자열로 작성한 대미지 공식을 불러올 때 한 번만 명령어 배열로 컴파일하여 계산하는 클래스입니다.
+ * 변수 이름은 컴파일할 때 Index로 변환하고 상수끼리의 연산은 미리 계산하므로
+ * 대미지를 계산할 때는 문자열 처리나 리플렉션 없이 명령어 배열만 실행합니다.
+ */
+class PROJECTREPLICA_API FPRDamageFormula
+{
+public:
+	FPRDamageFormula();
+
+	/**
+	 * 대미지 공식을 컴파일하는 함수입니다. 실패할 경우 이전에 컴파일한 공식을 유지합니다.
+	 *
+	 * @param NewExpression 컴파일할 대미지 공식입니다.
+	 * @param OutError 실패할 경우 실패한 이유를 설정합니다.
+	 * @return 컴파일에 성공하면 true를 반환합니다.
+	 */
+	bool Compile(const FString& NewExpression, FString& OutError);
+
+	/**
+	 * 대미지 공식을 계산하는 함수입니다.
+	 *
+	 * @param Inputs 변수의 값입니다.
+	 * @return 계산한 대미지입니다. 음수일 경우 0을 반환합니다.
+	 */
+	float Evaluate(const FPRDamageFormulaInputs& Inputs) const;
+
+	/**
+	 * 여러 공격자와 대상의 대미지 공식을 한 번에 계산하는 함수입니다.
+	 * 명령어마다 모든 입력을 계산하므로 명령어를 한 번씩만 해석합니다.
+	 *
+	 * @param Inputs 변수의 값의 배열입니다.
+	 * @param OutDamages 계산한 대미지를 기록할 배열입니다. Inputs와 크기가 같아야 합니다.
+	 */
+	void EvaluateBatch(TConstArrayView<FPRDamageFormulaInputs> Inputs, TArrayView<float> OutDamages) const;
+
+	/** 컴파일에 성공한 공식인지 확인하는 함수입니다. */
+	FORCEINLINE bool IsCompiled() const { return Instructions.Num() > 0; }
+
+	/** 컴파일한 대미지 공식의 문자열을 반환하는 함수입니다. */
+	FORCEINLINE const FString& GetExpression() const { return Expression; }
+
+	/** 데이터 테이블에 공식이 없을 때 사용하는 기본 대미지 공식을 반환하는 함수입니다. */
+	static const TCHAR* GetDefaultExpression();
+
+	/** 대미지 공식에서 사용하는 변수의 이름을 반환하는 함수입니다. */
+	static const TCHAR* GetVariableName(EPRDamageFormulaVariable Variable);
+
+public:
+	/** 명령어의 종류를 나타내는 열거형입니다. */
+	enum class EOpCode : uint8
+	{
+		PushConstant,
+		PushVariable,
+		Negate,
+		Add,
+		Subtract,
+		Multiply,
+		Divide,
+		Min,
+		Max
+	};
+
+	/** 스택 기반으로 실행하는 명령어를 나타내는 구조체입니다. */
+	struct FInstruction
+	{
+	public:
+		FInstruction()
+			: OpCode(EOpCode::PushConstant)
+			, Variable(0)
+			, Constant(0.0f)
+		{}
+
+		FInstruction(EOpCode NewOpCode, uint8 NewVariable = 0, float NewConstant = 0.0f)
+			: OpCode(NewOpCode)
+			, Variable(NewVariable)
+			, Constant(NewConstant)
+		{}
+
+	public:
+		/** 명령어의 종류입니다. */
+		EOpCode OpCode;
+
+		/** PushVariable에서 사용하는 변수의 Index입니다. */
+		uint8 Variable;
+
+		/** PushConstant에서 사용하는 상수입니다. */
+		float Constant;
+	};
+
+	/** 계산 중에 사용할 수 있는 스택의 최대 깊이입니다. */
+	static constexpr int32 MaxStackDepth = 16;
+
+private:
+	/** 컴파일한 명령어 배열입니다. */
+	TArray<FInstruction> Instructions;
+
+	/** 명령어 배열을 실행할 때 필요한 스택의 깊이입니다. */
+	int32 StackDepth;
+
+	/** 컴파일한 대미지 공식의 문자열입니다. */
+	FString Expression;
+};
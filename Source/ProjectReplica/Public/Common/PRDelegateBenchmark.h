@@ -0,0 +1,75 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "ProjectReplica.h"
+#include "Components/PRDamageSystemComponent.h"
+#include "PRDelegateBenchmark.generated.h"
+
+/**
+ * 델리게이트 호출 비용을 비교한 결과를 나타내는 구조체입니다.
+ */
+USTRUCT(Atomic, BlueprintType)
+struct FPRDelegateBenchmarkResult
+{
+	GENERATED_BODY()
+
+public:
+	FPRDelegateBenchmarkResult()
+		: Broadcasts(0)
+		, Listeners(0)
+		, NativeTimePerBroadcast(0.0)
+		, DynamicTimePerBroadcast(0.0)
+	{}
+
+public:
+	/** 델리게이트를 호출한 횟수입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRDelegateBenchmarkResult")
+	int32 Broadcasts;
+
+	/** 델리게이트에 바인딩한 함수의 수입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRDelegateBenchmarkResult")
+	int32 Listeners;
+
+	/** 네이티브 델리게이트를 한 번 호출하는 평균 시간(나노초)입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRDelegateBenchmarkResult")
+	double NativeTimePerBroadcast;
+
+	/** 다이나믹 델리게이트를 한 번 호출하는 평균 시간(나노초)입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRDelegateBenchmarkResult")
+	double DynamicTimePerBroadcast;
+};
+
+/**
+ * 대미지 시스템이 사용하는 네이티브 델리게이트와 다이나믹 델리게이트의 호출 비용을 비교하는 클래스입니다.
+ * 같은 수의 리스너를 두 델리게이트에 바인딩하고 같은 횟수만큼 호출하여 호출 한 번의 평균 시간을 측정합니다.
+ * 콘솔 명령어 PR.Benchmark.DelegateBroadcast [Broadcasts] [Listeners]로 실행할 수 있습니다.
+ */
+UCLASS()
+class PROJECTREPLICA_API UPRDelegateBenchmark : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	UPRDelegateBenchmark();
+
+public:
+	/**
+	 * 델리게이트의 호출 비용을 측정하는 함수입니다.
+	 *
+	 * @param Broadcasts 델리게이트를 호출할 횟수입니다.
+	 * @param Listeners 델리게이트에 바인딩할 함수의 수입니다.
+	 * @return 측정한 결과입니다.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "PRDelegateBenchmark")
+	static FPRDelegateBenchmarkResult RunBroadcastBenchmark(int32 Broadcasts = 100000, int32 Listeners = 1);
+
+private:
+	/** 델리게이트가 호출되면 실행하는 함수입니다. 다이나믹 델리게이트에 바인딩하기 위해 UFUNCTION으로 선언합니다. */
+	UFUNCTION()
+	void OnBlocked(bool bCanBeParried);
+
+private:
+	/** 호출된 횟수입니다. 컴파일러가 호출을 제거하지 않도록 기록합니다. */
+	int32 ReceivedCount;
+};
@@ -0,0 +1,131 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "ProjectReplica.h"
+#include "UObject/ObjectKey.h"
+
+class USceneComponent;
+class USkeletalMeshComponent;
+
+/**
+ * Socket Transform 캐시의 사용 통계를 나타내는 구조체입니다.
+ */
+struct FPRSocketTransformCacheStats
+{
+public:
+	FPRSocketTransformCacheStats()
+		: Requests(0)
+		, CacheHits(0)
+		, Computations(0)
+		, PoseInvalidations(0)
+	{}
+
+public:
+	/** Socket Transform을 요청한 횟수입니다. */
+	int64 Requests;
+
+	/** 같은 포즈에서 이미 계산한 Socket Transform을 재사용하여 계산을 생략한 횟수입니다. */
+	int64 CacheHits;
+
+	/** Socket Transform을 새로 계산한 횟수입니다. */
+	int64 Computations;
+
+	/** 포즈가 갱신되어 캐시를 비운 횟수입니다. */
+	int64 PoseInvalidations;
+};
+
+/**
+ * SkeletalMeshComponent별로 같은 프레임에 계산한 Socket Transform을 보관하는 캐시 클래스입니다.
+ * ComponentSpace의 Socket Transform을 보관하고 WorldSpace는 현재 Component의 Transform으로 변환하므로
+ * 같은 프레임에 캐릭터가 이동해도 올바른 값을 반환합니다.
+ * 포즈가 갱신되거나 프레임이 바뀌면 해당 Mesh의 캐시를 비웁니다.
+ */
+class PROJECTREPLICA_API FPRSocketTransformCache
+{
+public:
+	/**
+	 * Socket의 Transform을 반환하는 함수입니다.
+	 * SkeletalMeshComponent가 아니거나 지원하지 않는 TransformSpace일 경우 캐시를 사용하지 않고 계산합니다.
+	 *
+	 * @param Component Socket을 가진 Component입니다.
+	 * @param SocketName Socket 또는 Bone의 이름입니다.
+	 * @param TransformSpace 반환할 Transform의 공간입니다.
+	 * @return Socket의 Transform입니다.
+	 */
+	static FTransform GetSocketTransform(USceneComponent* Component, FName SocketName, ERelativeTransformSpace TransformSpace = RTS_World);
+
+	/**
+	 * Socket의 WorldSpace 위치를 반환하는 함수입니다.
+	 *
+	 * @param Component Socket을 가진 Component입니다.
+	 * @param SocketName Socket 또는 Bone의 이름입니다.
+	 * @return Socket의 WorldSpace 위치입니다.
+	 */
+	static FVector GetSocketLocation(USceneComponent* Component, FName SocketName);
+
+	/**
+	 * 주어진 Mesh의 캐시를 비우는 함수입니다. 게임 코드에서 Bone Transform을 직접 수정했을 때 사용합니다.
+	 *
+	 * @param MeshComp 캐시를 비울 Mesh입니다.
+	 */
+	static void Invalidate(const USkeletalMeshComponent* MeshComp);
+
+	/** 캐시의 사용 통계를 반환하는 함수입니다. */
+	static const FPRSocketTransformCacheStats& GetStats();
+
+	/** 캐시의 사용 통계를 초기화하는 함수입니다. */
+	static void ResetStats();
+
+private:
+	/**
+	 * Mesh 하나의 Socket Transform 캐시를 나타내는 구조체입니다.
+	 */
+	struct FPRMeshSocketTransforms
+	{
+	public:
+		FPRMeshSocketTransforms()
+			: MeshComp(nullptr)
+			, FrameCounter(0)
+			, bPoseDirty(true)
+			, ComponentSpaceTransforms()
+			, BoneTransformsFinalizedHandle()
+		{}
+
+	public:
+		/** 캐시를 사용하는 Mesh입니다. */
+		TWeakObjectPtr<USkeletalMeshComponent> MeshComp;
+
+		/** 캐시를 채운 프레임입니다. */
+		uint64 FrameCounter;
+
+		/** 캐시를 채운 후 포즈가 갱신되었는지 나타내는 변수입니다. */
+		bool bPoseDirty;
+
+		/** Socket 이름별 ComponentSpace Transform입니다. */
+		TMap<FName, FTransform> ComponentSpaceTransforms;
+
+		/** 포즈 갱신 델리게이트의 핸들입니다. */
+		FDelegateHandle BoneTransformsFinalizedHandle;
+	};
+
+	/**
+	 * 주어진 Mesh의 캐시를 찾거나 생성하고, 포즈가 갱신되었거나 프레임이 바뀌었으면 비우는 함수입니다.
+	 *
+	 * @param MeshComp 캐시를 찾을 Mesh입니다.
+	 * @return Mesh의 캐시입니다.
+	 */
+	static FPRMeshSocketTransforms& GetValidMeshSocketTransforms(USkeletalMeshComponent* MeshComp);
+
+	/** 소멸된 Mesh의 캐시를 제거하는 함수입니다. */
+	static void PurgeStaleMeshes();
+
+	/** Mesh별 Socket Transform 캐시입니다. */
+	static TMap<FObjectKey, FPRMeshSocketTransforms> MeshSocketTransforms;
+
+	/** 캐시의 사용 통계입니다. */
+	static FPRSocketTransformCacheStats Stats;
+
+	/** 다음 정리를 실행할 캐시의 크기입니다. */
+	static int32 PurgeThreshold;
+};
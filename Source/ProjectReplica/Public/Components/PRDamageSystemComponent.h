@@ -9,11 +9,18 @@
 class UPRStatSystemComponent;
 class UPRStateSystemComponent;
 class APRDamageAmount;
+class AProjectReplicaGameMode;
+struct FPRDamageEventQueue;
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnDeathDelegate);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnBlockedDelegate, bool, CanBeParried);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnDamageResponseDelegate, EPRDamageResponse, DamageResponse);
 
+// C++에서 바인딩하는 네이티브 델리게이트입니다. 리플렉션(ProcessEvent)을 거치지 않고 바인딩한 함수를 직접 호출합니다.
+DECLARE_MULTICAST_DELEGATE(FOnDeathNativeDelegate);
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnBlockedNativeDelegate, bool);
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnDamageResponseNativeDelegate, EPRDamageResponse);
+
 /**
  * 대미지의 처리를 나타내는 열거형입니다.
  */
@@ -64,7 +71,31 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "DamageSystem")
 	bool TakeDamage(FPRDamageInfo DamageInfo);
 
+	/**
+	 * 대미지 큐에서 이 캐릭터가 받을 대미지 이벤트를 한 번에 처리하는 함수입니다.
+	 * 능력치와 상태를 한 번만 읽고, 체력은 마지막에 한 번만 설정합니다.
+	 * 델리게이트는 대미지 이벤트마다 실행하지 않고 마지막으로 방어하거나 반응한 대미지 이벤트에 대해서 한 번만 실행합니다.
+	 *
+	 * @param DamageQueue 대미지 이벤트를 보관한 대미지 큐입니다.
+	 * @param EventIndices 처리할 대미지 이벤트의 Index입니다.
+	 * @param PRGameMode 대미지를 표시할 GameMode입니다.
+	 * @param OutAppliedEvents 캐릭터가 반응한 대미지 이벤트를 true로 설정하는 배열입니다. 반응은 한 번만 실행하므로 마지막으로 반응한 대미지 이벤트만 설정합니다.
+	 */
+	void TakeQueuedDamage(const FPRDamageEventQueue& DamageQueue, TConstArrayView<int32> EventIndices, AProjectReplicaGameMode* PRGameMode, TBitArray<>& OutAppliedEvents);
+
+	/** 대미지에 대한 반응을 받는 네이티브 델리게이트나 블루프린트 델리게이트가 있는지 반환하는 함수입니다. */
+	FORCEINLINE bool HasDamageResponseListener() const { return OnDamageResponseNativeDelegate.IsBound() || OnDamageResponseDelegate.IsBound(); }
+
 private:
+	/** 사망을 네이티브 델리게이트와 블루프린트 델리게이트에 알리는 함수입니다. */
+	void BroadcastDeath();
+
+	/** 방어를 네이티브 델리게이트와 블루프린트 델리게이트에 알리는 함수입니다. */
+	void BroadcastBlocked(bool bCanBeParried);
+
+	/** 대미지에 대한 반응을 네이티브 델리게이트와 블루프린트 델리게이트에 알리는 함수입니다. */
+	void BroadcastDamageResponse(EPRDamageResponse DamageResponse);
+
 	/**
 	 * 받는 대미지의 정보에 따라 방어하여 대미지를 받지 않을지, 대미지를 받을지, 대미지를 받지 않을지 판별하는 함수입니다.
 	 *
@@ -90,15 +121,24 @@ private:
 	TSubclassOf<class APRDamageAmount> DamageAmount;
 	
 public:
-	/** 사망했을 때 호출하는 델리게이트입니다. */
+	/** 사망했을 때 호출하는 네이티브 델리게이트입니다. C++에서는 이 델리게이트에 바인딩합니다. */
+	FOnDeathNativeDelegate OnDeathNativeDelegate;
+
+	/** 방어했을 때 호출하는 네이티브 델리게이트입니다. C++에서는 이 델리게이트에 바인딩합니다. */
+	FOnBlockedNativeDelegate OnBlockedNativeDelegate;
+
+	/** 대미지에 반응할 때 호출하는 네이티브 델리게이트입니다. C++에서는 이 델리게이트에 바인딩합니다. */
+	FOnDamageResponseNativeDelegate OnDamageResponseNativeDelegate;
+
+	/** 사망했을 때 호출하는 블루프린트 델리게이트입니다. 바인딩한 함수가 있을 때만 호출합니다. */
 	UPROPERTY(BlueprintAssignable, BlueprintCallable, Category = "DamageSystem")
 	FOnDeathDelegate OnDeathDelegate;
 
-	/** 방어했을 때 호출하는 델리게이트입니다. */
+	/** 방어했을 때 호출하는 블루프린트 델리게이트입니다. 바인딩한 함수가 있을 때만 호출합니다. */
 	UPROPERTY(BlueprintAssignable, BlueprintCallable, Category = "DamageSystem")
 	FOnBlockedDelegate OnBlockedDelegate;
 
-	/** 대미지에 반응할 때 호출하는 델리게이트입니다. */
+	/** 대미지에 반응할 때 호출하는 블루프린트 델리게이트입니다. 바인딩한 함수가 있을 때만 호출합니다. */
 	UPROPERTY(BlueprintAssignable, BlueprintCallable, Category = "DamageSystem")
 	FOnDamageResponseDelegate OnDamageResponseDelegate;
 };
@@ -8,9 +8,20 @@
 #include "Particles/ParticleSystem.h"
 #include "Effects/PRNiagaraEffect.h"
 #include "Effects/PRParticleEffect.h"
+#include "UObject/ObjectKey.h"
 #include "PREffectSystemComponent.generated.h"
 
 
+/** 이펙트의 Spawn 요청이 컬링된 이유를 나타내는 열거형입니다. */
+UENUM(BlueprintType)
+enum class EPREffectCullReason : uint8
+{
+	EffectCullReason_None				UMETA(DisplayName = "None"),
+	EffectCullReason_Distance			UMETA(DisplayName = "Distance"),		// 카메라와의 거리가 너무 멉니다.
+	EffectCullReason_Frustum			UMETA(DisplayName = "Frustum"),			// 카메라의 시야 밖에 있습니다.
+	EffectCullReason_NotRendered		UMETA(DisplayName = "NotRendered")		// Owner가 최근에 렌더링되지 않았습니다.
+};
+
 #pragma region Structs
 /**
  * NiagaraEffect를 보관하는 Pool을 나타내는 구조체입니다.
@@ -57,6 +68,66 @@ public:
 	TMap<TObjectPtr<UNiagaraSystem>, FPRNiagaraEffectPool> Pool;
 };
 
+/**
+ * 카메라와의 거리에 따라 대신 사용할 NiagaraSystem을 나타내는 구조체입니다.
+ */
+USTRUCT(Atomic, BlueprintType)
+struct FPRNiagaraEffectLODVariant
+{
+	GENERATED_BODY()
+
+public:
+	FPRNiagaraEffectLODVariant()
+		: NiagaraSystem(nullptr)
+		, MinDistance(0.0f)
+		, PoolSize(0)
+	{}
+
+	FPRNiagaraEffectLODVariant(TObjectPtr<UNiagaraSystem> NewNiagaraSystem, float NewMinDistance, int32 NewPoolSize)
+		: NiagaraSystem(NewNiagaraSystem)
+		, MinDistance(NewMinDistance)
+		, PoolSize(NewPoolSize)
+	{}
+
+public:
+	/** 원본 NiagaraSystem 대신 사용할 NiagaraSystem입니다. Emitter나 Light를 줄인 가벼운 NiagaraSystem을 사용합니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PRNiagaraEffectLODVariant")
+	TObjectPtr<UNiagaraSystem> NiagaraSystem;
+
+	/** 카메라와의 거리가 이 값 이상일 때 해당 NiagaraSystem을 사용합니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PRNiagaraEffectLODVariant", meta = (ClampMin = "0.0"))
+	float MinDistance;
+
+	/** 해당 NiagaraSystem의 Pool의 크기입니다. 0 이하일 경우 원본 NiagaraSystem의 PoolSize를 사용합니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PRNiagaraEffectLODVariant")
+	int32 PoolSize;
+
+public:
+	/**
+	 * 주어진 NiagaraEffectLODVariant와 같은지 확인하는 ==연산자 오버로딩입니다.
+	 * 
+	 * @param TargetNiagaraEffectLODVariant 비교할 NiagaraEffectLODVariant입니다.
+	 * @return 주어진 NiagaraEffectLODVariant와 같을 경우 true를 반환합니다. 그렇지 않을 경우 false를 반환합니다.
+	 */
+	FORCEINLINE bool operator==(const FPRNiagaraEffectLODVariant& TargetNiagaraEffectLODVariant) const
+	{
+		return this->NiagaraSystem == TargetNiagaraEffectLODVariant.NiagaraSystem
+				&& this->MinDistance == TargetNiagaraEffectLODVariant.MinDistance
+				&& this->PoolSize == TargetNiagaraEffectLODVariant.PoolSize;
+	}
+
+	/**
+	 * 주어진 NiagaraEffectLODVariant와 같지 않은지 확인하는 !=연산자 오버로딩입니다.
+	 * 
+	 * @param TargetNiagaraEffectLODVariant 비교할 NiagaraEffectLODVariant입니다.
+	 * @return 주어진 NiagaraEffectLODVariant와 같지 않을 경우 true를 반환합니다. 그렇지 않을 경우 false를 반환합니다.
+	 */
+	FORCEINLINE bool operator!=(const FPRNiagaraEffectLODVariant& TargetNiagaraEffectLODVariant) const
+	{
+		return !(*this == TargetNiagaraEffectLODVariant);
+	}
+};
+
 /**
  * NiagaraEffectPool의 설정 값을 나타내는 구조체입니다.
  */
@@ -70,12 +141,14 @@ public:
 		: NiagaraSystem(nullptr)
 		, PoolSize(0)
 		, EffectLifespan(0.0f)
+		, LODVariants()
 	{}
 
 	FPRNiagaraEffectPoolSettings(TObjectPtr<UNiagaraSystem> NewNiagaraSystem, int32 NewPoolSize, float NewEffectLifespan)
 		: NiagaraSystem(NewNiagaraSystem)
 		, PoolSize(NewPoolSize)
 		, EffectLifespan(NewEffectLifespan)
+		, LODVariants()
 	{}
 
 public:
@@ -91,7 +164,36 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PRNiagaraEffectPoolSettings")
 	float EffectLifespan;
 
+	/**
+	 * 카메라와의 거리에 따라 대신 사용할 NiagaraSystem 목록입니다.
+	 * 각 NiagaraSystem은 별도의 Pool을 가집니다.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PRNiagaraEffectPoolSettings")
+	TArray<FPRNiagaraEffectLODVariant> LODVariants;
+
 public:
+	/**
+	 * 주어진 거리에 해당하는 NiagaraSystem을 반환하는 함수입니다.
+	 *
+	 * @param Distance 카메라와의 거리입니다.
+	 * @return MinDistance가 Distance 이하인 LODVariant 중 MinDistance가 가장 큰 NiagaraSystem입니다. 없을 경우 원본 NiagaraSystem을 반환합니다.
+	 */
+	UNiagaraSystem* GetNiagaraSystemForDistance(float Distance) const
+	{
+		UNiagaraSystem* SelectedNiagaraSystem = NiagaraSystem;
+		float SelectedMinDistance = 0.0f;
+		for(const FPRNiagaraEffectLODVariant& LODVariant : LODVariants)
+		{
+			if(LODVariant.NiagaraSystem && LODVariant.MinDistance <= Distance && LODVariant.MinDistance >= SelectedMinDistance)
+			{
+				SelectedNiagaraSystem = LODVariant.NiagaraSystem;
+				SelectedMinDistance = LODVariant.MinDistance;
+			}
+		}
+
+		return SelectedNiagaraSystem;
+	}
+	
 	/**
 	 * 주어진 NiagaraEffectPoolSettings와 같은지 확인하는 ==연산자 오버로딩입니다.
 	 * 
@@ -102,7 +204,8 @@ public:
 	{
 		return this->NiagaraSystem == TargetNiagaraEffectPoolSettings.NiagaraSystem
 				&& this->PoolSize == TargetNiagaraEffectPoolSettings.PoolSize
-				&& this->EffectLifespan == TargetNiagaraEffectPoolSettings.EffectLifespan;
+				&& this->EffectLifespan == TargetNiagaraEffectPoolSettings.EffectLifespan
+				&& this->LODVariants == TargetNiagaraEffectPoolSettings.LODVariants;
 	}
 
 	/**
@@ -115,7 +218,8 @@ public:
 	{
 		return this->NiagaraSystem != TargetNiagaraEffectPoolSettings.NiagaraSystem
 				|| this->PoolSize != TargetNiagaraEffectPoolSettings.PoolSize
-				|| this->EffectLifespan != TargetNiagaraEffectPoolSettings.EffectLifespan;
+				|| this->EffectLifespan != TargetNiagaraEffectPoolSettings.EffectLifespan
+				|| this->LODVariants != TargetNiagaraEffectPoolSettings.LODVariants;
 	}
 };
 
@@ -463,6 +567,280 @@ public:
 		return nullptr;
 	}
 };
+
+/**
+ * 이펙트 Pool의 사용 통계를 나타내는 구조체입니다.
+ */
+USTRUCT(Atomic, BlueprintType)
+struct FPREffectPoolStats
+{
+	GENERATED_BODY()
+
+public:
+	FPREffectPoolStats()
+		: SpawnRequests(0)
+		, PoolHits(0)
+		, PoolMisses(0)
+		, DynamicCreations(0)
+		, DynamicDestructions(0)
+		, CulledByDistance(0)
+		, CulledByFrustum(0)
+		, CulledByNotRendered(0)
+		, PrimedEffects(0)
+		, WarmUpTime(0.0f)
+		, Activations(0)
+		, TotalActivationTime(0.0f)
+	{}
+
+public:
+	/** 이펙트 Spawn 요청 횟수입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PREffectPoolStats")
+	int32 SpawnRequests;
+
+	/** Pool에 비활성화된 이펙트가 있어서 재사용한 횟수입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PREffectPoolStats")
+	int32 PoolHits;
+
+	/** Pool의 모든 이펙트가 활성화되어 있어서 동적으로 생성해야 했던 횟수입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PREffectPoolStats")
+	int32 PoolMisses;
+
+	/** 동적으로 생성한 이펙트의 수입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PREffectPoolStats")
+	int32 DynamicCreations;
+
+	/** 동적으로 생성한 후 제거한 이펙트의 수입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PREffectPoolStats")
+	int32 DynamicDestructions;
+
+	/** 카메라와의 거리가 멀어서 Spawn하지 않은 횟수입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PREffectPoolStats")
+	int32 CulledByDistance;
+
+	/** 카메라의 시야 밖에 있어서 Spawn하지 않은 횟수입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PREffectPoolStats")
+	int32 CulledByFrustum;
+
+	/** Owner가 최근에 렌더링되지 않아서 Spawn하지 않은 횟수입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PREffectPoolStats")
+	int32 CulledByNotRendered;
+
+	/** Pool을 생성할 때 미리 활성화하여 준비한 이펙트의 수입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PREffectPoolStats")
+	int32 PrimedEffects;
+
+	/** Pool을 생성할 때 이펙트를 준비하는 데 걸린 시간(초)입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PREffectPoolStats")
+	float WarmUpTime;
+
+	/** Pool에서 가져온 이펙트를 활성화한 횟수입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PREffectPoolStats")
+	int32 Activations;
+
+	/** 이펙트를 활성화하는 데 걸린 시간(초)의 합입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PREffectPoolStats")
+	float TotalActivationTime;
+
+public:
+	/**
+	 * Pool에서 이펙트를 재사용한 비율을 반환하는 함수입니다.
+	 *
+	 * @return 0.0 ~ 1.0 사이의 비율입니다. Pool을 사용하지 않았을 경우 1.0을 반환합니다.
+	 */
+	FORCEINLINE float GetPoolHitRate() const
+	{
+		const int32 PoolRequests = PoolHits + PoolMisses;
+		return PoolRequests > 0 ? static_cast<float>(PoolHits) / static_cast<float>(PoolRequests) : 1.0f;
+	}
+
+	/**
+	 * 이펙트를 활성화하는 데 걸린 평균 시간(초)을 반환하는 함수입니다.
+	 * 첫 번째 활성화의 비용은 에셋마다 다르므로 FPREffectActivationStats에서 에셋별로 확인합니다.
+	 *
+	 * @return 이펙트를 활성화하는 데 걸린 평균 시간(초)입니다.
+	 */
+	FORCEINLINE float GetAverageActivationTime() const
+	{
+		return Activations > 0 ? TotalActivationTime / static_cast<float>(Activations) : 0.0f;
+	}
+
+	/**
+	 * 이펙트를 활성화하는 데 걸린 시간을 기록하는 함수입니다.
+	 *
+	 * @param ActivationTime 이펙트를 활성화하는 데 걸린 시간(초)입니다.
+	 */
+	FORCEINLINE void AddActivation(float ActivationTime)
+	{
+		Activations++;
+		TotalActivationTime += ActivationTime;
+	}
+
+	/**
+	 * 컬링된 이유에 해당하는 횟수를 증가시키는 함수입니다.
+	 *
+	 * @param CullReason 컬링된 이유입니다.
+	 */
+	FORCEINLINE void AddCulled(EPREffectCullReason CullReason)
+	{
+		switch(CullReason)
+		{
+		case EPREffectCullReason::EffectCullReason_Distance:
+			CulledByDistance++;
+			break;
+		case EPREffectCullReason::EffectCullReason_Frustum:
+			CulledByFrustum++;
+			break;
+		case EPREffectCullReason::EffectCullReason_NotRendered:
+			CulledByNotRendered++;
+			break;
+		default:
+			break;
+		}
+	}
+};
+
+/**
+ * 이펙트 에셋 하나의 활성화 비용을 나타내는 구조체입니다.
+ * 첫 번째 활성화와 이후 활성화의 비용을 비교하여 Pool을 생성할 때 준비한 효과를 확인합니다.
+ */
+USTRUCT(Atomic, BlueprintType)
+struct FPREffectActivationStats
+{
+	GENERATED_BODY()
+
+public:
+	FPREffectActivationStats()
+		: Activations(0)
+		, FirstActivationTime(0.0f)
+		, TotalActivationTime(0.0f)
+	{}
+
+public:
+	/** 이펙트를 활성화한 횟수입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PREffectActivationStats")
+	int32 Activations;
+
+	/** 첫 번째로 이펙트를 활성화하는 데 걸린 시간(초)입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PREffectActivationStats")
+	float FirstActivationTime;
+
+	/** 이펙트를 활성화하는 데 걸린 시간(초)의 합입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PREffectActivationStats")
+	float TotalActivationTime;
+
+public:
+	/**
+	 * 첫 번째 활성화를 제외한 활성화에 걸린 평균 시간(초)을 반환하는 함수입니다.
+	 *
+	 * @return 첫 번째 이후의 활성화에 걸린 평균 시간(초)입니다. 두 번 이상 활성화하지 않았을 경우 0을 반환합니다.
+	 */
+	FORCEINLINE float GetAverageLaterActivationTime() const
+	{
+		return Activations > 1 ? (TotalActivationTime - FirstActivationTime) / static_cast<float>(Activations - 1) : 0.0f;
+	}
+
+	/**
+	 * 이펙트를 활성화하는 데 걸린 시간을 기록하는 함수입니다.
+	 *
+	 * @param ActivationTime 이펙트를 활성화하는 데 걸린 시간(초)입니다.
+	 */
+	FORCEINLINE void AddActivation(float ActivationTime)
+	{
+		if(Activations == 0)
+		{
+			FirstActivationTime = ActivationTime;
+		}
+
+		Activations++;
+		TotalActivationTime += ActivationTime;
+	}
+};
+
+/**
+ * 반복 재생되는 NiagaraEffect를 정지할 때 사용하는 Handle을 나타내는 구조체입니다.
+ */
+USTRUCT(Atomic, BlueprintType)
+struct FPRLoopingEffectHandle
+{
+	GENERATED_BODY()
+
+public:
+	FPRLoopingEffectHandle()
+		: HandleID(INDEX_NONE)
+	{}
+
+	FPRLoopingEffectHandle(int32 NewHandleID)
+		: HandleID(NewHandleID)
+	{}
+
+public:
+	/** Handle의 ID입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRLoopingEffectHandle")
+	int32 HandleID;
+
+public:
+	/**
+	 * Handle이 유효한지 판별하는 함수입니다.
+	 *
+	 * @return Handle이 유효할 경우 true를 반환합니다.
+	 */
+	FORCEINLINE bool IsValid() const
+	{
+		return HandleID != INDEX_NONE;
+	}
+
+	/** Handle을 무효화하는 함수입니다. */
+	FORCEINLINE void Invalidate()
+	{
+		HandleID = INDEX_NONE;
+	}
+	
+	/**
+	 * 주어진 LoopingEffectHandle과 같은지 확인하는 ==연산자 오버로딩입니다.
+	 * 
+	 * @param TargetLoopingEffectHandle 비교할 LoopingEffectHandle입니다.
+	 * @return 주어진 LoopingEffectHandle과 같을 경우 true를 반환합니다. 그렇지 않을 경우 false를 반환합니다.
+	 */
+	FORCEINLINE bool operator==(const FPRLoopingEffectHandle& TargetLoopingEffectHandle) const
+	{
+		return this->HandleID == TargetLoopingEffectHandle.HandleID;
+	}
+
+	/**
+	 * 주어진 LoopingEffectHandle과 같지 않은지 확인하는 !=연산자 오버로딩입니다.
+	 * 
+	 * @param TargetLoopingEffectHandle 비교할 LoopingEffectHandle입니다.
+	 * @return 주어진 LoopingEffectHandle과 같지 않을 경우 true를 반환합니다. 그렇지 않을 경우 false를 반환합니다.
+	 */
+	FORCEINLINE bool operator!=(const FPRLoopingEffectHandle& TargetLoopingEffectHandle) const
+	{
+		return this->HandleID != TargetLoopingEffectHandle.HandleID;
+	}
+};
+
+/**
+ * 반복 재생 중인 NiagaraEffect의 정보를 나타내는 구조체입니다.
+ */
+struct FPRLoopingNiagaraEffect
+{
+public:
+	FPRLoopingNiagaraEffect()
+		: NiagaraEffect(nullptr)
+		, LoopingEffectName(NAME_None)
+	{}
+
+	FPRLoopingNiagaraEffect(APRNiagaraEffect* NewNiagaraEffect, FName NewLoopingEffectName)
+		: NiagaraEffect(NewNiagaraEffect)
+		, LoopingEffectName(NewLoopingEffectName)
+	{}
+
+public:
+	/** 반복 재생 중인 NiagaraEffect입니다. */
+	TWeakObjectPtr<APRNiagaraEffect> NiagaraEffect;
+
+	/** 이름으로 정지할 때 사용하는 반복 재생 NiagaraEffect의 이름입니다. */
+	FName LoopingEffectName;
+};
 #pragma endregion
 
 /**
@@ -476,6 +854,11 @@ class PROJECTREPLICA_API UPREffectSystemComponent : public UPRBaseObjectPoolSyst
 public:
 	UPREffectSystemComponent();
 
+protected:
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
 #pragma region PRBaseObjectPoolSystem
 public:
 	/** 기존의 ObjectPool을 제거하고, 새로 ObjectPool을 생성하여 초기화하는 함수입니다. */
@@ -483,6 +866,95 @@ public:
 
 	/** 모든 ObjectPool을 제거하는 함수입니다. */
 	virtual void ClearAllObjectPool() override;
+
+	/** NiagaraPool과 ParticlePool의 사용 통계를 초기화하는 함수입니다. */
+	UFUNCTION(BlueprintCallable, Category = "PREffectSystem")
+	void ResetPoolStats();
+
+private:
+	/** CSV 프로파일러에 NiagaraSystem과 ParticleSystem별로 활성화된 이펙트의 수를 기록하는 함수입니다. */
+	void RecordActiveEffectCsvStats() const;
+
+	/** CSV 프로파일러가 캡처를 시작할 때 호출되는 함수입니다. 캡처하는 동안에만 Tick을 활성화합니다. */
+	void OnCsvProfileStart();
+
+	/**
+	 * CSV 프로파일러에 기록할 이펙트 에셋별 통계의 이름을 만드는 함수입니다. 매 프레임 이름을 만들지 않도록 Pool을 생성할 때 호출합니다.
+	 *
+	 * @param EffectAsset 통계를 기록할 NiagaraSystem이나 ParticleSystem입니다.
+	 * @param Prefix 통계 이름의 접두사입니다.
+	 */
+	void CacheActiveEffectCsvStatName(const UObject* EffectAsset, const TCHAR* Prefix);
+
+private:
+	/** 이펙트 에셋별 CSV 프로파일러 통계의 이름입니다. */
+	TMap<TObjectKey<UObject>, FName> ActiveEffectCsvStatNames;
+
+	/** CSV 프로파일러의 캡처 시작 델리게이트 핸들입니다. */
+	FDelegateHandle CsvProfileStartHandle;
+#pragma endregion
+
+#pragma region SpawnCulling
+public:
+	/**
+	 * 주어진 위치에 이펙트를 Spawn할 경우 컬링되는지 확인하는 함수입니다.
+	 * Pool에서 이펙트를 가져오기 전에 카메라와의 거리, 카메라의 시야, Owner의 마지막 렌더링 시간을 CPU에서 간단하게 검사합니다.
+	 *
+	 * @param SpawnLocation 이펙트를 Spawn할 위치입니다.
+	 * @return 컬링된 이유입니다. 컬링되지 않을 경우 EffectCullReason_None을 반환합니다.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "PREffectSystem|SpawnCulling")
+	EPREffectCullReason GetEffectSpawnCullReason(const FVector& SpawnLocation) const;
+
+	/** 마지막 Spawn 요청이 컬링된 이유를 반환하는 함수입니다. Spawn 함수가 nullptr을 반환했을 때 컬링 여부를 확인할 때 사용합니다. */
+	UFUNCTION(BlueprintCallable, Category = "PREffectSystem|SpawnCulling")
+	FORCEINLINE EPREffectCullReason GetLastSpawnCullReason() const { return LastSpawnCullReason; }
+
+	/** 마지막 Spawn 요청이 컬링되었는지 확인하는 함수입니다. */
+	FORCEINLINE bool WasLastSpawnCulled() const { return LastSpawnCullReason != EPREffectCullReason::EffectCullReason_None; }
+
+	/**
+	 * Pool에서 이펙트를 가져오기 전에 Spawn 요청을 컬링할지 설정하는 함수입니다.
+	 *
+	 * @param bNewUseSpawnCulling 컬링할 경우 true입니다.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "PREffectSystem|SpawnCulling")
+	FORCEINLINE void SetUseSpawnCulling(bool bNewUseSpawnCulling) { bUseSpawnCulling = bNewUseSpawnCulling; }
+
+private:
+	/**
+	 * Spawn 요청을 컬링할지 판단하고 결과를 통계에 기록하는 함수입니다.
+	 *
+	 * @param SpawnLocation 이펙트를 Spawn할 위치입니다.
+	 * @param bAllowSpawnCulling Spawn 요청이 컬링을 허용했는지 나타냅니다. false일 경우 컬링하지 않습니다.
+	 * @param PoolStats 컬링된 횟수를 기록할 Pool의 통계입니다.
+	 * @return 컬링할 경우 true를 반환합니다.
+	 */
+	bool CullEffectSpawn(const FVector& SpawnLocation, bool bAllowSpawnCulling, FPREffectPoolStats& PoolStats);
+	
+private:
+	/** Pool에서 이펙트를 가져오기 전에 Spawn 요청을 컬링할지 나타내는 변수입니다. Spawn 함수에서 컬링을 허용한 요청만 컬링합니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "PREffectSystem|SpawnCulling", meta = (AllowPrivateAccess = "true"))
+	bool bUseSpawnCulling;
+
+	/** 카메라와의 거리가 이 값보다 멀 경우 Spawn하지 않습니다. 0 이하일 경우 거리로 컬링하지 않습니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "PREffectSystem|SpawnCulling", meta = (AllowPrivateAccess = "true", EditCondition = "bUseSpawnCulling"))
+	float SpawnCullDistance;
+
+	/** 카메라의 시야 밖에 있는 Spawn 요청을 컬링할지 나타내는 변수입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "PREffectSystem|SpawnCulling", meta = (AllowPrivateAccess = "true", EditCondition = "bUseSpawnCulling"))
+	bool bCullOutsideFrustum;
+
+	/** 시야 검사에 사용하는 이펙트의 경계 구의 반지름입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "PREffectSystem|SpawnCulling", meta = (AllowPrivateAccess = "true", EditCondition = "bUseSpawnCulling && bCullOutsideFrustum"))
+	float SpawnCullBoundsRadius;
+
+	/** Owner가 이 시간 동안 렌더링되지 않았을 경우 Spawn하지 않습니다. 0 이하일 경우 렌더링 시간으로 컬링하지 않습니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "PREffectSystem|SpawnCulling", meta = (AllowPrivateAccess = "true", EditCondition = "bUseSpawnCulling"))
+	float OwnerRenderTimeThreshold;
+
+	/** 마지막 Spawn 요청이 컬링된 이유입니다. */
+	EPREffectCullReason LastSpawnCullReason;
 #pragma endregion
 
 #pragma region NiagaraSystem
@@ -495,6 +967,18 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "PREffectSystem|NiagaraSystem")
 	void ClearAllNiagaraPool();
 
+	/**
+	 * NiagaraPool의 설정 값을 가진 데이터 테이블을 설정하는 함수입니다. InitializeNiagaraPool을 호출해야 Pool에 적용됩니다.
+	 *
+	 * @param NewNiagaraPoolSettingsDataTable NiagaraPool의 설정 값을 가진 데이터 테이블입니다.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "PREffectSystem|NiagaraSystem")
+	FORCEINLINE void SetNiagaraPoolSettingsDataTable(UDataTable* NewNiagaraPoolSettingsDataTable) { NiagaraPoolSettingsDataTable = NewNiagaraPoolSettingsDataTable; }
+
+	/** Owner가 월드의 공유 Pool에서 가져와 사용 중인 모든 NiagaraEffect를 공유 Pool에 반환하는 함수입니다. Owner가 사망하거나 제거될 때 호출합니다. */
+	UFUNCTION(BlueprintCallable, Category = "PREffectSystem|NiagaraSystem")
+	void ReleaseSharedNiagaraEffects();
+
 	/**
 	 * NiagaraEffect를 지정한 위치에 Spawn하는 함수입니다.
 	 *
@@ -504,10 +988,11 @@ public:
 	 * @param Scale NiagaraEffect에 적용할 크기
 	 * @param bEffectAutoActivate true일 경우 NiagaraEffect를 Spawn하자마다 NiagaraEffect를 실행합니다. false일 경우 NiagaraEffect를 실행하지 않습니다.
 	 * @param bReset 처음부터 다시 재생할지 여부
+	 * @param bAllowSpawnCulling true일 경우 카메라에 보이지 않는 Spawn 요청을 컬링합니다. 컬링되면 nullptr을 반환하고 다시 Spawn하지 않으므로 외형만을 위한 이펙트에서만 사용합니다.
 	 * @return 지정한 위치에 Spawn한 NiagaraEffect입니다.
 	 */
 	UFUNCTION(BlueprintCallable, Category = "PREffectSystem|NiagaraEffect")
-	APRNiagaraEffect* SpawnNiagaraEffectAtLocation(UNiagaraSystem* SpawnEffect, FVector Location, FRotator Rotation = FRotator::ZeroRotator, FVector Scale = FVector(1.0f), bool bEffectAutoActivate = true, bool bReset = false);
+	APRNiagaraEffect* SpawnNiagaraEffectAtLocation(UNiagaraSystem* SpawnEffect, FVector Location, FRotator Rotation = FRotator::ZeroRotator, FVector Scale = FVector(1.0f), bool bEffectAutoActivate = true, bool bReset = false, bool bAllowSpawnCulling = false);
 	
 	/**
 	 * NiagaraEffect를 지정한 Component에 부착하여 Spawn하는 함수입니다.
@@ -520,10 +1005,11 @@ public:
 	 * @param Scale NiagaraEffect에 적용할 크기
 	 * @param bEffectAutoActivate true일 경우 NiagaraEffect를 Spawn하자마다 NiagaraEffect를 실행합니다. false일 경우 NiagaraEffect를 실행하지 않습니다.
 	 * @param bReset 처음부터 다시 재생할지 여부
+	 * @param bAllowSpawnCulling true일 경우 카메라에 보이지 않는 Spawn 요청을 컬링합니다. 컬링되면 nullptr을 반환하고 다시 Spawn하지 않으므로 외형만을 위한 이펙트에서만 사용합니다.
 	 * @return 지정한 Component에 부착하여 Spawn한 NiagaraEffect입니다.
 	 */
 	UFUNCTION(BlueprintCallable, Category = "PREffectSystem|NiagaraEffect")
-	APRNiagaraEffect* SpawnNiagaraEffectAttached(UNiagaraSystem* SpawnEffect, USceneComponent* Parent, FName AttachSocketName, FVector Location, FRotator Rotation, FVector Scale = FVector(1.0f), bool bEffectAutoActivate = true, bool bReset = false);
+	APRNiagaraEffect* SpawnNiagaraEffectAttached(UNiagaraSystem* SpawnEffect, USceneComponent* Parent, FName AttachSocketName, FVector Location, FRotator Rotation, FVector Scale = FVector(1.0f), bool bEffectAutoActivate = true, bool bReset = false, bool bAllowSpawnCulling = false);
 
 	/**
 	 * 주어진 NiagaraSystem에 해당하는 활성화할 수 있는 NiagaraEffect를 반환하는 함수입니다.
@@ -650,6 +1136,15 @@ private:
 	UFUNCTION(BlueprintCallable, Category = "PRObjectPoolSystem|NiagaraSystem")
 	void ClearDynamicDestroyNiagaraList(FPRDynamicDestroyNiagaraEffectList& TargetDynamicDestroyNiagaraEffectList);
 
+	/**
+	 * 주어진 위치와 로컬 플레이어의 카메라 사이의 거리에 따라 Spawn할 NiagaraSystem을 선택하는 함수입니다.
+	 *
+	 * @param SpawnEffect 요청받은 NiagaraSystem입니다.
+	 * @param SpawnLocation NiagaraEffect를 Spawn할 위치입니다.
+	 * @return 거리에 해당하는 LODVariant의 NiagaraSystem입니다. LODVariant가 없을 경우 SpawnEffect를 반환합니다.
+	 */
+	UNiagaraSystem* SelectNiagaraSystemLOD(UNiagaraSystem* SpawnEffect, const FVector& SpawnLocation) const;
+	
 	/**
 	 * 주어진 NiagaraSystem에 해당하는 NiagaraEffect의 설정 값을 데이터 테이블에서 가져오는 함수입니다.
 	 *
@@ -664,15 +1159,31 @@ private:
 	 *
 	 * @param TargetEffect 비활성화되는 Effect입니다.
 	 */
-	UFUNCTION()
 	void OnNiagaraEffectDeactivate(APREffect* TargetEffect);
 
+	/** 월드의 공유 Pool을 반환하는 함수입니다. 공유 Pool을 사용하지 않을 경우 nullptr을 반환합니다. */
+	class UPRSharedEffectPoolSubsystem* GetSharedEffectPool() const;
+
+	/**
+	 * 월드의 공유 Pool에서 주어진 NiagaraSystem에 해당하는 NiagaraEffect를 가져오는 함수입니다.
+	 *
+	 * @param SpawnEffect 가져올 NiagaraEffect의 NiagaraSystem입니다.
+	 * @return 가져온 NiagaraEffect입니다. 공유 Pool이 가득 찼을 경우 nullptr을 반환합니다.
+	 */
+	APRNiagaraEffect* AcquireSharedNiagaraEffect(UNiagaraSystem* SpawnEffect);
+
+	/**
+	 * 공유 Pool에서 가져온 NiagaraEffect가 비활성화될 때 실행하는 함수입니다.
+	 *
+	 * @param TargetEffect 비활성화되는 Effect입니다.
+	 */
+	void OnSharedNiagaraEffectDeactivate(APREffect* TargetEffect);
+
 	/**
 	 * 주어진 동적으로 생성한 NiagaraEffect가 비활성화될 때 실행하는 함수입니다.
 	 *
 	 * @param TargetEffect 비활성화되는 Effect입니다.
 	 */
-	UFUNCTION()
 	void OnDynamicNiagaraEffectDeactivate(APREffect* TargetEffect);
 
 	/**
@@ -687,6 +1198,34 @@ private:
 	/** NiagaraObjectPool의 설정 값을 가진 데이터 테이블입니다. */
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "PREffectSystem|NiagaraSystem", meta = (AllowPrivateAccess = "true"))
 	TObjectPtr<UDataTable> NiagaraPoolSettingsDataTable;
+
+	/** 카메라와의 거리에 따라 NiagaraPoolSettings의 LODVariant를 사용할지 나타내는 변수입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "PREffectSystem|NiagaraSystem", meta = (AllowPrivateAccess = "true"))
+	bool bUseNiagaraEffectLOD;
+
+	/**
+	 * NiagaraPool을 생성할 때 NiagaraEffect를 보이지 않게 한 번 활성화하였다가 비활성화할지 나타내는 변수입니다.
+	 * 전투 중 첫 번째 활성화에서 발생하는 System Instance 초기화 비용을 Pool 생성 시점으로 옮깁니다.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "PREffectSystem|NiagaraSystem", meta = (AllowPrivateAccess = "true"))
+	bool bPrimeNiagaraPoolOnWarmUp;
+
+	/**
+	 * 캐릭터마다 NiagaraPool을 생성하지 않고 월드의 공유 Pool을 사용할지 나타내는 변수입니다.
+	 * 같은 이펙트를 사용하는 캐릭터가 많을 때 이펙트의 수가 캐릭터의 수에 비례하여 늘어나지 않습니다.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "PREffectSystem|NiagaraSystem", meta = (AllowPrivateAccess = "true"))
+	bool bUseSharedNiagaraPool;
+
+	/** 공유 Pool에서 NiagaraSystem별로 동시에 사용할 수 있는 NiagaraEffect의 수입니다. 0 이하일 경우 제한하지 않습니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "PREffectSystem|NiagaraSystem", meta = (AllowPrivateAccess = "true", EditCondition = "bUseSharedNiagaraPool"))
+	int32 SharedNiagaraPoolOwnerQuota;
+
+	/**
+	 * 데이터 테이블의 NiagaraPool 설정 값을 NiagaraSystem별로 보관하는 Map입니다.
+	 * LODVariant의 NiagaraSystem도 원본의 설정 값을 바탕으로 보관합니다.
+	 */
+	TMap<TObjectPtr<UNiagaraSystem>, FPRNiagaraEffectPoolSettings> NiagaraPoolSettingsCache;
 	
 	/** NiagaraSystem ObjectPool입니다. */
 	UPROPERTY(VisibleAnywhere, BlueprintReadWrite, Category = "PREffectSystem|NiagaraSystem", meta = (AllowPrivateAccess = "true"))
@@ -706,6 +1245,151 @@ private:
 	/** 동적으로 제거할 NiagaraSystem의 목록입니다. */
 	UPROPERTY(VisibleAnywhere, BlueprintReadWrite, Category = "PREffectSystem|NiagaraSystem", meta = (AllowPrivateAccess = "true"))
 	FPRDynamicDestroyNiagaraEffectList DynamicDestroyNiagaraList;
+
+	/** NiagaraPool의 사용 통계입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PREffectSystem|NiagaraSystem", meta = (AllowPrivateAccess = "true"))
+	FPREffectPoolStats NiagaraPoolStats;
+
+	/** NiagaraSystem별 활성화 비용입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PREffectSystem|NiagaraSystem", meta = (AllowPrivateAccess = "true"))
+	TMap<TObjectPtr<UNiagaraSystem>, FPREffectActivationStats> NiagaraActivationStats;
+
+public:
+	/** NiagaraPool의 사용 통계를 반환하는 함수입니다. */
+	UFUNCTION(BlueprintCallable, Category = "PREffectSystem|NiagaraSystem")
+	FORCEINLINE FPREffectPoolStats GetNiagaraPoolStats() const { return NiagaraPoolStats; }
+
+	/**
+	 * 주어진 NiagaraSystem의 활성화 비용을 반환하는 함수입니다.
+	 *
+	 * @param NiagaraSystem 활성화 비용을 확인할 NiagaraSystem입니다.
+	 * @return NiagaraSystem의 활성화 비용입니다. 활성화한 적이 없을 경우 기본값을 반환합니다.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "PREffectSystem|NiagaraSystem")
+	FPREffectActivationStats GetNiagaraActivationStats(UNiagaraSystem* NiagaraSystem) const;
+
+private:
+	/**
+	 * NiagaraEffect를 활성화하는 데 걸린 시간을 NiagaraPool의 통계와 NiagaraSystem별 활성화 비용에 기록하는 함수입니다.
+	 *
+	 * @param NiagaraEffect 활성화한 NiagaraEffect입니다.
+	 * @param ActivationTime NiagaraEffect를 활성화하는 데 걸린 시간(초)입니다.
+	 */
+	void RecordNiagaraActivation(const APRNiagaraEffect* NiagaraEffect, float ActivationTime);
+#pragma endregion
+
+#pragma region LoopingNiagaraEffect
+public:
+	/**
+	 * 반복 재생되는 NiagaraEffect를 지정한 위치에 Spawn하는 함수입니다.
+	 * 반환된 Handle로 StopLoopingNiagaraEffect 함수를 호출하거나, Owner가 사망하거나, 수명이 끝나면 Pool로 반환됩니다.
+	 *
+	 * @param SpawnEffect Spawn할 NiagaraEffect
+	 * @param Location NiagaraEffect를 생성할 위치
+	 * @param Rotation NiagaraEffect에 적용한 회전 값
+	 * @param Scale NiagaraEffect에 적용할 크기
+	 * @param Lifespan 반복 재생할 시간입니다. 0보다 작을 경우 Pool의 수명을, 0일 경우 정지할 때까지 재생합니다.
+	 * @param LoopingEffectName StopLoopingNiagaraEffectsByName 함수로 정지할 때 사용하는 이름
+	 * @return 반복 재생되는 NiagaraEffect의 Handle입니다. 최대 개수를 초과하였거나 Spawn에 실패했을 경우 유효하지 않은 Handle을 반환합니다.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "PREffectSystem|LoopingNiagaraEffect")
+	FPRLoopingEffectHandle SpawnLoopingNiagaraEffectAtLocation(UNiagaraSystem* SpawnEffect, FVector Location, FRotator Rotation = FRotator::ZeroRotator, FVector Scale = FVector(1.0f), float Lifespan = -1.0f, FName LoopingEffectName = NAME_None);
+
+	/**
+	 * 반복 재생되는 NiagaraEffect를 지정한 Component에 부착하여 Spawn하는 함수입니다.
+	 * 반환된 Handle로 StopLoopingNiagaraEffect 함수를 호출하거나, Owner가 사망하거나, 수명이 끝나면 Pool로 반환됩니다.
+	 *
+	 * @param SpawnEffect Spawn할 NiagaraEffect
+	 * @param Parent NiagaraEffect를 부착할 Component
+	 * @param AttachSocketName 부착할 소켓의 이름
+	 * @param Location NiagaraEffect를 생성할 위치
+	 * @param Rotation NiagaraEffect에 적용한 회전 값
+	 * @param Scale NiagaraEffect에 적용할 크기
+	 * @param Lifespan 반복 재생할 시간입니다. 0보다 작을 경우 Pool의 수명을, 0일 경우 정지할 때까지 재생합니다.
+	 * @param LoopingEffectName StopLoopingNiagaraEffectsByName 함수로 정지할 때 사용하는 이름
+	 * @return 반복 재생되는 NiagaraEffect의 Handle입니다. 최대 개수를 초과하였거나 Spawn에 실패했을 경우 유효하지 않은 Handle을 반환합니다.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "PREffectSystem|LoopingNiagaraEffect")
+	FPRLoopingEffectHandle SpawnLoopingNiagaraEffectAttached(UNiagaraSystem* SpawnEffect, USceneComponent* Parent, FName AttachSocketName, FVector Location, FRotator Rotation, FVector Scale = FVector(1.0f), float Lifespan = -1.0f, FName LoopingEffectName = NAME_None);
+
+	/**
+	 * 주어진 Handle에 해당하는 반복 재생 중인 NiagaraEffect를 정지하고 Pool로 반환하는 함수입니다.
+	 *
+	 * @param LoopingEffectHandle 정지할 NiagaraEffect의 Handle입니다. 정지한 후 무효화됩니다.
+	 * @return NiagaraEffect를 정지했을 경우 true를 반환합니다. 이미 정지되었을 경우 false를 반환합니다.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "PREffectSystem|LoopingNiagaraEffect")
+	bool StopLoopingNiagaraEffect(UPARAM(ref) FPRLoopingEffectHandle& LoopingEffectHandle);
+
+	/**
+	 * 주어진 이름으로 Spawn한 반복 재생 중인 NiagaraEffect를 모두 정지하는 함수입니다.
+	 *
+	 * @param LoopingEffectName 정지할 NiagaraEffect의 이름입니다.
+	 * @return 정지한 NiagaraEffect의 수입니다.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "PREffectSystem|LoopingNiagaraEffect")
+	int32 StopLoopingNiagaraEffectsByName(FName LoopingEffectName);
+
+	/** 반복 재생 중인 모든 NiagaraEffect를 정지하는 함수입니다. */
+	UFUNCTION(BlueprintCallable, Category = "PREffectSystem|LoopingNiagaraEffect")
+	void StopAllLoopingNiagaraEffects();
+
+	/**
+	 * 주어진 Handle에 해당하는 반복 재생 중인 NiagaraEffect를 반환하는 함수입니다.
+	 *
+	 * @param LoopingEffectHandle 찾을 NiagaraEffect의 Handle입니다.
+	 * @return 반복 재생 중인 NiagaraEffect입니다. 정지되었을 경우 nullptr을 반환합니다.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "PREffectSystem|LoopingNiagaraEffect")
+	APRNiagaraEffect* GetLoopingNiagaraEffect(const FPRLoopingEffectHandle& LoopingEffectHandle) const;
+
+	/**
+	 * 주어진 Handle에 해당하는 NiagaraEffect가 반복 재생 중인지 확인하는 함수입니다.
+	 *
+	 * @param LoopingEffectHandle 확인할 NiagaraEffect의 Handle입니다.
+	 * @return 반복 재생 중일 경우 true를 반환합니다.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "PREffectSystem|LoopingNiagaraEffect")
+	bool IsLoopingNiagaraEffectActive(const FPRLoopingEffectHandle& LoopingEffectHandle) const;
+
+private:
+	/**
+	 * 활성화된 NiagaraEffect를 반복 재생 목록에 등록하고 Handle을 반환하는 함수입니다.
+	 *
+	 * @param NiagaraEffect 등록할 NiagaraEffect입니다.
+	 * @param Lifespan 반복 재생할 시간입니다. 0보다 작을 경우 Pool의 수명을 사용합니다.
+	 * @param LoopingEffectName 반복 재생 NiagaraEffect의 이름입니다.
+	 * @return 등록한 NiagaraEffect의 Handle입니다.
+	 */
+	FPRLoopingEffectHandle RegisterLoopingNiagaraEffect(APRNiagaraEffect* NiagaraEffect, float Lifespan, FName LoopingEffectName);
+
+	/**
+	 * 주어진 NiagaraEffect를 반복 재생 목록에서 제거하는 함수입니다.
+	 *
+	 * @param NiagaraEffect 제거할 NiagaraEffect입니다.
+	 */
+	void UnregisterLoopingNiagaraEffect(APRNiagaraEffect* NiagaraEffect);
+
+	/**
+	 * 반복 재생할 수 있는 NiagaraEffect의 수가 남아있는지 확인하는 함수입니다.
+	 *
+	 * @return 최대 개수를 초과하지 않았을 경우 true를 반환합니다.
+	 */
+	bool HasLoopingNiagaraEffectBudget() const;
+
+private:
+	/** 동시에 반복 재생할 수 있는 NiagaraEffect의 최대 개수입니다. 0 이하일 경우 제한하지 않습니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "PREffectSystem|LoopingNiagaraEffect", meta = (AllowPrivateAccess = "true"))
+	int32 MaxLoopingNiagaraEffects;
+
+	/** 다음에 발급할 Handle의 ID입니다. */
+	int32 NextLoopingEffectHandleID;
+	
+	/** Handle의 ID와 반복 재생 중인 NiagaraEffect를 보관하는 Map입니다. */
+	TMap<int32, FPRLoopingNiagaraEffect> LoopingNiagaraEffects;
+
+	/** 반복 재생 중인 NiagaraEffect와 Handle의 ID를 보관하는 Map입니다. */
+	TMap<TWeakObjectPtr<APRNiagaraEffect>, int32> LoopingNiagaraEffectHandleIDs;
 #pragma endregion
 
 
@@ -729,10 +1413,11 @@ public:
 	 * @param Scale ParticleEffect에 적용할 크기
 	 * @param bEffectAutoActivate true일 경우 ParticleEffect를 Spawn하자마다 ParticleEffect를 실행합니다. false일 경우 ParticleEffect를 실행하지 않습니다.
 	 * @param bReset 처음부터 다시 재생할지 여부
+	 * @param bAllowSpawnCulling true일 경우 카메라에 보이지 않는 Spawn 요청을 컬링합니다. 컬링되면 nullptr을 반환하고 다시 Spawn하지 않으므로 외형만을 위한 이펙트에서만 사용합니다.
 	 * @return 지정한 위치에 Spawn한 ParticleEffect입니다.
 	 */
 	UFUNCTION(BlueprintCallable, Category = "PREffectSystem|ParticleEffect")
-	APRParticleEffect* SpawnParticleEffectAtLocation(UParticleSystem* SpawnEffect, FVector Location, FRotator Rotation = FRotator::ZeroRotator, FVector Scale = FVector(1.0f), bool bEffectAutoActivate = true, bool bReset = false);
+	APRParticleEffect* SpawnParticleEffectAtLocation(UParticleSystem* SpawnEffect, FVector Location, FRotator Rotation = FRotator::ZeroRotator, FVector Scale = FVector(1.0f), bool bEffectAutoActivate = true, bool bReset = false, bool bAllowSpawnCulling = false);
 	
 	/**
 	 * ParticleEffect를 지정한 Component에 부착하여 Spawn하는 함수입니다.
@@ -745,10 +1430,11 @@ public:
 	 * @param Scale ParticleEffect에 적용할 크기
 	 * @param bEffectAutoActivate true일 경우 ParticleEffect를 Spawn하자마다 ParticleEffect를 실행합니다. false일 경우 ParticleEffect를 실행하지 않습니다.
 	 * @param bReset 처음부터 다시 재생할지 여부
+	 * @param bAllowSpawnCulling true일 경우 카메라에 보이지 않는 Spawn 요청을 컬링합니다. 컬링되면 nullptr을 반환하고 다시 Spawn하지 않으므로 외형만을 위한 이펙트에서만 사용합니다.
 	 * @return 지정한 Component에 부착하여 Spawn한 ParticleEffect입니다.
 	 */
 	UFUNCTION(BlueprintCallable, Category = "PREffectSystem|ParticleEffect")
-	APRParticleEffect* SpawnParticleEffectAttached(UParticleSystem* SpawnEffect, USceneComponent* Parent, FName AttachSocketName, FVector Location, FRotator Rotation, FVector Scale = FVector(1.0f), bool bEffectAutoActivate = true, bool bReset = false);
+	APRParticleEffect* SpawnParticleEffectAttached(UParticleSystem* SpawnEffect, USceneComponent* Parent, FName AttachSocketName, FVector Location, FRotator Rotation, FVector Scale = FVector(1.0f), bool bEffectAutoActivate = true, bool bReset = false, bool bAllowSpawnCulling = false);
 
 	/**
 	 * 주어진 ParticleSystem에 해당하는 활성화할 수 있는 ParticleEffect를 반환하는 함수입니다.
@@ -889,7 +1575,6 @@ private:
 	 *
 	 * @param TargetEffect 비활성화되는 Effect입니다.
 	 */
-	UFUNCTION()
 	void OnParticleEffectDeactivate(APREffect* TargetEffect);
 
 	/**
@@ -897,7 +1582,6 @@ private:
 	 *
 	 * @param TargetEffect 비활성화되는 Effect입니다.
 	 */
-	UFUNCTION()
 	void OnDynamicParticleEffectDeactivate(APREffect* TargetEffect);
 
 	/**
@@ -931,4 +1615,13 @@ private:
 	/** 동적으로 제거할 ParticleSystem의 목록입니다. */
 	UPROPERTY(VisibleAnywhere, BlueprintReadWrite, Category = "PREffectSystem|ParticleSystem", meta = (AllowPrivateAccess = "true"))
 	FPRDynamicDestroyParticleEffectList DynamicDestroyParticleList;
+
+	/** ParticlePool의 사용 통계입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PREffectSystem|ParticleSystem", meta = (AllowPrivateAccess = "true"))
+	FPREffectPoolStats ParticlePoolStats;
+
+public:
+	/** ParticlePool의 사용 통계를 반환하는 함수입니다. */
+	UFUNCTION(BlueprintCallable, Category = "PREffectSystem|ParticleSystem")
+	FORCEINLINE FPREffectPoolStats GetParticlePoolStats() const { return ParticlePoolStats; }
 };
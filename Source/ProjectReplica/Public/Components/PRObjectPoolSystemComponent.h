@@ -254,7 +254,6 @@ private:
 	 * 
 	 * @param PooledObject 비활성화된 오브젝트입니다.
 	 */
-	UFUNCTION(BlueprintCallable, Category = "PRObjectPoolSystem")
 	void OnPooledObjectDeactivate(APRPooledObject* PooledObject);
 
 	/**
@@ -262,7 +261,6 @@ private:
 	 * 
 	 * @param PooledObject 비활성화된 동적으로 생성한 오브젝트입니다.
 	 */
-	UFUNCTION(BlueprintCallable, Category = "PRObjectPoolSystem")
 	void OnDynamicObjectDeactivate(APRPooledObject* PooledObject);
 
 	/**
@@ -9,7 +9,8 @@
 
 class UFXSystemComponent;
 
-DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnEffectDeactivate, APREffect*, Effect);
+/** 이펙트가 비활성화될 때 실행하는 델리게이트입니다. 이펙트마다 바인딩하므로 리플렉션을 거치지 않는 네이티브 델리게이트를 사용합니다. */
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnEffectDeactivate, APREffect*);
 
 /**
  * EffectSystem이 관리하는 이펙트 클래스입니다.
@@ -82,6 +83,15 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "PREffect")
 	virtual UFXSystemComponent* GetFXSystemComponent() const; 
 
+	/**
+	 * 현재 활성화된 동안에만 적용할 수명을 설정하는 함수입니다.
+	 * 설정된 EffectLifespan은 변경하지 않으므로 Pool로 반환된 후 다시 활성화하면 EffectLifespan을 사용합니다.
+	 *
+	 * @param NewLifespan 적용할 수명입니다. 0보다 작거나 같을 경우 비활성화할 때까지 유지합니다.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "PREffect")
+	void SetActivationLifespan(float NewLifespan);
+
 protected:
 	/**
 	 * 이펙트를 초기화하는 함수입니다.
@@ -121,6 +131,9 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PREffect")
 	int32 PoolIndex;
 
+	/** 이펙트가 비활성화되어 Pool로 반환될 때마다 증가하는 값입니다. Spawn한 곳에서 이펙트가 다른 곳에 재사용되었는지 판별할 때 사용합니다. */
+	uint32 EffectGeneration;
+
 public:
 	/** EffectLifespan을 반환하는 함수입니다. */
 	float GetEffectLifespan() const;
@@ -128,7 +141,55 @@ public:
 	/** EffectOwner를 반환하는 함수입니다. */
 	FORCEINLINE AActor* GetEffectOwner() const { return EffectOwner; }
 
+	/**
+	 * EffectOwner를 설정하는 함수입니다. 여러 Owner가 공유하는 Pool에서 이펙트를 가져올 때 사용합니다.
+	 *
+	 * @param NewEffectOwner 이펙트의 새로운 소유자
+	 */
+	FORCEINLINE void SetEffectOwner(AActor* NewEffectOwner) { EffectOwner = NewEffectOwner; }
+
+	/** EffectGeneration을 반환하는 함수입니다. */
+	FORCEINLINE uint32 GetEffectGeneration() const { return EffectGeneration; }
+
 public:
 	/** 이펙트가 비활성화될 때 실행하는 델리게이트입니다. */
 	FOnEffectDeactivate OnEffectDeactivateDelegate;
 };
+
+/**
+ * Spawn한 이펙트와 Spawn할 때의 EffectGeneration을 함께 보관하는 구조체입니다.
+ * 이펙트가 Pool로 반환된 후에는 다른 Notify 인스턴스나 공유 Pool의 다른 Owner가 사용할 수 있으므로 더 이상 이펙트를 반환하지 않습니다.
+ */
+template <typename EffectType>
+struct TPRSpawnedEffectHandle
+{
+public:
+	TPRSpawnedEffectHandle()
+		: Effect(nullptr)
+		, EffectGeneration(0)
+	{}
+
+	TPRSpawnedEffectHandle(EffectType* NewEffect)
+		: Effect(NewEffect)
+		, EffectGeneration(NewEffect ? NewEffect->GetEffectGeneration() : 0)
+	{}
+
+public:
+	/** Spawn한 이펙트입니다. */
+	TWeakObjectPtr<EffectType> Effect;
+
+	/** 이펙트를 Spawn할 때의 EffectGeneration입니다. */
+	uint32 EffectGeneration;
+
+public:
+	/**
+	 * Spawn한 이펙트를 반환하는 함수입니다.
+	 *
+	 * @return Spawn한 후 Pool로 반환되지 않은 이펙트입니다. 소멸되었거나 Pool로 반환되었을 경우 nullptr를 반환합니다.
+	 */
+	FORCEINLINE EffectType* Get() const
+	{
+		EffectType* SpawnedEffect = Effect.Get();
+		return SpawnedEffect && SpawnedEffect->GetEffectGeneration() == EffectGeneration ? SpawnedEffect : nullptr;
+	}
+};
@@ -0,0 +1,229 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "ProjectReplica.h"
+#include "GameFramework/Actor.h"
+#include "PREffectPoolBenchmark.generated.h"
+
+class UNiagaraSystem;
+class UPREffectSystemComponent;
+
+/** 이펙트 Pool 벤치마크에서 비교할 Spawn 방식을 나타내는 열거형입니다. */
+UENUM(BlueprintType)
+enum class EPREffectPoolBenchmarkMode : uint8
+{
+	EffectPoolBenchmarkMode_CustomPool			UMETA(DisplayName = "CustomPool"),			// UPREffectSystemComponent의 Pool을 사용합니다.
+	EffectPoolBenchmarkMode_AutoRelease			UMETA(DisplayName = "AutoRelease"),			// 엔진의 ENCPoolMethod::AutoRelease를 사용합니다.
+	EffectPoolBenchmarkMode_NoPooling			UMETA(DisplayName = "NoPooling")			// Pool을 사용하지 않습니다.
+};
+
+/**
+ * 이펙트 Pool 벤치마크의 Spawn 방식별 측정 결과를 나타내는 구조체입니다.
+ */
+USTRUCT(Atomic, BlueprintType)
+struct FPREffectPoolBenchmarkResult
+{
+	GENERATED_BODY()
+
+public:
+	FPREffectPoolBenchmarkResult()
+		: Mode(EPREffectPoolBenchmarkMode::EffectPoolBenchmarkMode_CustomPool)
+		, Frames(0)
+		, SpawnedEffects(0)
+		, TotalSpawnTime(0.0)
+		, MaxFrameSpawnTime(0.0)
+		, MemoryDeltaMB(0.0)
+		, GarbageCollections(0)
+		, GarbageCollectionTime(0.0)
+	{}
+
+	FPREffectPoolBenchmarkResult(EPREffectPoolBenchmarkMode NewMode)
+		: Mode(NewMode)
+		, Frames(0)
+		, SpawnedEffects(0)
+		, TotalSpawnTime(0.0)
+		, MaxFrameSpawnTime(0.0)
+		, MemoryDeltaMB(0.0)
+		, GarbageCollections(0)
+		, GarbageCollectionTime(0.0)
+	{}
+
+public:
+	/** 측정한 Spawn 방식입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PREffectPoolBenchmarkResult")
+	EPREffectPoolBenchmarkMode Mode;
+
+	/** 측정한 프레임의 수입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PREffectPoolBenchmarkResult")
+	int32 Frames;
+
+	/** Spawn한 이펙트의 수입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PREffectPoolBenchmarkResult")
+	int32 SpawnedEffects;
+
+	/** 이펙트를 Spawn하는 데 걸린 시간(초)의 합입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PREffectPoolBenchmarkResult")
+	double TotalSpawnTime;
+
+	/** 한 프레임에서 이펙트를 Spawn하는 데 걸린 최대 시간(초)입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PREffectPoolBenchmarkResult")
+	double MaxFrameSpawnTime;
+
+	/** 측정을 시작할 때와 끝날 때의 사용 중인 물리 메모리의 차이(MB)입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PREffectPoolBenchmarkResult")
+	double MemoryDeltaMB;
+
+	/** 측정 중에 실행된 가비지 컬렉션의 횟수입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PREffectPoolBenchmarkResult")
+	int32 GarbageCollections;
+
+	/** 측정 중에 가비지 컬렉션에 걸린 시간(초)의 합입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PREffectPoolBenchmarkResult")
+	double GarbageCollectionTime;
+};
+
+/**
+ * UPREffectSystemComponent의 Pool과 엔진의 NiagaraComponent Pool, Pool을 사용하지 않는 경우의 이펙트 Spawn 비용을 비교하는 Actor 클래스입니다.
+ * 빈 레벨에 배치한 후 -nullrhi로 실행하거나 ProjectReplica.EffectSystem.Benchmark.PoolModes 자동화 테스트로 실행하면 Spawn 방식별로 매 프레임 EffectsPerFrame개의 이펙트를 Spawn하여
+ * Spawn 시간, 메모리, 가비지 컬렉션 시간을 측정하고 결과를 Saved/Profiling/PREffectPoolBenchmark에 CSV로 저장합니다.
+ * CustomPool은 캐릭터의 데이터 테이블을 사용하지 않고 BenchmarkNiagaraSystem의 Pool을 직접 생성하여 측정합니다.
+ */
+UCLASS()
+class PROJECTREPLICA_API APREffectPoolBenchmark : public AActor
+{
+	GENERATED_BODY()
+
+public:
+	APREffectPoolBenchmark();
+
+protected:
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	virtual void Tick(float DeltaSeconds) override;
+
+public:
+	/** 벤치마크를 처음부터 시작하는 함수입니다. */
+	UFUNCTION(BlueprintCallable, Category = "PREffectPoolBenchmark")
+	void StartBenchmark();
+
+	/** 측정 결과를 반환하는 함수입니다. */
+	UFUNCTION(BlueprintCallable, Category = "PREffectPoolBenchmark")
+	FORCEINLINE TArray<FPREffectPoolBenchmarkResult> GetBenchmarkResults() const { return BenchmarkResults; }
+
+	/** 벤치마크가 측정 중인지 확인하는 함수입니다. */
+	UFUNCTION(BlueprintCallable, Category = "PREffectPoolBenchmark")
+	FORCEINLINE bool IsBenchmarkRunning() const { return CurrentModeIndex != INDEX_NONE; }
+
+	/** 마지막으로 저장한 CSV 파일의 경로를 반환하는 함수입니다. 저장에 실패했을 경우 빈 문자열을 반환합니다. */
+	UFUNCTION(BlueprintCallable, Category = "PREffectPoolBenchmark")
+	FORCEINLINE FString GetBenchmarkCsvFilePath() const { return BenchmarkCsvFilePath; }
+
+private:
+	/** CustomPool을 측정할 때 사용할 BenchmarkNiagaraSystem의 NiagaraPool을 생성하는 함수입니다. */
+	void InitializeCustomPool();
+
+	/** 현재 Spawn 방식의 측정을 시작하는 함수입니다. */
+	void BeginMode();
+
+	/** 현재 Spawn 방식의 측정을 끝내고 다음 Spawn 방식으로 넘어가는 함수입니다. */
+	void EndMode();
+
+	/** 벤치마크를 끝내고 결과를 CSV로 저장하는 함수입니다. */
+	void FinishBenchmark();
+
+	/**
+	 * 현재 Spawn 방식으로 이펙트 하나를 Spawn하는 함수입니다.
+	 *
+	 * @param Mode 이펙트를 Spawn할 방식입니다.
+	 * @param SpawnLocation 이펙트를 Spawn할 위치입니다.
+	 */
+	void SpawnBenchmarkEffect(EPREffectPoolBenchmarkMode Mode, const FVector& SpawnLocation);
+
+	/**
+	 * 측정 결과를 CSV 문자열로 변환하는 함수입니다.
+	 *
+	 * @return 측정 결과를 나타내는 CSV 문자열입니다.
+	 */
+	FString MakeBenchmarkCsv() const;
+
+	/** 가비지 컬렉션이 시작될 때 호출되는 함수입니다. */
+	void OnPreGarbageCollect();
+
+	/** 가비지 컬렉션이 끝났을 때 호출되는 함수입니다. */
+	void OnPostGarbageCollect();
+
+	/** 사용 중인 물리 메모리(MB)를 반환하는 함수입니다. */
+	static double GetUsedPhysicalMemoryMB();
+
+private:
+	/** 벤치마크에서 Spawn할 NiagaraSystem입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "PREffectPoolBenchmark", meta = (AllowPrivateAccess = "true"))
+	TObjectPtr<UNiagaraSystem> BenchmarkNiagaraSystem;
+
+	/** CustomPool을 측정할 때 이펙트를 Spawn하는 EffectSystem입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PREffectPoolBenchmark", meta = (AllowPrivateAccess = "true"))
+	TObjectPtr<UPREffectSystemComponent> BenchmarkEffectSystem;
+
+	/**
+	 * CustomPool을 측정할 때 생성할 NiagaraPool의 크기입니다.
+	 * EffectsPerFrame과 CustomPoolEffectLifespan 동안의 프레임 수를 곱한 값보다 커야 측정 중에 동적으로 생성하지 않습니다.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "PREffectPoolBenchmark", meta = (AllowPrivateAccess = "true", ClampMin = "1"))
+	int32 CustomPoolSize;
+
+	/** CustomPool을 측정할 때 Spawn한 이펙트가 Pool로 돌아가기까지의 수명입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "PREffectPoolBenchmark", meta = (AllowPrivateAccess = "true", ClampMin = "0.0"))
+	float CustomPoolEffectLifespan;
+
+	/** 측정할 Spawn 방식의 목록입니다. 목록의 순서대로 측정합니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "PREffectPoolBenchmark", meta = (AllowPrivateAccess = "true"))
+	TArray<EPREffectPoolBenchmarkMode> BenchmarkModes;
+
+	/** 매 프레임 Spawn할 이펙트의 수입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "PREffectPoolBenchmark", meta = (AllowPrivateAccess = "true", ClampMin = "1"))
+	int32 EffectsPerFrame;
+
+	/** Spawn 방식별로 측정할 프레임의 수입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "PREffectPoolBenchmark", meta = (AllowPrivateAccess = "true", ClampMin = "1"))
+	int32 MeasureFrames;
+
+	/** Spawn 방식을 바꾼 후 측정을 시작하기 전에 이전 이펙트가 정리되도록 기다리는 프레임의 수입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "PREffectPoolBenchmark", meta = (AllowPrivateAccess = "true", ClampMin = "0"))
+	int32 CooldownFrames;
+
+	/** 이펙트를 Spawn할 범위의 반지름입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "PREffectPoolBenchmark", meta = (AllowPrivateAccess = "true"))
+	float SpawnRadius;
+
+	/** BeginPlay에서 벤치마크를 시작할지 나타내는 변수입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "PREffectPoolBenchmark", meta = (AllowPrivateAccess = "true"))
+	bool bStartOnBeginPlay;
+
+	/** 벤치마크가 끝난 후 게임을 종료할지 나타내는 변수입니다. 헤드리스 실행에서 사용합니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "PREffectPoolBenchmark", meta = (AllowPrivateAccess = "true"))
+	bool bQuitWhenFinished;
+
+	/** Spawn 방식별 측정 결과입니다. */
+	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category = "PREffectPoolBenchmark", meta = (AllowPrivateAccess = "true"))
+	TArray<FPREffectPoolBenchmarkResult> BenchmarkResults;
+
+	/** 마지막으로 저장한 CSV 파일의 경로입니다. */
+	FString BenchmarkCsvFilePath;
+
+	/** 측정 중인 Spawn 방식의 BenchmarkModes Index입니다. */
+	int32 CurrentModeIndex;
+
+	/** 현재 Spawn 방식에서 남은 대기 프레임의 수입니다. */
+	int32 RemainingCooldownFrames;
+
+	/** 측정을 시작할 때 사용 중인 물리 메모리(MB)입니다. */
+	double ModeStartMemoryMB;
+
+	/** 가비지 컬렉션이 시작된 시간입니다. */
+	double GarbageCollectStartTime;
+
+	/** 가비지 컬렉션 델리게이트의 핸들입니다. */
+	FDelegateHandle PreGarbageCollectHandle;
+	FDelegateHandle PostGarbageCollectHandle;
+};
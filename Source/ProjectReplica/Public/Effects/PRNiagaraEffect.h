@@ -42,6 +42,13 @@ public:
 	/** 이펙트를 비활성화하는 함수입니다. */
 	virtual void DeactivateEffect() override;
 
+	/**
+	 * NiagaraEffect를 보이지 않게 한 번 활성화하였다가 즉시 비활성화하는 함수입니다.
+	 * System Instance와 Data Interface의 초기화를 미리 수행하여 첫 번째 활성화의 비용을 줄입니다.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "PRNiagaraEffect")
+	void PrimeNiagaraEffect();
+
 	/** FXSystemComponent를 반환하는 함수입니다. */
 	virtual UFXSystemComponent* GetFXSystemComponent() const override; 
 
@@ -0,0 +1,155 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "ProjectReplica.h"
+#include "UObject/ObjectKey.h"
+
+/** 클래스가 가지는 기능을 나타내는 플래그입니다. */
+enum class EPRClassCapabilityFlags : uint8
+{
+	None							= 0,
+	Poolable						= 1 << 0,		// IPRPoolableInterface를 구현함
+	Damageable						= 1 << 1,		// IPRDamageableInterface를 구현함
+	PoolableBlueprintOverride		= 1 << 2,		// IPRPoolableInterface의 함수를 블루프린트에서 구현하거나 오버라이드함
+	DamageableBlueprintOverride		= 1 << 3		// IPRDamageableInterface의 함수를 블루프린트에서 구현하거나 오버라이드함
+};
+ENUM_CLASS_FLAGS(EPRClassCapabilityFlags);
+
+/** 클래스의 오브젝트를 보관하기에 적합한 Pool을 나타내는 열거형입니다. */
+enum class EPRPreferredPool : uint8
+{
+	None,				// 풀링할 수 없음
+	Object,				// PRObjectPoolSystemComponent
+	Effect,				// PREffectSystemComponent, PRSharedEffectPoolSubsystem
+	AICharacter			// PRAISpawner
+};
+
+/** 블루프린트 오버라이드를 기록하는 IPRPoolableInterface 함수의 비트 Index입니다. */
+enum class EPRPoolableFunction : uint8
+{
+	IsActivate,
+	Activate,
+	Deactivate,
+	GetPoolIndex,
+	GetLifespan,
+	SetLifespan,
+	Count
+};
+
+/** 블루프린트 오버라이드를 기록하는 IPRDamageableInterface 함수의 비트 Index입니다. */
+enum class EPRDamageableFunction : uint8
+{
+	GetCurrentHealth,
+	GetMaxHealth,
+	Heal,
+	TakeDamage,
+	Count
+};
+
+/**
+ * 클래스 하나의 기능을 나타내는 구조체입니다.
+ */
+struct FPRClassCapabilities
+{
+public:
+	FPRClassCapabilities()
+		: Flags(EPRClassCapabilityFlags::None)
+		, PreferredPool(EPRPreferredPool::None)
+		, PoolableNativeMask(0)
+		, DamageableNativeMask(0)
+	{}
+
+public:
+	/** 클래스가 가지는 기능의 플래그입니다. */
+	EPRClassCapabilityFlags Flags;
+
+	/** 클래스의 오브젝트를 보관하기에 적합한 Pool입니다. */
+	EPRPreferredPool PreferredPool;
+
+	/** C++ 구현을 직접 호출할 수 있는 IPRPoolableInterface 함수의 비트입니다. */
+	uint32 PoolableNativeMask;
+
+	/** C++ 구현을 직접 호출할 수 있는 IPRDamageableInterface 함수의 비트입니다. */
+	uint32 DamageableNativeMask;
+
+public:
+	FORCEINLINE bool IsPoolable() const { return EnumHasAnyFlags(Flags, EPRClassCapabilityFlags::Poolable); }
+	FORCEINLINE bool IsDamageable() const { return EnumHasAnyFlags(Flags, EPRClassCapabilityFlags::Damageable); }
+	FORCEINLINE bool HasBlueprintOverride() const { return EnumHasAnyFlags(Flags, EPRClassCapabilityFlags::PoolableBlueprintOverride | EPRClassCapabilityFlags::DamageableBlueprintOverride); }
+	FORCEINLINE bool IsNative(EPRPoolableFunction Function) const { return (PoolableNativeMask & (1u << static_cast<uint32>(Function))) != 0; }
+	FORCEINLINE bool IsNative(EPRDamageableFunction Function) const { return (DamageableNativeMask & (1u << static_cast<uint32>(Function))) != 0; }
+};
+
+/**
+ * 클래스별 기능을 캐시하는 Registry입니다.
+ * ImplementsInterface는 클래스 계층과 Interface 목록을 탐색하므로 클래스마다 처음 확인할 때 한 번만 계산하고 이후에는 Map에서 찾습니다.
+ * 블루프린트를 다시 컴파일하거나 Hot Reload를 하면 클래스가 바뀌므로 캐시를 비웁니다.
+ * 게임 스레드에서만 사용합니다.
+ */
+class PROJECTREPLICA_API FPRClassCapabilityRegistry
+{
+public:
+	/** Registry를 반환하는 함수입니다. */
+	static FPRClassCapabilityRegistry& Get();
+
+	/**
+	 * 주어진 클래스의 기능을 반환하는 함수입니다. 처음 확인하는 클래스는 기능을 계산하여 캐시합니다.
+	 *
+	 * @param Class 기능을 확인할 클래스입니다.
+	 * @return 클래스의 기능입니다. 클래스가 nullptr일 경우 기능이 없습니다.
+	 */
+	FPRClassCapabilities GetCapabilities(const UClass* Class);
+
+	/** 캐시를 비우는 함수입니다. */
+	void Invalidate();
+
+	/** 주어진 오브젝트가 유효하고 IPRPoolableInterface를 구현하는지 확인하는 함수입니다. */
+	static bool IsPoolable(const UObject* Object);
+
+	/** 주어진 클래스가 IPRPoolableInterface를 구현하는지 확인하는 함수입니다. */
+	static bool IsPoolableClass(const UClass* Class);
+
+	/** 주어진 오브젝트가 유효하고 IPRDamageableInterface를 구현하는지 확인하는 함수입니다. */
+	static bool IsDamageable(const UObject* Object);
+
+	/** 주어진 클래스가 IPRDamageableInterface를 구현하는지 확인하는 함수입니다. */
+	static bool IsDamageableClass(const UClass* Class);
+
+	/** 주어진 클래스의 오브젝트를 보관하기에 적합한 Pool을 반환하는 함수입니다. */
+	static EPRPreferredPool GetPreferredPool(const UClass* Class);
+
+private:
+	FPRClassCapabilityRegistry();
+
+	/** 주어진 클래스의 기능을 계산하는 함수입니다. */
+	static FPRClassCapabilities BuildCapabilities(const UClass* Class);
+
+	/**
+	 * 주어진 클래스에서 C++ 구현을 직접 호출할 수 있는 Interface 함수의 비트를 구하는 함수입니다.
+	 *
+	 * @param Class 확인할 클래스입니다.
+	 * @param InterfaceClass 함수를 선언한 Interface 클래스입니다.
+	 * @param FunctionNames 비트 Index 순서대로 나열한 함수의 이름입니다.
+	 * @return C++에서 Interface를 구현했고 블루프린트에서 오버라이드하지 않은 함수의 비트입니다.
+	 */
+	static uint32 BuildNativeMask(const UClass* Class, UClass* InterfaceClass, TConstArrayView<FName> FunctionNames);
+
+	/** Hot Reload가 끝났을 때 호출되는 함수입니다. */
+	void OnReloadComplete(EReloadCompleteReason Reason);
+
+#if WITH_EDITOR
+	/** 블루프린트를 다시 컴파일하여 오브젝트가 재생성되었을 때 호출되는 함수입니다. */
+	void OnObjectsReinstanced(const TMap<UObject*, UObject*>& OldToNewInstanceMap);
+#endif
+
+private:
+	/** 클래스별 기능입니다. */
+	TMap<TObjectKey<UClass>, FPRClassCapabilities> Capabilities;
+
+	/** 마지막으로 확인한 클래스입니다. Pool과 대미지 처리는 같은 클래스를 연속으로 확인하므로 Map을 찾지 않도록 기록합니다. */
+	TObjectKey<UClass> LastClass;
+
+	/** 마지막으로 확인한 클래스의 기능입니다. */
+	FPRClassCapabilities LastCapabilities;
+};
@@ -0,0 +1,129 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "ProjectReplica.h"
+#include "Interfaces/PRPoolableInterface.h"
+#include "Interfaces/PRDamageableInterface.h"
+#include "Interfaces/PRClassCapabilityRegistry.h"
+#include "PRInterfaceDispatch.generated.h"
+
+/**
+ * IPRPoolableInterface의 함수를 호출하는 클래스입니다.
+ * 블루프린트 오버라이드 여부는 FPRClassCapabilityRegistry에서 클래스별로 캐시합니다.
+ * 블루프린트에서 오버라이드하지 않은 함수는 ProcessEvent를 거치지 않고 C++ 구현을 직접 호출하고, 오버라이드한 함수는 Execute_로 호출합니다.
+ */
+class PROJECTREPLICA_API FPRPoolableDispatch
+{
+public:
+	static bool IsActivate(const UObject* Object);
+	static void Activate(UObject* Object);
+	static void Deactivate(UObject* Object);
+	static int32 GetPoolIndex(const UObject* Object);
+	static float GetLifespan(const UObject* Object);
+	static void SetLifespan(UObject* Object, float NewLifespan);
+
+private:
+	/** 함수의 C++ 구현을 직접 호출할 수 있으면 Interface를, 없으면 nullptr을 반환하는 함수입니다. */
+	static IPRPoolableInterface* GetNativeInterface(const UObject* Object, EPRPoolableFunction Function);
+};
+
+/**
+ * IPRDamageableInterface의 함수를 호출하는 클래스입니다.
+ * 블루프린트 오버라이드 여부는 FPRClassCapabilityRegistry에서 클래스별로 캐시합니다.
+ * 블루프린트에서 오버라이드하지 않은 함수는 ProcessEvent를 거치지 않고 C++ 구현을 직접 호출하고, 오버라이드한 함수는 Execute_로 호출합니다.
+ */
+class PROJECTREPLICA_API FPRDamageableDispatch
+{
+public:
+	static float GetCurrentHealth(UObject* Object);
+	static float GetMaxHealth(UObject* Object);
+	static float Heal(UObject* Object, float Amount);
+
+	/**
+	 * 대미지 큐를 거치지 않는 대미지를 처리하는 함수입니다.
+	 * 대미지 큐를 거치지 않는 대미지는 모두 이 함수에서 처리하므로 대상의 종류와 관계없이 한 곳에서 대미지 스트림과 전투 텔레메트리에 기록합니다.
+	 *
+	 * @param Object 대미지를 받을 대상입니다.
+	 * @param DamageInfo 대미지의 정보입니다.
+	 * @param Instigator 대미지를 준 액터입니다. 대미지 스트림과 전투 텔레메트리에 기록합니다.
+	 * @return 대상이 대미지에 반응했을 경우 true를 반환합니다.
+	 */
+	static bool TakeDamage(UObject* Object, const FPRDamageInfo& DamageInfo, const AActor* Instigator = nullptr);
+
+	/**
+	 * 기록하지 않고 대상의 TakeDamage를 실행하는 함수입니다.
+	 * 대미지 큐는 대미지를 추가할 때와 처리한 후에 직접 기록하므로 이 함수로 처리합니다.
+	 *
+	 * @param Object 대미지를 받을 대상입니다.
+	 * @param DamageInfo 대미지의 정보입니다.
+	 * @return 대상이 대미지에 반응했을 경우 true를 반환합니다.
+	 */
+	static bool ResolveDamage(UObject* Object, const FPRDamageInfo& DamageInfo);
+
+private:
+	/** 함수의 C++ 구현을 직접 호출할 수 있으면 Interface를, 없으면 nullptr을 반환하는 함수입니다. */
+	static IPRDamageableInterface* GetNativeInterface(UObject* Object, EPRDamageableFunction Function);
+};
+
+/**
+ * Interface 함수의 호출 성능을 비교한 결과를 나타내는 구조체입니다.
+ */
+USTRUCT(Atomic, BlueprintType)
+struct FPRInterfaceDispatchBenchmarkResult
+{
+	GENERATED_BODY()
+
+public:
+	FPRInterfaceDispatchBenchmarkResult()
+		: Calls(0)
+		, PoolableDispatchCallsPerSecond(0.0)
+		, PoolableExecuteCallsPerSecond(0.0)
+		, DamageableDispatchCallsPerSecond(0.0)
+		, DamageableExecuteCallsPerSecond(0.0)
+	{}
+
+public:
+	/** 경로마다 함수를 호출한 횟수입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRInterfaceDispatchBenchmarkResult")
+	int32 Calls;
+
+	/** FPRPoolableDispatch로 IsActivate를 호출한 초당 횟수입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRInterfaceDispatchBenchmarkResult")
+	double PoolableDispatchCallsPerSecond;
+
+	/** Execute_IsActivate를 호출한 초당 횟수입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRInterfaceDispatchBenchmarkResult")
+	double PoolableExecuteCallsPerSecond;
+
+	/** FPRDamageableDispatch로 GetMaxHealth를 호출한 초당 횟수입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRInterfaceDispatchBenchmarkResult")
+	double DamageableDispatchCallsPerSecond;
+
+	/** Execute_GetMaxHealth를 호출한 초당 횟수입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRInterfaceDispatchBenchmarkResult")
+	double DamageableExecuteCallsPerSecond;
+};
+
+/**
+ * Interface 함수를 직접 호출하는 경로와 Execute_로 호출하는 경로의 초당 호출 횟수를 비교하는 클래스입니다.
+ * 콘솔 명령어 PR.Benchmark.InterfaceDispatch [Calls] [PoolableClass] [DamageableClass]로 실행할 수 있습니다.
+ */
+UCLASS()
+class PROJECTREPLICA_API UPRInterfaceDispatchBenchmark : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * 주어진 클래스의 기본 오브젝트로 함수를 반복해서 호출하고 초당 호출 횟수를 측정하는 함수입니다.
+	 * 블루프린트 클래스를 전달하면 오버라이드한 함수가 Execute_로 호출되는 경우를 측정할 수 있습니다.
+	 *
+	 * @param Calls 경로마다 함수를 호출할 횟수입니다.
+	 * @param PoolableClass IsActivate를 호출할 클래스입니다. IPRPoolableInterface를 구현해야 합니다.
+	 * @param DamageableClass GetMaxHealth를 호출할 클래스입니다. IPRDamageableInterface를 구현해야 합니다.
+	 * @return 측정한 결과입니다.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "PRInterfaceDispatchBenchmark")
+	static FPRInterfaceDispatchBenchmarkResult RunDispatchBenchmark(int32 Calls, TSubclassOf<UObject> PoolableClass, TSubclassOf<UObject> DamageableClass);
+};
@@ -35,6 +35,15 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "DamageAmount")
 	void Initialize(FVector SpawnLocation, float DamageAmount, bool bIsCritical, EPRElementType ElementType);
 
+	/**
+	 * 표시 중인 대미지를 갱신하고 FadeOut을 처음부터 다시 실행하는 함수입니다.
+	 *
+	 * @param DamageAmount 표시할 대미지의 양
+	 * @param bIsCritical 치명타 이미지를 표시할지 판별하는 인자
+	 */
+	UFUNCTION(BlueprintCallable, Category = "DamageAmount")
+	void UpdateDamageAmount(float DamageAmount, bool bIsCritical);
+
 protected:
 	/** FadeOut 위젯 애니메이션이 끝났을 때 실행하는 함수입니다. */
 	UFUNCTION()
@@ -7,7 +7,8 @@
 #include "Interfaces/PRPoolableInterface.h"
 #include "PRPooledObject.generated.h"
 
-DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnPooledObjectDeactivate, APRPooledObject*, PooledObject);
+/** 오브젝트가 비활성화될 때 실행하는 델리게이트입니다. 오브젝트마다 바인딩하므로 리플렉션을 거치지 않는 네이티브 델리게이트를 사용합니다. */
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnPooledObjectDeactivate, APRPooledObject*);
 // DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnDynamicPooledObjectDeactivate, APRPooledObject*, PooledObject);
 
 /**
@@ -4,6 +4,7 @@
 
 #include "ProjectReplica.h"
 #include "Engine/GameInstance.h"
+#include "Common/PRDamageFormula.h"
 #include "ProjectReplicaGameInstance.generated.h"
 
 class APRBaseCharacter;
@@ -93,4 +94,31 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "CharacterStat")
 	TMap<TSubclassOf<class APRBaseCharacter>, FPRLevelToCharacterStat> GetCharacterStatSettings() const;
 #pragma endregion 
+
+#pragma region DamageFormula
+public:
+	/**
+	 * 대미지 유형에 해당하는 컴파일한 대미지 공식을 반환하는 함수입니다.
+	 * 데이터 테이블에 해당하는 공식이 없을 경우 기본 대미지 공식을 반환합니다.
+	 *
+	 * @param DamageType 대미지 유형입니다.
+	 * @return 컴파일한 대미지 공식입니다.
+	 */
+	const FPRDamageFormula& GetDamageFormula(EPRDamageType DamageType) const;
+
+private:
+	/** DamageFormulaDataTable의 대미지 공식을 컴파일하여 DamageFormulas를 초기화하는 함수입니다. */
+	void InitializeDamageFormulas();
+
+private:
+	/** 대미지 유형별 대미지 공식을 가진 데이터 테이블입니다. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "DamageFormula", meta = (AllowPrivateAccess = "true"))
+	TObjectPtr<UDataTable> DamageFormulaDataTable;
+
+	/** 대미지 유형별로 컴파일한 대미지 공식을 보관한 Map입니다. */
+	TMap<EPRDamageType, FPRDamageFormula> DamageFormulas;
+
+	/** 데이터 테이블에 공식이 없는 대미지 유형에 사용하는 기본 대미지 공식입니다. */
+	FPRDamageFormula DefaultDamageFormula;
+#pragma endregion
 };
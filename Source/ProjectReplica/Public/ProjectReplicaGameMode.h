@@ -5,11 +5,43 @@
 #include "ProjectReplica.h"
 #include "GameFramework/GameModeBase.h"
 #include "Objects/PRPooledObject.h"
+#include "UObject/ObjectKey.h"
 #include "ProjectReplicaGameMode.generated.h"
 
 class UPRObjectPoolSystemComponent;
 class APRDamageAmount;
 
+/**
+ * 같은 대상이 짧은 시간 동안 받은 대미지를 하나의 DamageAmount로 합산하기 위한 정보입니다.
+ */
+struct FPRDamageAmountAggregate
+{
+public:
+	FPRDamageAmountAggregate()
+		: DamageAmountObject(nullptr)
+		, TotalDamage(0.0f)
+		, bIsCritical(false)
+		, HitCount(0)
+		, StartTime(0.0f)
+	{}
+
+public:
+	/** 합산한 대미지를 표시하는 DamageAmount입니다. */
+	TWeakObjectPtr<APRDamageAmount> DamageAmountObject;
+
+	/** 합산한 대미지의 양입니다. */
+	float TotalDamage;
+
+	/** 합산한 대미지 중 치명타가 있는지 나타내는 변수입니다. */
+	bool bIsCritical;
+
+	/** 합산한 대미지의 수입니다. */
+	int32 HitCount;
+
+	/** 합산을 시작한 시간입니다. */
+	float StartTime;
+};
+
 UCLASS(minimalapi)
 class AProjectReplicaGameMode : public AGameModeBase
 {
@@ -47,10 +79,39 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "DamageAmount")
 	class APRDamageAmount* ActivateDamageAmount(FVector SpawnLocation, float DamageAmount, bool bIsCritical, EPRElementType ElementType);
 
+	/**
+	 * 대상이 받은 대미지를 표시하는 함수입니다.
+	 * 같은 대상이 DamageAmountAggregationWindow 안에 같은 속성의 대미지를 받으면 새로운 DamageAmount를 활성화하지 않고
+	 * 이미 표시 중인 DamageAmount에 대미지를 합산하여 표시합니다.
+	 * 
+	 * @param Target 대미지를 받은 대상
+	 * @param SpawnLocation Spawn할 위치
+	 * @param DamageAmount 대미지의 양
+	 * @param bIsCritical 일반 대미지인지, 치명타 대미지인지 판별하는 인자
+	 * @param ElementType 대미지의 속성
+	 * @return 대미지를 표시하는 DamageAmount
+	 */
+	UFUNCTION(BlueprintCallable, Category = "DamageAmount")
+	class APRDamageAmount* ShowDamageAmount(AActor* Target, FVector SpawnLocation, float DamageAmount, bool bIsCritical, EPRElementType ElementType);
+
+private:
+	/** 합산 시간이 지난 대미지 합산 정보를 제거하는 함수입니다. */
+	void PurgeExpiredDamageAmountAggregates(float CurrentTime);
+	
 private:
 	/** DamageAmount의 클래스 레퍼런스입니다. */
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "DamageAmount", meta = (AllowPrivateAccess = "true"))
 	TSubclassOf<APRPooledObject> DamageAmountClass;
+
+	/** 같은 대상의 대미지를 하나의 DamageAmount로 합산하는 시간(초)입니다. 0일 경우 대미지마다 DamageAmount를 활성화합니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "DamageAmount", meta = (AllowPrivateAccess = "true", ClampMin = "0.0"))
+	float DamageAmountAggregationWindow;
+
+	/** 대상과 속성별 대미지 합산 정보입니다. */
+	TMap<TTuple<FObjectKey, EPRElementType>, FPRDamageAmountAggregate> DamageAmountAggregates;
+
+	/** DamageAmountAggregates에서 합산 시간이 지난 항목을 정리할 크기입니다. */
+	int32 DamageAmountAggregatesPurgeThreshold;
 #pragma endregion 
 };
 
@@ -0,0 +1,293 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "ProjectReplica.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "PRAsyncTraceSubsystem.generated.h"
+
+/** 비동기 Trace를 요청하는 기능을 나타내는 열거형입니다. 기능별로 우선순위와 프레임당 예산을 설정합니다. */
+UENUM(BlueprintType)
+enum class EPRAsyncTraceFeature : uint8
+{
+	AsyncTraceFeature_Vault			UMETA(DisplayName = "Vault"),				// 장애물 뛰어넘기
+	AsyncTraceFeature_Footsteps		UMETA(DisplayName = "Footsteps"),			// 발소리
+	AsyncTraceFeature_Projectile	UMETA(DisplayName = "Projectile"),			// 발사체와 월드 지형의 충돌
+	AsyncTraceFeature_Count			UMETA(Hidden)
+};
+
+/**
+ * 비동기 Trace 요청의 정보입니다.
+ * Radius가 0일 경우 LineTrace를, 0보다 클 경우 SphereTrace를 실행합니다.
+ */
+struct FPRAsyncTraceRequest
+{
+public:
+	FPRAsyncTraceRequest()
+		: Start(FVector::ZeroVector)
+		, End(FVector::ZeroVector)
+		, Radius(0.0f)
+		, TraceChannel(ECC_Visibility)
+		, IgnoreActor(nullptr)
+		, bTraceComplex(false)
+		, bReturnPhysicalMaterial(false)
+		, bDrawDebug(false)
+	{}
+
+	FPRAsyncTraceRequest(const FVector& NewStart, const FVector& NewEnd, float NewRadius, const AActor* NewIgnoreActor,
+						bool bNewTraceComplex = false, bool bNewReturnPhysicalMaterial = false, bool bNewDrawDebug = false)
+		: Start(NewStart)
+		, End(NewEnd)
+		, Radius(NewRadius)
+		, TraceChannel(ECC_Visibility)
+		, IgnoreActor(NewIgnoreActor)
+		, bTraceComplex(bNewTraceComplex)
+		, bReturnPhysicalMaterial(bNewReturnPhysicalMaterial)
+		, bDrawDebug(bNewDrawDebug)
+	{}
+
+public:
+	/** Trace의 시작 위치입니다. */
+	FVector Start;
+
+	/** Trace의 끝 위치입니다. */
+	FVector End;
+
+	/** SphereTrace의 반지름입니다. 0일 경우 LineTrace를 실행합니다. */
+	float Radius;
+
+	/** Trace의 충돌 채널입니다. */
+	TEnumAsByte<ECollisionChannel> TraceChannel;
+
+	/** Trace에서 제외할 액터입니다. */
+	TWeakObjectPtr<const AActor> IgnoreActor;
+
+	/** 복잡한 충돌 형태에 Trace할지 나타내는 변수입니다. */
+	bool bTraceComplex;
+
+	/** 충돌한 표면의 피직스 머테리얼을 반환할지 나타내는 변수입니다. */
+	bool bReturnPhysicalMaterial;
+
+	/** Trace의 결과를 디버그로 그릴지 나타내는 변수입니다. */
+	bool bDrawDebug;
+};
+
+/**
+ * 비동기 Trace 묶음의 결과를 받는 델리게이트입니다.
+ * 결과는 요청한 순서대로 전달하며, 충돌하지 않은 Trace의 결과는 bBlockingHit이 false이고 TraceStart와 TraceEnd만 설정되어 있습니다.
+ */
+DECLARE_DELEGATE_OneParam(FPRAsyncTraceBatchDelegate, TConstArrayView<FHitResult>);
+
+/**
+ * 기능별 비동기 Trace의 우선순위와 예산입니다.
+ */
+USTRUCT(Atomic, BlueprintType)
+struct FPRAsyncTraceFeatureSettings
+{
+	GENERATED_BODY()
+
+public:
+	FPRAsyncTraceFeatureSettings()
+		: Priority(0)
+		, MaxTracesPerFrame(16)
+	{}
+
+	FPRAsyncTraceFeatureSettings(int32 NewPriority, int32 NewMaxTracesPerFrame)
+		: Priority(NewPriority)
+		, MaxTracesPerFrame(NewMaxTracesPerFrame)
+	{}
+
+public:
+	/** 우선순위입니다. 값이 클수록 먼저 제출합니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PRAsyncTraceFeatureSettings")
+	int32 Priority;
+
+	/** 한 프레임에 제출할 수 있는 최대 Trace의 수입니다. 초과한 묶음은 다음 프레임에 제출하고, 예산보다 큰 묶음은 나누어서 제출합니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PRAsyncTraceFeatureSettings", meta = (ClampMin = "1"))
+	int32 MaxTracesPerFrame;
+};
+
+/**
+ * 비동기 Trace의 처리 통계입니다.
+ */
+USTRUCT(Atomic, BlueprintType)
+struct FPRAsyncTraceStats
+{
+	GENERATED_BODY()
+
+public:
+	FPRAsyncTraceStats()
+		: SubmittedBatches(0)
+		, SubmittedTraces(0)
+		, CompletedBatches(0)
+		, DeferredBatches(0)
+		, SplitBatches(0)
+		, PeakTracesPerFrame(0)
+	{}
+
+public:
+	/** 제출한 Trace 묶음의 수입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRAsyncTraceStats")
+	int32 SubmittedBatches;
+
+	/** 제출한 Trace의 수입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRAsyncTraceStats")
+	int32 SubmittedTraces;
+
+	/** 결과를 전달한 Trace 묶음의 수입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRAsyncTraceStats")
+	int32 CompletedBatches;
+
+	/** 예산을 초과하여 다음 프레임으로 미룬 Trace 묶음의 수입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRAsyncTraceStats")
+	int32 DeferredBatches;
+
+	/** 예산보다 커서 여러 프레임에 나누어 제출한 Trace 묶음의 수입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRAsyncTraceStats")
+	int32 SplitBatches;
+
+	/** 한 프레임에 제출한 Trace 수의 최댓값입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRAsyncTraceStats")
+	int32 PeakTracesPerFrame;
+};
+
+/**
+ * 게임 스레드에서 동기 Trace를 실행하는 대신 엔진의 비동기 Trace로 Trace를 모아서 실행하는 WorldSubsystem 클래스입니다.
+ * 한 프레임 동안 요청한 Trace 묶음은 액터의 Tick이 끝난 후 기능별 우선순위와 예산에 따라 제출하고,
+ * 결과는 다음 프레임에 묶음 단위로 한 번에 전달합니다.
+ */
+UCLASS()
+class PROJECTREPLICA_API UPRAsyncTraceSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	UPRAsyncTraceSubsystem();
+
+public:
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+public:
+	/**
+	 * 비동기 Trace 묶음을 요청하는 함수입니다.
+	 * 묶음의 모든 Trace는 같은 프레임에 제출하며, 모든 결과가 도착하면 OnCompleted를 한 번 호출합니다.
+	 * 기능의 예산보다 큰 묶음은 예산만큼 나누어 여러 프레임에 제출합니다.
+	 * OnCompleted는 요청한 객체가 소멸된 경우 호출되지 않도록 CreateUObject 또는 CreateWeakLambda로 바인딩합니다.
+	 *
+	 * @param Feature Trace를 요청하는 기능입니다.
+	 * @param Requests 요청할 Trace입니다.
+	 * @param OnCompleted 결과를 전달받을 델리게이트입니다.
+	 * @return 요청한 Trace 묶음의 ID입니다. 요청한 Trace가 없을 경우 INDEX_NONE을 반환합니다.
+	 */
+	int32 RequestTraceBatch(EPRAsyncTraceFeature Feature, TArray<FPRAsyncTraceRequest>&& Requests, FPRAsyncTraceBatchDelegate&& OnCompleted);
+
+	/**
+	 * 비동기 Trace를 하나 요청하는 함수입니다.
+	 *
+	 * @param Feature Trace를 요청하는 기능입니다.
+	 * @param Request 요청할 Trace입니다.
+	 * @param OnCompleted 결과를 전달받을 델리게이트입니다.
+	 * @return 요청한 Trace 묶음의 ID입니다.
+	 */
+	int32 RequestTrace(EPRAsyncTraceFeature Feature, const FPRAsyncTraceRequest& Request, FPRAsyncTraceBatchDelegate&& OnCompleted);
+
+	/**
+	 * 요청한 Trace 묶음을 취소하는 함수입니다. 이미 제출한 Trace의 결과는 무시합니다.
+	 *
+	 * @param BatchID 취소할 Trace 묶음의 ID입니다.
+	 */
+	void CancelTraceBatch(int32 BatchID);
+
+	/** 기능의 우선순위와 예산을 설정하는 함수입니다. */
+	UFUNCTION(BlueprintCallable, Category = "PRAsyncTrace")
+	void SetFeatureSettings(EPRAsyncTraceFeature Feature, const FPRAsyncTraceFeatureSettings& NewSettings);
+
+	/** 기능의 우선순위와 예산을 반환하는 함수입니다. */
+	UFUNCTION(BlueprintCallable, Category = "PRAsyncTrace")
+	FPRAsyncTraceFeatureSettings GetFeatureSettings(EPRAsyncTraceFeature Feature) const;
+
+	/** 제출을 기다리는 Trace 묶음의 수를 반환하는 함수입니다. */
+	UFUNCTION(BlueprintCallable, Category = "PRAsyncTrace")
+	FORCEINLINE int32 GetPendingTraceBatchCount() const { return PendingBatchIDs.Num(); }
+
+	/** 비동기 Trace의 처리 통계를 반환하는 함수입니다. */
+	UFUNCTION(BlueprintCallable, Category = "PRAsyncTrace")
+	FORCEINLINE FPRAsyncTraceStats GetAsyncTraceStats() const { return AsyncTraceStats; }
+
+	/** 비동기 Trace의 처리 통계를 초기화하는 함수입니다. */
+	UFUNCTION(BlueprintCallable, Category = "PRAsyncTrace")
+	void ResetAsyncTraceStats();
+
+private:
+	/** 비동기 Trace 묶음입니다. */
+	struct FPRAsyncTraceBatch
+	{
+	public:
+		FPRAsyncTraceBatch()
+			: Feature(EPRAsyncTraceFeature::AsyncTraceFeature_Vault)
+			, SubmittedTraces(0)
+			, RemainingTraces(0)
+		{}
+
+	public:
+		/** Trace를 요청한 기능입니다. */
+		EPRAsyncTraceFeature Feature;
+
+		/** 요청한 Trace입니다. */
+		TArray<FPRAsyncTraceRequest> Requests;
+
+		/** Trace의 결과입니다. 요청한 순서와 같습니다. */
+		TArray<FHitResult> Results;
+
+		/** 제출한 Trace의 수입니다. 예산보다 큰 묶음은 요청한 순서대로 나누어 제출합니다. */
+		int32 SubmittedTraces;
+
+		/** 결과가 도착하지 않은 Trace의 수입니다. */
+		int32 RemainingTraces;
+
+		/** 결과를 전달받을 델리게이트입니다. */
+		FPRAsyncTraceBatchDelegate OnCompleted;
+	};
+
+	/** 제출을 기다리는 Trace 묶음을 기능별 우선순위와 예산에 따라 제출하는 함수입니다. */
+	void SubmitPendingTraceBatches();
+
+	/**
+	 * Trace 묶음에서 아직 제출하지 않은 Trace를 엔진의 비동기 Trace로 제출하는 함수입니다.
+	 *
+	 * @param BatchID 제출할 Trace 묶음의 ID입니다.
+	 * @param Batch 제출할 Trace 묶음입니다.
+	 * @param MaxTraces 제출할 최대 Trace의 수입니다.
+	 * @return 제출한 Trace의 수입니다.
+	 */
+	int32 SubmitTraceBatch(int32 BatchID, FPRAsyncTraceBatch& Batch, int32 MaxTraces);
+
+	/**
+	 * 엔진의 비동기 Trace가 완료됐을 때 호출되는 함수입니다.
+	 *
+	 * @param TraceHandle 완료된 Trace의 Handle입니다.
+	 * @param TraceDatum 완료된 Trace의 정보입니다. UserData는 묶음에서 Trace의 Index입니다.
+	 * @param BatchID Trace가 속한 묶음의 ID입니다.
+	 */
+	void OnAsyncTraceCompleted(const FTraceHandle& TraceHandle, FTraceDatum& TraceDatum, int32 BatchID);
+
+private:
+	/** 기능별 우선순위와 예산입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRAsyncTrace", meta = (AllowPrivateAccess = "true"))
+	TMap<EPRAsyncTraceFeature, FPRAsyncTraceFeatureSettings> FeatureSettings;
+
+	/** 요청한 Trace 묶음입니다. 결과를 전달하면 제거합니다. */
+	TMap<int32, FPRAsyncTraceBatch> TraceBatches;
+
+	/** 제출을 기다리는 Trace 묶음의 ID입니다. 요청한 순서입니다. */
+	TArray<int32> PendingBatchIDs;
+
+	/** 다음에 요청할 Trace 묶음의 ID입니다. */
+	int32 NextBatchID;
+
+	/** 비동기 Trace의 처리 통계입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRAsyncTrace", meta = (AllowPrivateAccess = "true"))
+	FPRAsyncTraceStats AsyncTraceStats;
+};
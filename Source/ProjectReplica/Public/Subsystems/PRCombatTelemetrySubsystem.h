@@ -0,0 +1,118 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "ProjectReplica.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "Common/PRCombatTelemetry.h"
+#include "PRCombatTelemetrySubsystem.generated.h"
+
+struct FPRDamageEventQueue;
+
+/**
+ * 처리한 대미지 이벤트를 전투 텔레메트리 파일에 기록하는 GameInstanceSubsystem 클래스입니다.
+ * 게임 스레드는 미리 할당한 Lock-free 링 버퍼에 기록만 추가하고, 파일 기록은 백그라운드 스레드에서 실행하므로
+ * 장시간 실행하는 Soak 테스트에서도 PR_LOG보다 적은 비용으로 전투 처리량과 밸런스를 분석할 수 있습니다.
+ * 명령줄에 -PRCombatTelemetry를 추가하면 게임을 시작할 때 기록을 시작합니다.
+ */
+UCLASS()
+class PROJECTREPLICA_API UPRCombatTelemetrySubsystem : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	UPRCombatTelemetrySubsystem();
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+public:
+	/**
+	 * 전투 텔레메트리의 기록을 시작하는 함수입니다.
+	 *
+	 * @param FilePath 기록을 저장할 파일의 경로입니다. 비어있을 경우 Saved/Profiling/CombatTelemetry 폴더에 저장합니다.
+	 * @return 기록을 시작했을 경우 true를 반환합니다.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "PRCombatTelemetry")
+	bool StartRecording(const FString& FilePath);
+
+	/** 남은 기록을 모두 파일에 저장하고 전투 텔레메트리의 기록을 종료하는 함수입니다. */
+	UFUNCTION(BlueprintCallable, Category = "PRCombatTelemetry")
+	void StopRecording();
+
+	/** 전투 텔레메트리를 기록하고 있는지 반환하는 함수입니다. */
+	UFUNCTION(BlueprintCallable, Category = "PRCombatTelemetry")
+	FORCEINLINE bool IsRecording() const { return RingBuffer.IsValid(); }
+
+	/**
+	 * 대미지 큐에서 처리한 대미지 이벤트를 기록하는 함수입니다. 메모리를 할당하지 않습니다.
+	 *
+	 * @param DamageQueue 대미지 이벤트가 있는 대미지 큐입니다.
+	 * @param EventIndex 기록할 대미지 이벤트의 Index입니다.
+	 * @param bApplied 대상이 대미지에 반응했는지 나타내는 인자입니다.
+	 */
+	void RecordDamageEvent(const FPRDamageEventQueue& DamageQueue, int32 EventIndex, bool bApplied);
+
+	/**
+	 * 대미지 큐를 거치지 않고 처리한 대미지를 기록하는 함수입니다. 메모리를 할당하지 않습니다.
+	 *
+	 * @param Attacker 대미지를 준 액터입니다. 알 수 없을 경우 nullptr입니다.
+	 * @param Target 대미지를 받은 대상입니다.
+	 * @param DamageInfo 대미지의 정보입니다.
+	 * @param bApplied 대상이 대미지에 반응했는지 나타내는 인자입니다.
+	 */
+	void RecordDamage(const AActor* Attacker, const UObject* Target, const FPRDamageInfo& DamageInfo, bool bApplied);
+
+	/**
+	 * 주어진 오브젝트의 GameInstance에서 기록 중인 전투 텔레메트리를 반환하는 함수입니다.
+	 *
+	 * @param WorldContextObject GameInstance를 찾을 오브젝트입니다.
+	 * @return 기록 중인 전투 텔레메트리입니다. 기록하지 않을 경우 nullptr을 반환합니다.
+	 */
+	static UPRCombatTelemetrySubsystem* GetRecording(const UObject* WorldContextObject);
+
+	/**
+	 * 전투 텔레메트리 파일을 CSV 파일로 변환하는 함수입니다.
+	 *
+	 * @param TelemetryFilePath 변환할 전투 텔레메트리 파일의 경로입니다.
+	 * @param CSVFilePath 저장할 CSV 파일의 경로입니다. 비어있을 경우 전투 텔레메트리 파일의 확장자를 csv로 바꾼 경로에 저장합니다.
+	 * @return 변환에 성공했을 경우 true를 반환합니다.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "PRCombatTelemetry")
+	static bool ConvertToCSV(const FString& TelemetryFilePath, const FString& CSVFilePath);
+
+	/** 링 버퍼에 추가한 기록의 수를 반환하는 함수입니다. */
+	UFUNCTION(BlueprintCallable, Category = "PRCombatTelemetry")
+	int64 GetRecordedCount() const;
+
+	/** 링 버퍼가 가득 차서 버린 기록의 수를 반환하는 함수입니다. */
+	UFUNCTION(BlueprintCallable, Category = "PRCombatTelemetry")
+	int64 GetDroppedCount() const;
+
+	/** 파일에 기록한 기록의 수를 반환하는 함수입니다. */
+	UFUNCTION(BlueprintCallable, Category = "PRCombatTelemetry")
+	int64 GetWrittenCount() const;
+
+private:
+	/** 기록을 링 버퍼에 추가하는 함수입니다. */
+	void PushRecord(const UObject* Attacker, const UObject* Target, float Amount, EPRElementType ElementType, EPRDamageResponse DamageResponse, bool bCritical, bool bApplied);
+
+private:
+	/** 링 버퍼에 보관할 수 있는 기록의 수입니다. Writer 스레드가 비우는 간격 동안 발생하는 대미지 이벤트보다 커야 합니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "PRCombatTelemetry", meta = (AllowPrivateAccess = "true", ClampMin = "2"))
+	int32 RingBufferCapacity;
+
+	/** Writer 스레드가 링 버퍼를 비우는 간격(초)입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "PRCombatTelemetry", meta = (AllowPrivateAccess = "true", ClampMin = "0.01"))
+	float FlushInterval;
+
+	/** 기록을 시작한 시간입니다. 기록의 Timestamp는 이 시간부터 계산합니다. */
+	double RecordingStartTime;
+
+	/** 기록을 보관하는 링 버퍼입니다. */
+	TUniquePtr<FPRCombatTelemetryRingBuffer> RingBuffer;
+
+	/** 링 버퍼의 기록을 파일에 기록하는 Writer입니다. */
+	TUniquePtr<FPRCombatTelemetryWriter> Writer;
+};
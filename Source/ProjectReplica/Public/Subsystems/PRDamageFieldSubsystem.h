@@ -0,0 +1,209 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "ProjectReplica.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Subsystems/PRDamageableSpatialHashSubsystem.h"
+#include "PRDamageFieldSubsystem.generated.h"
+
+/**
+ * 일정한 간격으로 영역 안의 대미지를 받을 수 있는 액터에게 대미지를 주는 지속 범위 공격 영역입니다.
+ * 액터 없이 데이터로만 보관합니다.
+ */
+struct FPRDamageField
+{
+public:
+	FPRDamageField()
+		: FieldID(INDEX_NONE)
+		, Instigator(nullptr)
+		, Center(FVector::ZeroVector)
+		, Radius(0.0f)
+		, Height(0.0f)
+		, DamageInterval(0.0f)
+		, NextDamageTime(0.0)
+		, ExpireTime(0.0)
+		, DamageInfo(FPRDamageInfo())
+		, bDrawDebug(false)
+	{}
+
+public:
+	/** 영역의 ID입니다. */
+	int32 FieldID;
+
+	/** 영역을 생성한 액터입니다. 영역은 이 액터에게 대미지를 주지 않습니다. */
+	TWeakObjectPtr<AActor> Instigator;
+
+	/** 영역 아랫면의 중심입니다. 보통 바닥의 위치입니다. */
+	FVector Center;
+
+	/** 영역의 반지름입니다. */
+	float Radius;
+
+	/** 영역의 높이입니다. 영역은 Center에서 위로 세운 원기둥이며, 대상은 수평 거리와 높이 범위로 검사합니다. */
+	float Height;
+
+	/** 대미지를 주는 간격(초)입니다. */
+	float DamageInterval;
+
+	/** 다음에 대미지를 줄 월드의 시간입니다. */
+	double NextDamageTime;
+
+	/** 영역이 사라질 월드의 시간입니다. 0 이하일 경우 제거할 때까지 유지합니다. */
+	double ExpireTime;
+
+	/** 영역이 주는 대미지의 정보입니다. ImpactLocation은 대상마다 설정합니다. */
+	FPRDamageInfo DamageInfo;
+
+	/** 대미지를 줄 때 영역을 그릴지 나타내는 변수입니다. */
+	bool bDrawDebug;
+};
+
+/**
+ * 지속 범위 공격 영역의 처리 통계를 나타내는 구조체입니다.
+ */
+USTRUCT(Atomic, BlueprintType)
+struct FPRDamageFieldStats
+{
+	GENERATED_BODY()
+
+public:
+	FPRDamageFieldStats()
+		: Passes(0)
+		, EvaluatedFields(0)
+		, DamagedTargets(0)
+		, PeakFields(0)
+		, LastPassTime(0.0)
+		, PeakPassTime(0.0)
+	{}
+
+public:
+	/** 영역을 처리한 횟수입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRDamageFieldStats")
+	int32 Passes;
+
+	/** 대미지를 주기 위해 검색한 영역의 수입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRDamageFieldStats")
+	int32 EvaluatedFields;
+
+	/** 대미지 큐에 추가한 대미지의 수입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRDamageFieldStats")
+	int32 DamagedTargets;
+
+	/** 동시에 존재한 영역 수의 최댓값입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRDamageFieldStats")
+	int32 PeakFields;
+
+	/** 마지막으로 영역을 처리한 시간(초)입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRDamageFieldStats")
+	double LastPassTime;
+
+	/** 영역을 한 번 처리한 시간(초)의 최댓값입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRDamageFieldStats")
+	double PeakPassTime;
+};
+
+/**
+ * 불타는 바닥, 속성 영역과 같은 지속 범위 공격 영역을 관리하는 WorldSubsystem 클래스입니다.
+ * 영역마다 액터를 Spawn하여 Overlap을 Tick하지 않고, 모든 영역을 하나의 배열에 보관하여 정해진 간격마다 한 번에 처리합니다.
+ * 대상은 대미지를 받을 수 있는 액터의 공간 해시로 검색하고, 대미지는 대미지 큐로 처리합니다.
+ * 영역의 이펙트는 영역을 생성한 쪽에서 Spawn합니다.
+ */
+UCLASS()
+class PROJECTREPLICA_API UPRDamageFieldSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	UPRDamageFieldSubsystem();
+
+public:
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+public:
+	/**
+	 * 지속 범위 공격 영역을 생성하는 함수입니다. 영역은 생성한 후 처음 처리할 때 첫 번째 대미지를 줍니다.
+	 *
+	 * @param Instigator 영역을 생성한 액터입니다.
+	 * @param Center 영역 아랫면의 중심입니다.
+	 * @param Radius 영역의 반지름입니다.
+	 * @param Height 영역의 높이입니다. 서 있는 캐릭터의 캡슐과 겹치도록 바닥에서 위로 검사합니다.
+	 * @param Duration 영역의 지속 시간(초)입니다. 0 이하일 경우 제거할 때까지 유지합니다.
+	 * @param DamageInterval 대미지를 주는 간격(초)입니다. 영역을 처리하는 간격보다 짧을 수 없습니다.
+	 * @param DamageInfo 영역이 주는 대미지의 정보입니다.
+	 * @param bDrawDebug 대미지를 줄 때 영역을 그릴지 나타내는 인자입니다.
+	 * @return 생성한 영역의 ID입니다.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "PRDamageField")
+	int32 SpawnDamageField(AActor* Instigator, const FVector& Center, float Radius, float Height, float Duration, float DamageInterval, const FPRDamageInfo& DamageInfo, bool bDrawDebug = false);
+
+	/**
+	 * 지속 범위 공격 영역을 제거하는 함수입니다.
+	 *
+	 * @param FieldID 제거할 영역의 ID입니다.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "PRDamageField")
+	void RemoveDamageField(int32 FieldID);
+
+	/**
+	 * 지속 범위 공격 영역을 이동하는 함수입니다.
+	 *
+	 * @param FieldID 이동할 영역의 ID입니다.
+	 * @param NewCenter 영역의 새로운 중심입니다.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "PRDamageField")
+	void SetDamageFieldCenter(int32 FieldID, const FVector& NewCenter);
+
+	/** 지속 범위 공격 영역이 존재하는지 반환하는 함수입니다. */
+	UFUNCTION(BlueprintCallable, Category = "PRDamageField")
+	FORCEINLINE bool IsValidDamageField(int32 FieldID) const { return FieldIndices.Contains(FieldID); }
+
+	/** 지속 범위 공격 영역의 수를 반환하는 함수입니다. */
+	UFUNCTION(BlueprintCallable, Category = "PRDamageField")
+	FORCEINLINE int32 GetDamageFieldCount() const { return DamageFields.Num(); }
+
+	/** 지속 범위 공격 영역의 처리 통계를 반환하는 함수입니다. */
+	UFUNCTION(BlueprintCallable, Category = "PRDamageField")
+	FORCEINLINE FPRDamageFieldStats GetDamageFieldStats() const { return DamageFieldStats; }
+
+	/** 지속 범위 공격 영역의 처리 통계를 초기화하는 함수입니다. */
+	UFUNCTION(BlueprintCallable, Category = "PRDamageField")
+	void ResetDamageFieldStats();
+
+private:
+	/** 대미지를 줄 시간이 된 영역의 대미지를 대미지 큐에 추가하고 사라질 시간이 된 영역을 제거하는 함수입니다. */
+	void EvaluateDamageFields();
+
+	/**
+	 * 주어진 Index의 영역을 제거하는 함수입니다. 마지막 영역을 제거한 위치로 옮깁니다.
+	 *
+	 * @param FieldIndex 제거할 영역의 Index입니다.
+	 */
+	void RemoveDamageFieldAt(int32 FieldIndex);
+
+private:
+	/** 영역을 처리하는 간격(초)입니다. 모든 영역의 대미지 간격은 이 간격 단위로 처리합니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "PRDamageField", meta = (AllowPrivateAccess = "true", ClampMin = "0.0"))
+	float EvaluationInterval;
+
+	/** 지속 범위 공격 영역의 처리 통계입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRDamageField", meta = (AllowPrivateAccess = "true"))
+	FPRDamageFieldStats DamageFieldStats;
+
+	/** 지속 범위 공격 영역입니다. 처리할 때 연속된 메모리를 순회하도록 제거할 때 마지막 영역을 옮깁니다. */
+	TArray<FPRDamageField> DamageFields;
+
+	/** ID별 영역의 Index입니다. */
+	TMap<int32, int32> FieldIndices;
+
+	/** 다음에 생성할 영역의 ID입니다. */
+	int32 NextFieldID;
+
+	/** 마지막으로 영역을 처리한 후 지난 시간(초)입니다. */
+	float TimeSinceLastEvaluation;
+
+	/** 공간 해시의 검색 결과를 담는 배열입니다. 처리할 때마다 재사용합니다. */
+	TArray<FPRDamageableQueryResult> QueryResults;
+};
@@ -0,0 +1,226 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "ProjectReplica.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "PRDamageQueueSubsystem.generated.h"
+
+/**
+ * FPRDamageInfo의 bool 변수를 하나의 바이트로 압축한 플래그입니다.
+ */
+enum class EPRDamageEventFlags : uint8
+{
+	None					= 0,
+	Critical				= 1 << 0,	// 치명타
+	DamageInvincible		= 1 << 1,	// 무적 상태에도 대미지를 입힘
+	CanBeBlocked			= 1 << 2,	// 방어 가능
+	CanBeParried			= 1 << 3,	// 패링 가능
+	ForceInterrupt			= 1 << 4	// 동작 강제 중단
+};
+ENUM_CLASS_FLAGS(EPRDamageEventFlags);
+
+/**
+ * 한 프레임 동안 발생한 대미지 이벤트를 변수별 배열(Struct of Arrays)로 보관하는 구조체입니다.
+ * 대미지 이벤트를 추가할 때 대상별로 번호를 부여하므로 처리할 때 정렬 없이 대상별로 묶을 수 있습니다.
+ */
+struct PROJECTREPLICA_API FPRDamageEventQueue
+{
+public:
+	/**
+	 * 대미지 이벤트를 추가하는 함수입니다.
+	 *
+	 * @param Instigator 대미지를 준 액터입니다.
+	 * @param Target 대미지를 받을 액터입니다.
+	 * @param DamageInfo 대미지의 정보입니다.
+	 * @return 추가한 대미지 이벤트의 Index입니다.
+	 */
+	int32 Add(AActor* Instigator, AActor* Target, const FPRDamageInfo& DamageInfo);
+
+	/** 보관한 대미지 이벤트를 모두 제거하는 함수입니다. 배열의 메모리는 다음 프레임에 재사용하기 위해 유지합니다. */
+	void Reset();
+
+	/**
+	 * 주어진 Index의 대미지 이벤트를 FPRDamageInfo로 변환하여 반환하는 함수입니다.
+	 *
+	 * @param EventIndex 변환할 대미지 이벤트의 Index입니다.
+	 * @return 대미지 이벤트의 정보입니다.
+	 */
+	FPRDamageInfo GetDamageInfo(int32 EventIndex) const;
+
+	/** 주어진 Index의 대미지 이벤트가 플래그를 가지고 있는지 확인하는 함수입니다. */
+	FORCEINLINE bool HasFlag(int32 EventIndex, EPRDamageEventFlags Flag) const { return EnumHasAnyFlags(Flags[EventIndex], Flag); }
+
+	/** 보관한 대미지 이벤트의 수를 반환하는 함수입니다. */
+	FORCEINLINE int32 Num() const { return Amounts.Num(); }
+
+	/** 대미지를 받을 대상의 수를 반환하는 함수입니다. */
+	FORCEINLINE int32 NumTargets() const { return Targets.Num(); }
+
+public:
+	/** 대미지를 받을 대상입니다. 대상별로 하나씩 보관합니다. */
+	TArray<TWeakObjectPtr<AActor>> Targets;
+
+	/** 대미지 이벤트별 대상의 Index입니다. */
+	TArray<int32> TargetIndices;
+
+	/** 대미지 이벤트별 대미지를 준 액터입니다. */
+	TArray<TWeakObjectPtr<AActor>> Instigators;
+
+	/** 대미지 이벤트별 대미지 양입니다. */
+	TArray<float> Amounts;
+
+	/** 대미지 이벤트별 대미지를 받은 위치입니다. */
+	TArray<FVector> ImpactLocations;
+
+	/** 대미지 이벤트별 대미지 유형입니다. */
+	TArray<EPRDamageType> DamageTypes;
+
+	/** 대미지 이벤트별 대미지 속성입니다. */
+	TArray<EPRElementType> ElementTypes;
+
+	/** 대미지 이벤트별 대미지에 대한 반응입니다. */
+	TArray<EPRDamageResponse> DamageResponses;
+
+	/** 대미지 이벤트별 플래그입니다. */
+	TArray<EPRDamageEventFlags> Flags;
+
+private:
+	/** 대상별 Index입니다. */
+	TMap<FObjectKey, int32> TargetIndexMap;
+};
+
+/**
+ * 대미지 큐의 처리 통계를 나타내는 구조체입니다.
+ */
+USTRUCT(Atomic, BlueprintType)
+struct FPRDamageQueueStats
+{
+	GENERATED_BODY()
+
+public:
+	FPRDamageQueueStats()
+		: ResolvedFrames(0)
+		, ResolvedEvents(0)
+		, ResolvedTargets(0)
+		, AppliedEvents(0)
+		, PeakEventsPerFrame(0)
+		, LastResolveTime(0.0)
+		, PeakResolveTime(0.0)
+		, TotalResolveTime(0.0)
+	{}
+
+public:
+	/** 대미지 이벤트를 처리한 프레임의 수입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRDamageQueueStats")
+	int32 ResolvedFrames;
+
+	/** 처리한 대미지 이벤트의 수입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRDamageQueueStats")
+	int32 ResolvedEvents;
+
+	/** 대미지 이벤트를 처리한 대상의 수입니다. 대상별로 능력치와 상태를 한 번씩 읽습니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRDamageQueueStats")
+	int32 ResolvedTargets;
+
+	/** 대상이 대미지에 반응한 대미지 이벤트의 수입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRDamageQueueStats")
+	int32 AppliedEvents;
+
+	/** 한 프레임에 처리한 대미지 이벤트 수의 최댓값입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRDamageQueueStats")
+	int32 PeakEventsPerFrame;
+
+	/** 마지막 프레임에 대미지 큐를 처리한 시간(초)입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRDamageQueueStats")
+	double LastResolveTime;
+
+	/** 한 프레임에 대미지 큐를 처리한 시간(초)의 최댓값입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRDamageQueueStats")
+	double PeakResolveTime;
+
+	/** 대미지 큐를 처리한 전체 시간(초)입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRDamageQueueStats")
+	double TotalResolveTime;
+};
+
+/**
+ * 한 프레임 동안 발생한 대미지를 모아서 처리하는 WorldSubsystem 클래스입니다.
+ * 액터의 Tick이 끝난 후 대미지 큐를 대상별로 묶어서 한 번에 처리하므로
+ * 대상의 능력치와 상태는 프레임마다 한 번씩만 읽습니다.
+ */
+UCLASS()
+class PROJECTREPLICA_API UPRDamageQueueSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	UPRDamageQueueSubsystem();
+
+public:
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+public:
+	/**
+	 * 대미지를 대미지 큐에 추가하는 함수입니다. 추가한 대미지는 이번 프레임의 액터 Tick이 끝난 후 처리합니다.
+	 *
+	 * @param Instigator 대미지를 준 액터입니다.
+	 * @param Target 대미지를 받을 액터입니다. PRDamageableInterface를 구현해야 합니다.
+	 * @param DamageInfo 대미지의 정보입니다.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "PRDamageQueue")
+	void QueueDamage(AActor* Instigator, AActor* Target, const FPRDamageInfo& DamageInfo);
+
+	/** 대미지 큐에 추가된 대미지를 대상별로 묶어서 처리하는 함수입니다. */
+	UFUNCTION(BlueprintCallable, Category = "PRDamageQueue")
+	void ResolveDamageQueue();
+
+	/** 처리를 기다리는 대미지 이벤트의 수를 반환하는 함수입니다. */
+	UFUNCTION(BlueprintCallable, Category = "PRDamageQueue")
+	FORCEINLINE int32 GetPendingDamageEventCount() const { return PendingQueue.Num(); }
+
+	/** 대미지 큐의 처리 통계를 반환하는 함수입니다. */
+	UFUNCTION(BlueprintCallable, Category = "PRDamageQueue")
+	FORCEINLINE FPRDamageQueueStats GetDamageQueueStats() const { return DamageQueueStats; }
+
+	/** 대미지 큐의 처리 통계를 초기화하는 함수입니다. */
+	UFUNCTION(BlueprintCallable, Category = "PRDamageQueue")
+	void ResetDamageQueueStats();
+
+private:
+	/**
+	 * 한 대상의 대미지 이벤트를 처리하는 함수입니다.
+	 * PRBaseCharacter는 DamageSystem에서 한 번에 처리하고, 그 외의 대상은 대미지 이벤트마다 TakeDamage를 실행합니다.
+	 *
+	 * @param Target 대미지를 받을 대상입니다.
+	 * @param EventIndices 대상이 받을 대미지 이벤트의 Index입니다.
+	 * @param PRGameMode 대미지를 표시할 GameMode입니다.
+	 */
+	void ResolveTargetDamage(AActor* Target, TConstArrayView<int32> EventIndices, class AProjectReplicaGameMode* PRGameMode);
+
+private:
+	/** 처리를 기다리는 대미지 큐입니다. */
+	FPRDamageEventQueue PendingQueue;
+
+	/** 처리 중인 대미지 큐입니다. 처리 중에 추가된 대미지는 PendingQueue에 추가되어 다음 프레임에 처리합니다. */
+	FPRDamageEventQueue ResolvingQueue;
+
+	/** 대상별로 정렬한 대미지 이벤트의 Index입니다. */
+	TArray<int32> SortedEventIndices;
+
+	/** 대상별 대미지 이벤트의 시작 위치입니다. */
+	TArray<int32> TargetEventOffsets;
+
+	/** 대상별로 정렬할 때 다음 대미지 이벤트를 기록할 위치입니다. */
+	TArray<int32> TargetWriteOffsets;
+
+	/** 대상이 대미지에 반응한 대미지 이벤트입니다. */
+	TBitArray<> AppliedEvents;
+
+	/** 대미지 큐의 처리 통계입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRDamageQueue", meta = (AllowPrivateAccess = "true"))
+	FPRDamageQueueStats DamageQueueStats;
+};
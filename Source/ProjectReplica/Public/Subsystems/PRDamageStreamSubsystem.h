@@ -0,0 +1,266 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "ProjectReplica.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "PRDamageStreamSubsystem.generated.h"
+
+/**
+ * 기록한 대미지 호출 하나의 정보입니다.
+ */
+struct FPRDamageStreamEvent
+{
+public:
+	FPRDamageStreamEvent()
+		: Time(0.0)
+		, Target(NAME_None)
+		, Instigator(NAME_None)
+		, bQueued(false)
+		, DamageInfo(FPRDamageInfo())
+	{}
+
+public:
+	/** 기록을 시작한 후 대미지를 받은 시간(초)입니다. */
+	double Time;
+
+	/** 대미지를 받은 액터의 이름입니다. */
+	FName Target;
+
+	/** 대미지를 준 액터의 이름입니다. 대미지를 준 액터를 알 수 없을 경우 NAME_None입니다. */
+	FName Instigator;
+
+	/** 대미지 큐를 거쳐서 처리한 대미지인지 나타내는 변수입니다. */
+	bool bQueued;
+
+	/** 대미지의 정보입니다. */
+	FPRDamageInfo DamageInfo;
+};
+
+/**
+ * 대미지 스트림 재생의 벤치마크 결과입니다.
+ */
+USTRUCT(Atomic, BlueprintType)
+struct FPRDamageStreamReplayStats
+{
+	GENERATED_BODY()
+
+public:
+	FPRDamageStreamReplayStats()
+		: ReplayedEvents(0)
+		, MissingTargetEvents(0)
+		, Frames(0)
+		, ReplayTime(0.0)
+		, DispatchTime(0.0)
+		, AverageFrameTime(0.0)
+		, PeakFrameTime(0.0)
+	{}
+
+public:
+	/** 재생한 대미지 호출의 수입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRDamageStreamReplayStats")
+	int32 ReplayedEvents;
+
+	/** 대상을 월드에서 찾지 못하여 재생하지 못한 대미지 호출의 수입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRDamageStreamReplayStats")
+	int32 MissingTargetEvents;
+
+	/** 재생하는 동안 실행한 프레임의 수입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRDamageStreamReplayStats")
+	int32 Frames;
+
+	/** 재생에 걸린 시간(초)입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRDamageStreamReplayStats")
+	double ReplayTime;
+
+	/** 대미지 호출을 실행하는 데 걸린 시간(초)입니다. 대미지 큐를 거치는 대미지는 큐에 추가하는 시간만 포함합니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRDamageStreamReplayStats")
+	double DispatchTime;
+
+	/** 재생하는 동안의 평균 프레임 시간(초)입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRDamageStreamReplayStats")
+	double AverageFrameTime;
+
+	/** 재생하는 동안의 최대 프레임 시간(초)입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRDamageStreamReplayStats")
+	double PeakFrameTime;
+};
+
+/** 대미지 스트림의 재생이 끝났을 때 호출하는 델리게이트입니다. */
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnDamageStreamReplayFinished, const FPRDamageStreamReplayStats&);
+
+/**
+ * 대미지 큐에 추가하거나 PRDamageableInterface로 바로 처리한 대미지 호출을 순서대로 기록하고,
+ * 같은 대상이 배치된 맵에서 기록한 순서와 시간대로 재생하는 WorldSubsystem 클래스입니다.
+ * 입력과 관계없이 같은 부하를 반복할 수 있으므로 대미지, 대미지 숫자, 이펙트 처리의 성능을 측정하는 벤치마크로 사용합니다.
+ *
+ * 명령줄 인자
+ * -PRDamageStreamRecord=<File> 게임을 시작할 때 기록을 시작하고 월드가 종료될 때 파일에 저장합니다.
+ * -PRDamageStreamReplay=<File> 게임을 시작할 때 파일을 재생합니다.
+ * -PRDamageStreamReplayExit 재생이 끝나면 게임을 종료합니다. Headless로 벤치마크를 실행할 때 사용합니다.
+ */
+UCLASS()
+class PROJECTREPLICA_API UPRDamageStreamSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	UPRDamageStreamSubsystem();
+
+public:
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+#pragma region Record
+public:
+	/** 대미지 호출의 기록을 시작하는 함수입니다. 이전 기록은 제거합니다. */
+	UFUNCTION(BlueprintCallable, Category = "PRDamageStream")
+	void StartRecording();
+
+	/**
+	 * 대미지 호출의 기록을 종료하고 파일에 저장하는 함수입니다.
+	 *
+	 * @param FilePath 저장할 파일의 경로입니다.
+	 * @return 저장에 성공했을 경우 true를 반환합니다.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "PRDamageStream")
+	bool StopRecording(const FString& FilePath);
+
+	/**
+	 * 대미지 호출을 기록하는 함수입니다. 기록 중이 아니거나 재생 중인 경우 무시합니다.
+	 *
+	 * @param Target 대미지를 받은 액터입니다.
+	 * @param Instigator 대미지를 준 액터입니다.
+	 * @param DamageInfo 대미지의 정보입니다.
+	 * @param bQueued 대미지 큐를 거쳐서 처리한 대미지인지 나타내는 인자입니다.
+	 */
+	void CaptureDamage(const AActor* Target, const AActor* Instigator, const FPRDamageInfo& DamageInfo, bool bQueued);
+
+	/** 대미지 호출을 기록하고 있는지 반환하는 함수입니다. */
+	UFUNCTION(BlueprintCallable, Category = "PRDamageStream")
+	FORCEINLINE bool IsRecording() const { return bRecording; }
+
+	/**
+	 * 대미지 호출을 기록하는 함수입니다. 월드에 대미지 스트림 Subsystem이 없으면 무시합니다.
+	 * 대미지 호출마다 한 번만 기록하도록 UPRDamageQueueSubsystem::QueueDamage와 FPRDamageableDispatch::TakeDamage에서만 호출합니다.
+	 *
+	 * @param Target 대미지를 받은 액터입니다.
+	 * @param Instigator 대미지를 준 액터입니다.
+	 * @param DamageInfo 대미지의 정보입니다.
+	 * @param bQueued 대미지 큐를 거쳐서 처리한 대미지인지 나타내는 인자입니다.
+	 */
+	static void Capture(const AActor* Target, const AActor* Instigator, const FPRDamageInfo& DamageInfo, bool bQueued);
+
+private:
+	/** 기록 중인지 나타내는 변수입니다. */
+	bool bRecording;
+
+	/** 기록을 시작한 월드의 시간입니다. */
+	double RecordingStartTime;
+
+	/** 기록한 대미지 호출입니다. */
+	TArray<FPRDamageStreamEvent> RecordedEvents;
+
+	/** 명령줄로 시작한 기록을 저장할 파일의 경로입니다. */
+	FString AutoRecordFilePath;
+#pragma endregion
+
+#pragma region Replay
+public:
+	/**
+	 * 파일에 저장한 대미지 호출을 재생하는 함수입니다.
+	 * 대상은 이름으로 월드에서 찾으므로 기록한 맵과 같은 대상이 배치되어 있어야 합니다.
+	 *
+	 * @param FilePath 재생할 파일의 경로입니다.
+	 * @param PlaybackRate 재생 속도입니다. 1일 경우 기록한 시간대로 재생합니다.
+	 * @return 재생을 시작했을 경우 true를 반환합니다.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "PRDamageStream")
+	bool StartReplay(const FString& FilePath, float PlaybackRate = 1.0f);
+
+	/** 재생을 중단하는 함수입니다. */
+	UFUNCTION(BlueprintCallable, Category = "PRDamageStream")
+	void StopReplay();
+
+	/** 재생 중인지 반환하는 함수입니다. */
+	UFUNCTION(BlueprintCallable, Category = "PRDamageStream")
+	FORCEINLINE bool IsReplaying() const { return bReplaying; }
+
+	/** 마지막 재생의 벤치마크 결과를 반환하는 함수입니다. */
+	UFUNCTION(BlueprintCallable, Category = "PRDamageStream")
+	FORCEINLINE FPRDamageStreamReplayStats GetReplayStats() const { return ReplayStats; }
+
+public:
+	/** 재생이 끝났을 때 호출하는 델리게이트입니다. */
+	FOnDamageStreamReplayFinished OnReplayFinished;
+
+private:
+	/** 재생 시간이 된 대미지 호출을 실행하는 함수입니다. */
+	void DispatchReplayEvents();
+
+	/** 재생을 마치고 벤치마크 결과를 기록하는 함수입니다. */
+	void FinishReplay();
+
+private:
+	/** 재생 중인지 나타내는 변수입니다. */
+	bool bReplaying;
+
+	/** 재생 속도입니다. */
+	float ReplayPlaybackRate;
+
+	/** 재생을 시작한 월드의 시간입니다. */
+	double ReplayStartTime;
+
+	/** 재생을 시작한 실제 시간입니다. */
+	double ReplayStartPlatformTime;
+
+	/** 이전 프레임의 실제 시간입니다. */
+	double LastFramePlatformTime;
+
+	/** 재생할 대미지 호출입니다. */
+	TArray<FPRDamageStreamEvent> ReplayEvents;
+
+	/** 다음에 재생할 대미지 호출의 Index입니다. */
+	int32 NextReplayEventIndex;
+
+	/** 이름별 재생 대상입니다. 재생을 시작할 때 한 번만 찾습니다. */
+	TMap<FName, TWeakObjectPtr<AActor>> ReplayActors;
+
+	/** 재생이 끝나면 게임을 종료할지 나타내는 변수입니다. */
+	bool bExitWhenReplayFinished;
+
+	/** 마지막 재생의 벤치마크 결과입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRDamageStream", meta = (AllowPrivateAccess = "true"))
+	FPRDamageStreamReplayStats ReplayStats;
+#pragma endregion
+
+#pragma region File
+public:
+	/**
+	 * 대미지 호출을 파일에 저장하는 함수입니다.
+	 *
+	 * @param FilePath 저장할 파일의 경로입니다.
+	 * @param Events 저장할 대미지 호출입니다.
+	 * @return 저장에 성공했을 경우 true를 반환합니다.
+	 */
+	static bool SaveDamageStream(const FString& FilePath, TConstArrayView<FPRDamageStreamEvent> Events);
+
+	/**
+	 * 파일에 저장한 대미지 호출을 불러오는 함수입니다.
+	 *
+	 * @param FilePath 불러올 파일의 경로입니다.
+	 * @param OutEvents 불러온 대미지 호출입니다.
+	 * @return 불러오기에 성공했을 경우 true를 반환합니다.
+	 */
+	static bool LoadDamageStream(const FString& FilePath, TArray<FPRDamageStreamEvent>& OutEvents);
+
+private:
+	/** 파일의 시작을 나타내는 값입니다. 'PRDS' */
+	static constexpr uint32 DamageStreamFileMagic = 0x53445250;
+
+	/** 파일 형식의 버전입니다. */
+	static constexpr uint32 DamageStreamFileVersion = 1;
+#pragma endregion
+};
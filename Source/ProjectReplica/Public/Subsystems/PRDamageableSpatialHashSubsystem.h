@@ -0,0 +1,383 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "ProjectReplica.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "PRDamageableSpatialHashSubsystem.generated.h"
+
+/**
+ * 공간 해시의 셀에 보관한 대미지를 받을 수 있는 액터를 나타내는 구조체입니다.
+ */
+USTRUCT(BlueprintType)
+struct FPRDamageableCellEntry
+{
+	GENERATED_BODY()
+
+public:
+	FPRDamageableCellEntry()
+		: Actor(nullptr)
+		, Location(FVector::ZeroVector)
+		, Radius(0.0f)
+		, HalfHeight(0.0f)
+	{}
+
+	FPRDamageableCellEntry(AActor* NewActor, const FVector& NewLocation, float NewRadius, float NewHalfHeight)
+		: Actor(NewActor)
+		, Location(NewLocation)
+		, Radius(NewRadius)
+		, HalfHeight(FMath::Max(NewHalfHeight, NewRadius))
+	{}
+
+public:
+	/** 대미지를 받을 수 있는 액터입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRDamageableCellEntry")
+	TObjectPtr<AActor> Actor;
+
+	/** 마지막으로 이동했을 때 액터의 위치입니다. 검색할 때 액터에 접근하지 않도록 보관합니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRDamageableCellEntry")
+	FVector Location;
+
+	/** 액터의 충돌 반지름입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRDamageableCellEntry")
+	float Radius;
+
+	/** 액터의 충돌 영역의 절반 높이입니다. 충돌 영역은 Location을 중심으로 하는 세로 캡슐입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRDamageableCellEntry")
+	float HalfHeight;
+
+public:
+	/** 충돌 영역인 세로 캡슐의 중심선에서 주어진 위치와 가장 가까운 위치를 반환하는 함수입니다. */
+	FORCEINLINE FVector GetClosestAxisPoint(const FVector& Point) const
+	{
+		const float AxisHalfLength = HalfHeight - Radius;
+		return FVector(Location.X, Location.Y, FMath::Clamp(Point.Z, Location.Z - AxisHalfLength, Location.Z + AxisHalfLength));
+	}
+
+	/** 충돌 영역인 세로 캡슐의 중심선의 아래쪽 끝을 반환하는 함수입니다. */
+	FORCEINLINE FVector GetAxisBottom() const { return Location - FVector(0.0f, 0.0f, HalfHeight - Radius); }
+
+	/** 충돌 영역인 세로 캡슐의 중심선의 위쪽 끝을 반환하는 함수입니다. */
+	FORCEINLINE FVector GetAxisTop() const { return Location + FVector(0.0f, 0.0f, HalfHeight - Radius); }
+};
+
+/**
+ * 공간 해시의 셀을 나타내는 구조체입니다.
+ */
+USTRUCT(BlueprintType)
+struct FPRDamageableCell
+{
+	GENERATED_BODY()
+
+public:
+	/** 셀에 있는 대미지를 받을 수 있는 액터입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRDamageableCell")
+	TArray<FPRDamageableCellEntry> Entries;
+};
+
+/**
+ * 공간 해시의 검색 결과를 나타내는 구조체입니다.
+ */
+USTRUCT(BlueprintType)
+struct FPRDamageableQueryResult
+{
+	GENERATED_BODY()
+
+public:
+	FPRDamageableQueryResult()
+		: Actor(nullptr)
+		, ImpactPoint(FVector::ZeroVector)
+		, Distance(0.0f)
+	{}
+
+	FPRDamageableQueryResult(AActor* NewActor, const FVector& NewImpactPoint, float NewDistance)
+		: Actor(NewActor)
+		, ImpactPoint(NewImpactPoint)
+		, Distance(NewDistance)
+	{}
+
+public:
+	/** 검색한 액터입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRDamageableQueryResult")
+	TObjectPtr<AActor> Actor;
+
+	/** 검색 영역에서 가장 가까운 액터의 충돌 영역 위의 위치입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRDamageableQueryResult")
+	FVector ImpactPoint;
+
+	/** 검색 영역의 기준점에서 액터까지의 거리입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRDamageableQueryResult")
+	float Distance;
+};
+
+/**
+ * 공간 해시의 사용 통계를 나타내는 구조체입니다.
+ */
+USTRUCT(Atomic, BlueprintType)
+struct FPRDamageableSpatialHashStats
+{
+	GENERATED_BODY()
+
+public:
+	FPRDamageableSpatialHashStats()
+		: Queries(0)
+		, TestedEntries(0)
+		, FoundActors(0)
+		, CellMoves(0)
+		, TotalQueryTime(0.0)
+	{}
+
+public:
+	/** 검색한 횟수입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRDamageableSpatialHashStats")
+	int32 Queries;
+
+	/** 검색할 때 거리를 비교한 액터의 수입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRDamageableSpatialHashStats")
+	int32 TestedEntries;
+
+	/** 검색한 액터의 수입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRDamageableSpatialHashStats")
+	int32 FoundActors;
+
+	/** 액터가 이동하여 셀을 옮긴 횟수입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRDamageableSpatialHashStats")
+	int32 CellMoves;
+
+	/** 검색한 전체 시간(초)입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRDamageableSpatialHashStats")
+	double TotalQueryTime;
+};
+
+/**
+ * 공간 해시와 물리 Trace의 검색 시간을 비교한 결과를 나타내는 구조체입니다.
+ */
+USTRUCT(Atomic, BlueprintType)
+struct FPRDamageableQueryBenchmarkResult
+{
+	GENERATED_BODY()
+
+public:
+	FPRDamageableQueryBenchmarkResult()
+		: Iterations(0)
+		, SpatialHashTime(0.0)
+		, SpatialHashFoundActors(0)
+		, PhysicsTraceTime(0.0)
+		, PhysicsTraceFoundActors(0)
+	{}
+
+public:
+	/** 검색을 반복한 횟수입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRDamageableQueryBenchmarkResult")
+	int32 Iterations;
+
+	/** 공간 해시로 검색한 전체 시간(초)입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRDamageableQueryBenchmarkResult")
+	double SpatialHashTime;
+
+	/** 공간 해시로 한 번 검색한 액터의 수입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRDamageableQueryBenchmarkResult")
+	int32 SpatialHashFoundActors;
+
+	/** 물리 Trace로 검색하고 PRDamageableInterface로 거른 전체 시간(초)입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRDamageableQueryBenchmarkResult")
+	double PhysicsTraceTime;
+
+	/** 물리 Trace로 한 번 검색한 액터의 수입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRDamageableQueryBenchmarkResult")
+	int32 PhysicsTraceFoundActors;
+};
+
+/**
+ * PRDamageableInterface를 구현한 액터를 균일한 격자의 공간 해시로 관리하는 WorldSubsystem 클래스입니다.
+ * 액터가 Spawn되거나 액터가 있는 레벨이 스트리밍되면 등록하고, RootComponent가 이동할 때 셀이 바뀐 경우에만 셀을 옮깁니다.
+ * 액터의 충돌 영역은 충돌 반지름과 절반 높이로 만든 세로 캡슐로 검사합니다.
+ * 물리 Trace 없이 구, 캡슐, 원뿔 영역의 대미지를 받을 수 있는 액터를 바로 검색합니다.
+ */
+UCLASS()
+class PROJECTREPLICA_API UPRDamageableSpatialHashSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	UPRDamageableSpatialHashSubsystem();
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+
+public:
+	/**
+	 * 대미지를 받을 수 있는 액터를 공간 해시에 등록하는 함수입니다.
+	 * PRDamageableInterface를 구현하지 않았거나 이미 등록한 액터는 무시합니다.
+	 *
+	 * @param Actor 등록할 액터입니다.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "PRDamageableSpatialHash")
+	void RegisterDamageable(AActor* Actor);
+
+	/**
+	 * 액터를 공간 해시에서 제거하는 함수입니다.
+	 *
+	 * @param Actor 제거할 액터입니다.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "PRDamageableSpatialHash")
+	void UnregisterDamageable(AActor* Actor);
+
+	/**
+	 * 구 영역과 겹치는 대미지를 받을 수 있는 액터를 검색하는 함수입니다.
+	 *
+	 * @param Center 구의 중심입니다.
+	 * @param Radius 구의 반지름입니다.
+	 * @param IgnoreActor 검색에서 제외할 액터입니다.
+	 * @param OutResults 검색 결과를 추가할 배열입니다.
+	 * @return 검색한 액터의 수입니다.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "PRDamageableSpatialHash")
+	int32 QuerySphere(const FVector& Center, float Radius, AActor* IgnoreActor, TArray<FPRDamageableQueryResult>& OutResults);
+
+	/**
+	 * 세로 원기둥 영역과 겹치는 대미지를 받을 수 있는 액터를 검색하는 함수입니다.
+	 * 바닥에 생성하는 범위 공격처럼 수평 거리로 검사하는 영역에 사용합니다.
+	 *
+	 * @param Base 원기둥 아랫면의 중심입니다.
+	 * @param Radius 원기둥의 반지름입니다.
+	 * @param Height 원기둥의 높이입니다.
+	 * @param IgnoreActor 검색에서 제외할 액터입니다.
+	 * @param OutResults 검색 결과를 추가할 배열입니다.
+	 * @return 검색한 액터의 수입니다.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "PRDamageableSpatialHash")
+	int32 QueryCylinder(const FVector& Base, float Radius, float Height, AActor* IgnoreActor, TArray<FPRDamageableQueryResult>& OutResults);
+
+	/**
+	 * 캡슐 영역(Start에서 End까지 이동한 구)과 겹치는 대미지를 받을 수 있는 액터를 검색하는 함수입니다.
+	 *
+	 * @param Start 캡슐의 시작점입니다.
+	 * @param End 캡슐의 끝점입니다.
+	 * @param Radius 캡슐의 반지름입니다.
+	 * @param IgnoreActor 검색에서 제외할 액터입니다.
+	 * @param OutResults 검색 결과를 추가할 배열입니다. Start에서 가까운 순서로 정렬합니다.
+	 * @return 검색한 액터의 수입니다.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "PRDamageableSpatialHash")
+	int32 QueryCapsule(const FVector& Start, const FVector& End, float Radius, AActor* IgnoreActor, TArray<FPRDamageableQueryResult>& OutResults);
+
+	/**
+	 * 원뿔 영역과 겹치는 대미지를 받을 수 있는 액터를 검색하는 함수입니다.
+	 *
+	 * @param Origin 원뿔의 꼭짓점입니다.
+	 * @param Direction 원뿔의 방향입니다.
+	 * @param Length 원뿔의 길이입니다.
+	 * @param HalfAngle 원뿔의 중심축과 옆면 사이의 각도(도)입니다.
+	 * @param IgnoreActor 검색에서 제외할 액터입니다.
+	 * @param OutResults 검색 결과를 추가할 배열입니다.
+	 * @return 검색한 액터의 수입니다.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "PRDamageableSpatialHash")
+	int32 QueryCone(const FVector& Origin, const FVector& Direction, float Length, float HalfAngle, AActor* IgnoreActor, TArray<FPRDamageableQueryResult>& OutResults);
+
+	/**
+	 * 같은 구 영역을 공간 해시와 물리 Trace로 반복해서 검색하고 검색 시간을 비교하는 함수입니다.
+	 *
+	 * @param Center 구의 중심입니다.
+	 * @param Radius 구의 반지름입니다.
+	 * @param Iterations 검색을 반복할 횟수입니다.
+	 * @return 비교한 결과입니다.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "PRDamageableSpatialHash")
+	FPRDamageableQueryBenchmarkResult BenchmarkSphereQuery(const FVector& Center, float Radius, int32 Iterations = 1000);
+
+	/** 공간 해시의 사용 통계를 반환하는 함수입니다. */
+	UFUNCTION(BlueprintCallable, Category = "PRDamageableSpatialHash")
+	FORCEINLINE FPRDamageableSpatialHashStats GetSpatialHashStats() const { return SpatialHashStats; }
+
+	/** 공간 해시의 사용 통계를 초기화하는 함수입니다. */
+	UFUNCTION(BlueprintCallable, Category = "PRDamageableSpatialHash")
+	void ResetSpatialHashStats();
+
+	/** 등록한 액터의 수를 반환하는 함수입니다. */
+	UFUNCTION(BlueprintCallable, Category = "PRDamageableSpatialHash")
+	FORCEINLINE int32 GetDamageableCount() const { return Registrations.Num(); }
+
+private:
+	/**
+	 * 공간 해시에 등록한 액터의 정보를 나타내는 구조체입니다.
+	 */
+	struct FPRDamageableRegistration
+	{
+	public:
+		FPRDamageableRegistration()
+			: Cell(FIntPoint::ZeroValue)
+			, TransformUpdatedHandle()
+		{}
+
+	public:
+		/** 액터가 있는 셀입니다. */
+		FIntPoint Cell;
+
+		/** RootComponent의 이동 델리게이트 핸들입니다. */
+		FDelegateHandle TransformUpdatedHandle;
+	};
+
+	/** 위치에 해당하는 셀을 반환하는 함수입니다. */
+	FIntPoint GetCell(const FVector& Location) const;
+
+	/**
+	 * 주어진 영역의 경계 상자와 겹치는 셀의 액터에 대해 함수를 실행하는 함수입니다.
+	 *
+	 * @param Bounds 영역의 경계 상자입니다.
+	 * @param Function 셀의 액터마다 실행할 함수입니다.
+	 */
+	template<typename FunctionType>
+	void ForEachEntryInBounds(const FBox& Bounds, FunctionType&& Function);
+
+	/** 검색 결과를 사용할 수 있는 액터인지 확인하는 함수입니다. 사망하여 충돌을 비활성화한 액터는 제외합니다. */
+	static bool IsQueryableEntry(const FPRDamageableCellEntry& Entry, const AActor* IgnoreActor);
+
+	/** 월드에 액터가 Spawn될 때 호출되는 함수입니다. */
+	void OnActorSpawned(AActor* SpawnedActor);
+
+	/** 레벨이 월드에 추가될 때 호출되는 함수입니다. 스트리밍된 레벨의 액터를 등록합니다. */
+	void OnLevelAddedToWorld(ULevel* Level, UWorld* InWorld);
+
+	/** 레벨이 월드에서 제거될 때 호출되는 함수입니다. 스트리밍이 해제된 레벨의 액터를 제거합니다. */
+	void OnLevelRemovedFromWorld(ULevel* Level, UWorld* InWorld);
+
+	/** 등록한 액터의 RootComponent가 이동할 때 호출되는 함수입니다. */
+	void OnDamageableTransformUpdated(USceneComponent* UpdatedComponent, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport);
+
+	/** 등록한 액터가 소멸될 때 호출되는 함수입니다. */
+	UFUNCTION()
+	void OnDamageableDestroyed(AActor* DestroyedActor);
+
+private:
+	/** 셀의 크기입니다. 주로 검색하는 영역의 크기와 비슷하게 설정합니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "PRDamageableSpatialHash", meta = (AllowPrivateAccess = "true"))
+	float CellSize;
+
+	/** 셀별 대미지를 받을 수 있는 액터입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRDamageableSpatialHash", meta = (AllowPrivateAccess = "true"))
+	TMap<FIntPoint, FPRDamageableCell> Cells;
+
+	/** 공간 해시의 사용 통계입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRDamageableSpatialHash", meta = (AllowPrivateAccess = "true"))
+	FPRDamageableSpatialHashStats SpatialHashStats;
+
+	/** 액터별 등록 정보입니다. */
+	TMap<TObjectKey<AActor>, FPRDamageableRegistration> Registrations;
+
+	/** 셀의 액터 중 가장 큰 충돌 반지름입니다. 검색 영역을 이만큼 넓혀서 셀 경계에 걸친 액터도 검색합니다. */
+	float MaxEntryRadius;
+
+	/** 액터 Spawn 델리게이트 핸들입니다. */
+	FDelegateHandle ActorSpawnedHandle;
+
+	/** 레벨 추가 델리게이트 핸들입니다. */
+	FDelegateHandle LevelAddedHandle;
+
+	/** 레벨 제거 델리게이트 핸들입니다. */
+	FDelegateHandle LevelRemovedHandle;
+};
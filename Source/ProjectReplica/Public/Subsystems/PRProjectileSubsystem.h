@@ -0,0 +1,380 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "ProjectReplica.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Subsystems/PRDamageableSpatialHashSubsystem.h"
+#include "PRProjectileSubsystem.generated.h"
+
+class APRPooledObject;
+
+/**
+ * 발사체를 생성할 때 사용하는 설정 값입니다.
+ */
+USTRUCT(BlueprintType)
+struct FPRProjectileSettings
+{
+	GENERATED_BODY()
+
+public:
+	FPRProjectileSettings()
+		: Speed(2000.0f)
+		, GravityScale(0.0f)
+		, HomingAcceleration(0.0f)
+		, Radius(10.0f)
+		, Lifespan(5.0f)
+		, bCollideWithWorld(true)
+		, VisualClass(nullptr)
+		, DamageInfo(FPRDamageInfo())
+	{}
+
+public:
+	/** 발사체의 속력입니다. 유도 발사체는 이 속력을 유지합니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PRProjectileSettings", meta = (ClampMin = "0.0"))
+	float Speed;
+
+	/** 발사체에 적용하는 중력의 배율입니다. 0일 경우 직선으로 이동합니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PRProjectileSettings")
+	float GravityScale;
+
+	/** 유도 대상을 향하는 가속도입니다. 0일 경우 유도하지 않습니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PRProjectileSettings", meta = (ClampMin = "0.0"))
+	float HomingAcceleration;
+
+	/** 발사체의 충돌 반지름입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PRProjectileSettings", meta = (ClampMin = "0.0"))
+	float Radius;
+
+	/** 발사체의 수명(초)입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PRProjectileSettings", meta = (ClampMin = "0.0"))
+	float Lifespan;
+
+	/** 월드의 지형과 충돌하는지 나타내는 변수입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PRProjectileSettings")
+	bool bCollideWithWorld;
+
+	/** 발사체를 표시할 오브젝트의 클래스입니다. 없을 경우 표시하지 않습니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PRProjectileSettings")
+	TSubclassOf<APRPooledObject> VisualClass;
+
+	/** 발사체가 주는 대미지의 정보입니다. ImpactLocation은 충돌한 위치로 설정합니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PRProjectileSettings")
+	FPRDamageInfo DamageInfo;
+};
+
+/**
+ * 발사체의 상태를 변수별 배열(Struct of Arrays)로 보관하는 구조체입니다.
+ * 이동을 계산할 때 필요한 변수만 연속된 메모리로 읽을 수 있으며, 발사체를 제거할 때는 마지막 발사체를 옮깁니다.
+ */
+struct PROJECTREPLICA_API FPRProjectileArrays
+{
+public:
+	/**
+	 * 발사체를 추가하는 함수입니다.
+	 *
+	 * @return 추가한 발사체의 Index입니다.
+	 */
+	int32 Add(int32 ProjectileID, AActor* Instigator, AActor* HomingTarget, const FVector& Location, const FVector& Velocity, const FPRProjectileSettings& Settings);
+
+	/**
+	 * 주어진 Index의 발사체를 제거하는 함수입니다. 마지막 발사체를 제거한 위치로 옮깁니다.
+	 *
+	 * @param Index 제거할 발사체의 Index입니다.
+	 */
+	void RemoveAtSwap(int32 Index);
+
+	/** 보관한 발사체를 모두 제거하는 함수입니다. */
+	void Empty();
+
+	/** 보관한 발사체의 수를 반환하는 함수입니다. */
+	FORCEINLINE int32 Num() const { return IDs.Num(); }
+
+public:
+	/** 발사체의 ID입니다. */
+	TArray<int32> IDs;
+
+	/** 발사체를 발사한 액터입니다. */
+	TArray<TWeakObjectPtr<AActor>> Instigators;
+
+	/** 유도 대상입니다. */
+	TArray<TWeakObjectPtr<AActor>> HomingTargets;
+
+	/** 현재 위치입니다. */
+	TArray<FVector> Locations;
+
+	/** 이전 프레임의 위치입니다. 이전 위치에서 현재 위치까지 충돌을 검사합니다. */
+	TArray<FVector> PreviousLocations;
+
+	/** 속도입니다. */
+	TArray<FVector> Velocities;
+
+	/** 유도 발사체가 유지하는 속력입니다. */
+	TArray<float> Speeds;
+
+	/** 중력의 배율입니다. */
+	TArray<float> GravityScales;
+
+	/** 유도 대상을 향하는 가속도입니다. */
+	TArray<float> HomingAccelerations;
+
+	/** 충돌 반지름입니다. */
+	TArray<float> Radii;
+
+	/** 남은 수명(초)입니다. */
+	TArray<float> RemainingLifespans;
+
+	/** 월드의 지형과 충돌하는지 나타내는 변수입니다. */
+	TArray<bool> CollideWithWorld;
+
+	/** 결과를 기다리고 있는 월드의 지형과의 충돌 검사의 수입니다. 수명이 다한 발사체는 이 값이 0이 될 때까지 제거하지 않습니다. */
+	TArray<int32> PendingWorldTraces;
+
+	/** 충돌했을 때 주는 대미지의 정보입니다. */
+	TArray<FPRDamageInfo> DamageInfos;
+
+	/** 발사체를 표시할 오브젝트의 클래스입니다. */
+	TArray<TSubclassOf<APRPooledObject>> VisualClasses;
+
+	/** 발사체를 표시하고 있는 오브젝트입니다. 표시하지 않을 경우 nullptr입니다. */
+	TArray<TWeakObjectPtr<APRPooledObject>> Visuals;
+};
+
+/**
+ * 발사체를 표시하는 오브젝트 클래스별 Pool입니다.
+ */
+USTRUCT(BlueprintType)
+struct FPRProjectileVisualPool
+{
+	GENERATED_BODY()
+
+public:
+	/** 사용할 수 있는 오브젝트입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRProjectileVisualPool")
+	TArray<TObjectPtr<APRPooledObject>> FreeVisuals;
+};
+
+/**
+ * 발사체의 처리 통계를 나타내는 구조체입니다.
+ */
+USTRUCT(Atomic, BlueprintType)
+struct FPRProjectileStats
+{
+	GENERATED_BODY()
+
+public:
+	FPRProjectileStats()
+		: SpawnedProjectiles(0)
+		, DamageHits(0)
+		, WorldHits(0)
+		, ExpiredProjectiles(0)
+		, PeakProjectiles(0)
+		, PeakActiveVisuals(0)
+		, LastSimulationTime(0.0)
+		, PeakSimulationTime(0.0)
+	{}
+
+public:
+	/** 생성한 발사체의 수입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRProjectileStats")
+	int32 SpawnedProjectiles;
+
+	/** 대미지를 받을 수 있는 액터와 충돌한 발사체의 수입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRProjectileStats")
+	int32 DamageHits;
+
+	/** 월드의 지형과 충돌한 발사체의 수입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRProjectileStats")
+	int32 WorldHits;
+
+	/** 수명이 다한 발사체의 수입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRProjectileStats")
+	int32 ExpiredProjectiles;
+
+	/** 동시에 존재한 발사체 수의 최댓값입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRProjectileStats")
+	int32 PeakProjectiles;
+
+	/** 동시에 표시한 발사체 수의 최댓값입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRProjectileStats")
+	int32 PeakActiveVisuals;
+
+	/** 마지막 프레임에 발사체를 처리한 시간(초)입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRProjectileStats")
+	double LastSimulationTime;
+
+	/** 한 프레임에 발사체를 처리한 시간(초)의 최댓값입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRProjectileStats")
+	double PeakSimulationTime;
+};
+
+/**
+ * 발사체를 액터 없이 데이터로 관리하는 WorldSubsystem 클래스입니다.
+ * 발사체의 상태는 변수별 배열로 보관하고, 탄도와 유도 이동은 ParallelFor로 한 번에 계산합니다.
+ * 대미지를 받을 수 있는 액터와의 충돌은 공간 해시로 검사하고, 월드의 지형과의 충돌은 모든 발사체를 하나의 비동기 Trace 묶음으로 검사합니다.
+ * 월드의 지형과 충돌하는 발사체는 지형 뒤의 대상에게 대미지를 주지 않도록 이동 구간의 Trace 결과가 도착한 후 막힌 위치까지만 공간 해시를 검사합니다.
+ * 발사체를 표시하는 오브젝트는 플레이어의 시점에서 가까운 발사체에만 Pool에서 활성화합니다.
+ */
+UCLASS()
+class PROJECTREPLICA_API UPRProjectileSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	UPRProjectileSubsystem();
+
+public:
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+public:
+	/**
+	 * 발사체를 생성하는 함수입니다.
+	 *
+	 * @param Instigator 발사체를 발사한 액터입니다. 발사체는 이 액터와 충돌하지 않습니다.
+	 * @param Location 발사체를 생성할 위치입니다.
+	 * @param Direction 발사체를 발사할 방향입니다.
+	 * @param Settings 발사체의 설정 값입니다.
+	 * @param HomingTarget 유도 대상입니다.
+	 * @return 생성한 발사체의 ID입니다.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "PRProjectile")
+	int32 SpawnProjectile(AActor* Instigator, const FVector& Location, const FVector& Direction, const FPRProjectileSettings& Settings, AActor* HomingTarget = nullptr);
+
+	/**
+	 * 발사체를 제거하는 함수입니다.
+	 *
+	 * @param ProjectileID 제거할 발사체의 ID입니다.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "PRProjectile")
+	void DestroyProjectile(int32 ProjectileID);
+
+	/** 발사체가 존재하는지 반환하는 함수입니다. */
+	UFUNCTION(BlueprintCallable, Category = "PRProjectile")
+	FORCEINLINE bool IsValidProjectile(int32 ProjectileID) const { return ProjectileIndices.Contains(ProjectileID); }
+
+	/** 발사체의 수를 반환하는 함수입니다. */
+	UFUNCTION(BlueprintCallable, Category = "PRProjectile")
+	FORCEINLINE int32 GetProjectileCount() const { return Projectiles.Num(); }
+
+	/** 발사체를 표시하고 있는 오브젝트의 수를 반환하는 함수입니다. */
+	UFUNCTION(BlueprintCallable, Category = "PRProjectile")
+	FORCEINLINE int32 GetActiveVisualCount() const { return ActiveVisualCount; }
+
+	/** 발사체의 처리 통계를 반환하는 함수입니다. */
+	UFUNCTION(BlueprintCallable, Category = "PRProjectile")
+	FORCEINLINE FPRProjectileStats GetProjectileStats() const { return ProjectileStats; }
+
+	/** 발사체의 처리 통계를 초기화하는 함수입니다. */
+	UFUNCTION(BlueprintCallable, Category = "PRProjectile")
+	void ResetProjectileStats();
+
+private:
+	/**
+	 * 모든 발사체의 이동을 계산하는 함수입니다.
+	 *
+	 * @param DeltaTime 이동할 시간(초)입니다.
+	 */
+	void SimulateProjectiles(float DeltaTime);
+
+	/**
+	 * 월드의 지형과 충돌하지 않는 발사체는 이번 프레임에 이동한 구간에서 대미지를 받을 수 있는 액터와의 충돌을 처리하고, 충돌하거나 수명이 다한 발사체를 제거하는 함수입니다.
+	 * 월드의 지형과 충돌하는 발사체의 대미지는 OnWorldTraceCompleted에서 처리합니다.
+	 */
+	void ResolveProjectileHits();
+
+	/**
+	 * 주어진 구간에서 가장 먼저 충돌한 대미지를 받을 수 있는 액터의 대미지를 대미지 큐에 추가하는 함수입니다.
+	 *
+	 * @param Index 발사체의 Index입니다.
+	 * @param Start 구간의 시작 위치입니다.
+	 * @param End 구간의 끝 위치입니다.
+	 * @return 대미지를 받을 수 있는 액터와 충돌했을 경우 true를 반환합니다.
+	 */
+	bool ApplyDamageHit(int32 Index, const FVector& Start, const FVector& End);
+
+	/** 월드의 지형과 충돌하는 발사체의 이동 구간을 하나의 비동기 Trace 묶음으로 요청하는 함수입니다. */
+	void RequestWorldTraces();
+
+	/**
+	 * 월드의 지형과의 충돌 결과를 받는 함수입니다.
+	 * 구간마다 막힌 위치까지 대미지를 받을 수 있는 액터와의 충돌을 검사하고, 대상이 없으면 지형과 충돌한 발사체를 제거합니다.
+	 *
+	 * @param HitResults 요청한 순서대로 전달되는 충돌 결과입니다.
+	 * @param ProjectileIDs 요청한 발사체의 ID입니다.
+	 */
+	void OnWorldTraceCompleted(TConstArrayView<FHitResult> HitResults, TArray<int32> ProjectileIDs);
+
+	/** 플레이어의 시점에서 가까운 발사체만 오브젝트로 표시하는 함수입니다. */
+	void UpdateVisuals();
+
+	/**
+	 * 주어진 Index의 발사체를 제거하는 함수입니다.
+	 *
+	 * @param Index 제거할 발사체의 Index입니다.
+	 */
+	void RemoveProjectileAt(int32 Index);
+
+	/**
+	 * 주어진 Index들의 발사체를 제거하는 함수입니다. 제거할 때 마지막 발사체를 옮기므로 큰 Index부터 제거합니다.
+	 *
+	 * @param Indices 제거할 발사체의 Index입니다. 함수 안에서 정렬합니다.
+	 */
+	void RemoveProjectilesAt(TArray<int32>& Indices);
+
+	/** Pool에서 발사체를 표시할 오브젝트를 가져와서 활성화하는 함수입니다. Pool이 비어있을 경우 새로 생성합니다. */
+	APRPooledObject* AcquireVisual(TSubclassOf<APRPooledObject> VisualClass, const FVector& Location, const FRotator& Rotation);
+
+	/** 발사체를 표시하던 오브젝트를 비활성화하고 Pool에 반환하는 함수입니다. */
+	void ReleaseVisual(TSubclassOf<APRPooledObject> VisualClass, APRPooledObject* Visual);
+
+	/**
+	 * 발사체를 표시하던 오브젝트가 Pool에 반환되기 전에 소멸되었을 경우 표시하고 있는 오브젝트의 수에서 제외하는 함수입니다.
+	 *
+	 * @param Index 확인할 발사체의 Index입니다.
+	 */
+	void DiscardDestroyedVisual(int32 Index);
+
+private:
+	/** 발사체를 표시하는 최대 거리입니다. 플레이어의 시점에서 이 거리보다 먼 발사체는 표시하지 않습니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "PRProjectile", meta = (AllowPrivateAccess = "true", ClampMin = "0.0"))
+	float VisualCullDistance;
+
+	/** 동시에 표시할 수 있는 발사체의 최대 수입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "PRProjectile", meta = (AllowPrivateAccess = "true", ClampMin = "0"))
+	int32 MaxActiveVisuals;
+
+	/** ParallelFor의 작업 하나가 계산하는 발사체의 수입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "PRProjectile", meta = (AllowPrivateAccess = "true", ClampMin = "1"))
+	int32 ProjectilesPerTask;
+
+	/** 클래스별 발사체를 표시하는 오브젝트의 Pool입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRProjectile", meta = (AllowPrivateAccess = "true"))
+	TMap<TSubclassOf<APRPooledObject>, FPRProjectileVisualPool> VisualPools;
+
+	/** 발사체의 처리 통계입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRProjectile", meta = (AllowPrivateAccess = "true"))
+	FPRProjectileStats ProjectileStats;
+
+	/** 발사체의 상태입니다. */
+	FPRProjectileArrays Projectiles;
+
+	/** ID별 발사체의 Index입니다. */
+	TMap<int32, int32> ProjectileIndices;
+
+	/** 다음에 생성할 발사체의 ID입니다. */
+	int32 NextProjectileID;
+
+	/** 발사체를 표시하고 있는 오브젝트의 수입니다. */
+	int32 ActiveVisualCount;
+
+	/** 유도 대상의 위치입니다. 이동을 계산하기 전에 게임 스레드에서 모아둡니다. */
+	TArray<FVector> HomingTargetLocations;
+
+	/** 이번 프레임에 제거할 발사체의 Index입니다. */
+	TArray<int32> RemovedIndices;
+
+	/** 공간 해시의 검색 결과를 담는 배열입니다. 처리할 때마다 재사용합니다. */
+	TArray<FPRDamageableQueryResult> QueryResults;
+};
@@ -0,0 +1,255 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "ProjectReplica.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Components/PREffectSystemComponent.h"
+#include "PRSharedEffectPoolSubsystem.generated.h"
+
+class APREffect;
+class APRNiagaraEffect;
+class UNiagaraSystem;
+
+/**
+ * 월드에서 공유하는 이펙트 Pool의 사용 통계를 나타내는 구조체입니다.
+ */
+USTRUCT(Atomic, BlueprintType)
+struct FPRSharedEffectPoolStats
+{
+	GENERATED_BODY()
+
+public:
+	FPRSharedEffectPoolStats()
+		: AcquireRequests(0)
+		, PoolHits(0)
+		, Creations(0)
+		, QuotaRecycles(0)
+		, FairShareReclaims(0)
+		, Rejections(0)
+		, PeakPooledEffects(0)
+		, PrimedEffects(0)
+	{}
+
+public:
+	/** 이펙트를 요청한 횟수입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRSharedEffectPoolStats")
+	int32 AcquireRequests;
+
+	/** Pool에 비활성화된 이펙트가 있어서 재사용한 횟수입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRSharedEffectPoolStats")
+	int32 PoolHits;
+
+	/** Pool을 늘리기 위해 이펙트를 생성한 횟수입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRSharedEffectPoolStats")
+	int32 Creations;
+
+	/** 요청한 Owner가 할당량을 모두 사용하여 자신의 가장 오래된 이펙트를 재사용한 횟수입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRSharedEffectPoolStats")
+	int32 QuotaRecycles;
+
+	/** Pool이 가득 차서 공정한 몫보다 많이 사용하는 Owner의 이펙트를 회수한 횟수입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRSharedEffectPoolStats")
+	int32 FairShareReclaims;
+
+	/** Pool이 가득 차고 회수할 이펙트도 없어서 요청을 거절한 횟수입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRSharedEffectPoolStats")
+	int32 Rejections;
+
+	/** 모든 Pool에 보관된 이펙트 수의 최댓값입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRSharedEffectPoolStats")
+	int32 PeakPooledEffects;
+
+	/** Pool을 생성할 때 미리 한 번 활성화하였다가 비활성화한 이펙트의 수입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRSharedEffectPoolStats")
+	int32 PrimedEffects;
+};
+
+/**
+ * 월드에서 공유하는 NiagaraSystem별 NiagaraEffect Pool을 나타내는 구조체입니다.
+ */
+USTRUCT(BlueprintType)
+struct FPRSharedNiagaraEffectPool
+{
+	GENERATED_BODY()
+
+public:
+	FPRSharedNiagaraEffectPool()
+		: PooledEffects()
+		, FreeEffects()
+		, ActiveEffects()
+		, EffectLifespan(0.0f)
+		, MaxPoolSize(0)
+		, ActiveEffectCounts()
+		, ActiveEffectOwners()
+	{}
+
+public:
+	/** Pool에 보관된 모든 NiagaraEffect입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRSharedNiagaraEffectPool")
+	TArray<TObjectPtr<APRNiagaraEffect>> PooledEffects;
+
+	/** 사용할 수 있는 NiagaraEffect입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRSharedNiagaraEffectPool")
+	TArray<TObjectPtr<APRNiagaraEffect>> FreeEffects;
+
+	/** 사용 중인 NiagaraEffect입니다. 가장 먼저 사용한 NiagaraEffect가 앞에 있습니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRSharedNiagaraEffectPool")
+	TArray<TObjectPtr<APRNiagaraEffect>> ActiveEffects;
+
+	/** NiagaraEffect의 수명입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRSharedNiagaraEffectPool")
+	float EffectLifespan;
+
+	/** Pool이 늘어날 수 있는 최대 크기입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRSharedNiagaraEffectPool")
+	int32 MaxPoolSize;
+
+	/** Owner별로 사용 중인 NiagaraEffect의 수입니다. */
+	TMap<TWeakObjectPtr<AActor>, int32> ActiveEffectCounts;
+
+	/**
+	 * 사용 중인 NiagaraEffect를 가져간 Owner입니다.
+	 * Owner가 제거된 후에도 가져갈 때 사용한 Key로 ActiveEffectCounts의 수를 정확하게 줄이기 위해 사용합니다.
+	 */
+	TMap<TWeakObjectPtr<APRNiagaraEffect>, TWeakObjectPtr<AActor>> ActiveEffectOwners;
+};
+
+/**
+ * 월드의 모든 EffectSystem이 함께 사용하는 NiagaraEffect Pool을 관리하는 WorldSubsystem 클래스입니다.
+ * 같은 NiagaraSystem을 사용하는 캐릭터가 하나의 Pool을 공유하므로 이펙트의 수가 캐릭터의 수가 아니라 동시에 사용하는 수에 비례합니다.
+ * Owner마다 할당량을 두고, Pool이 가득 찼을 때는 공정한 몫보다 많이 사용하는 Owner의 가장 오래된 이펙트를 회수합니다.
+ */
+UCLASS()
+class PROJECTREPLICA_API UPRSharedEffectPoolSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	UPRSharedEffectPoolSubsystem();
+
+public:
+	virtual void Deinitialize() override;
+
+public:
+	/**
+	 * 주어진 설정 값으로 NiagaraSystem의 공유 Pool을 생성하는 함수입니다.
+	 * 이미 생성된 Pool일 경우 설정 값의 PoolSize만큼 이펙트가 있도록 Pool을 늘립니다.
+	 *
+	 * @param NiagaraPoolSettings 공유 Pool을 생성할 설정 값입니다.
+	 * @param bPrimeEffects true일 경우 새로 생성한 NiagaraEffect를 보이지 않게 한 번 활성화하였다가 비활성화하여 첫 번째 활성화의 초기화 비용을 미리 처리합니다.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "PRSharedEffectPool")
+	void RegisterNiagaraPool(const FPRNiagaraEffectPoolSettings& NiagaraPoolSettings, bool bPrimeEffects = true);
+
+	/**
+	 * 공유 Pool에서 주어진 Owner가 사용할 NiagaraEffect를 가져오는 함수입니다.
+	 * 가져온 NiagaraEffect는 비활성화되면 자동으로 Pool에 반환됩니다.
+	 *
+	 * @param NiagaraSystem 가져올 NiagaraEffect의 NiagaraSystem입니다.
+	 * @param Requester NiagaraEffect를 사용할 Owner입니다.
+	 * @param OwnerQuota Owner가 동시에 사용할 수 있는 NiagaraEffect의 수입니다. 0 이하일 경우 제한하지 않습니다.
+	 * @return 사용할 NiagaraEffect입니다. Pool이 가득 차서 가져올 수 없을 경우 nullptr을 반환합니다.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "PRSharedEffectPool")
+	APRNiagaraEffect* AcquireNiagaraEffect(UNiagaraSystem* NiagaraSystem, AActor* Requester, int32 OwnerQuota = 0);
+
+	/**
+	 * 주어진 Owner가 사용 중인 모든 NiagaraEffect를 비활성화하여 Pool에 반환하는 함수입니다.
+	 * Owner가 사망하거나 제거될 때 호출하여 다른 Owner가 바로 사용할 수 있도록 합니다.
+	 *
+	 * @param Owner NiagaraEffect를 반환할 Owner입니다.
+	 * @return Pool에 반환한 NiagaraEffect의 수입니다.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "PRSharedEffectPool")
+	int32 ReleaseOwnerNiagaraEffects(AActor* Owner);
+
+	/**
+	 * 주어진 NiagaraSystem의 공유 Pool이 생성되어 있는지 확인하는 함수입니다.
+	 *
+	 * @param NiagaraSystem 확인할 NiagaraSystem입니다.
+	 * @return 공유 Pool이 생성되어 있으면 true를 반환합니다.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "PRSharedEffectPool")
+	bool IsCreateNiagaraPool(UNiagaraSystem* NiagaraSystem) const;
+
+	/**
+	 * 주어진 NiagaraEffect가 공유 Pool에서 관리하는 NiagaraEffect인지 확인하는 함수입니다.
+	 *
+	 * @param NiagaraEffect 확인할 NiagaraEffect입니다.
+	 * @return 공유 Pool에서 관리하는 NiagaraEffect이면 true를 반환합니다.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "PRSharedEffectPool")
+	bool IsSharedNiagaraEffect(APRNiagaraEffect* NiagaraEffect) const;
+
+	/**
+	 * 주어진 Owner가 사용 중인 NiagaraEffect의 수를 반환하는 함수입니다.
+	 *
+	 * @param NiagaraSystem 확인할 NiagaraSystem입니다.
+	 * @param Owner 확인할 Owner입니다.
+	 * @return Owner가 사용 중인 NiagaraEffect의 수입니다.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "PRSharedEffectPool")
+	int32 GetActiveNiagaraEffectCount(UNiagaraSystem* NiagaraSystem, AActor* Owner) const;
+
+	/** 공유 Pool의 사용 통계를 반환하는 함수입니다. */
+	UFUNCTION(BlueprintCallable, Category = "PRSharedEffectPool")
+	FORCEINLINE FPRSharedEffectPoolStats GetSharedPoolStats() const { return SharedPoolStats; }
+
+	/** 공유 Pool의 사용 통계를 초기화하는 함수입니다. */
+	UFUNCTION(BlueprintCallable, Category = "PRSharedEffectPool")
+	void ResetSharedPoolStats();
+
+private:
+	/**
+	 * 공유 Pool에 NiagaraEffect를 생성하여 추가하는 함수입니다.
+	 *
+	 * @param NiagaraSystem 생성할 NiagaraEffect의 NiagaraSystem입니다.
+	 * @param SharedPool NiagaraEffect를 추가할 공유 Pool입니다.
+	 * @return 생성한 NiagaraEffect입니다.
+	 */
+	APRNiagaraEffect* SpawnSharedNiagaraEffect(UNiagaraSystem* NiagaraSystem, FPRSharedNiagaraEffectPool& SharedPool);
+
+	/**
+	 * 주어진 Owner가 사용 중인 가장 오래된 NiagaraEffect를 비활성화하여 Pool에 반환하는 함수입니다.
+	 *
+	 * @param SharedPool NiagaraEffect를 반환할 공유 Pool입니다.
+	 * @param Owner NiagaraEffect를 반환할 Owner입니다. nullptr일 경우 제거된 Owner가 사용하던 NiagaraEffect를 반환합니다.
+	 * @return NiagaraEffect를 반환했으면 true를 반환합니다.
+	 */
+	bool RecycleOldestNiagaraEffect(FPRSharedNiagaraEffectPool& SharedPool, AActor* Owner);
+
+	/**
+	 * Pool이 가득 찼을 때 요청한 Owner가 공정한 몫보다 적게 사용하고 있으면
+	 * 가장 많이 사용하는 Owner의 가장 오래된 NiagaraEffect를 회수하는 함수입니다.
+	 *
+	 * @param SharedPool NiagaraEffect를 회수할 공유 Pool입니다.
+	 * @param Requester NiagaraEffect를 요청한 Owner입니다.
+	 * @return NiagaraEffect를 회수했으면 true를 반환합니다.
+	 */
+	bool ReclaimNiagaraEffectForFairShare(FPRSharedNiagaraEffectPool& SharedPool, AActor* Requester);
+
+	/**
+	 * 공유 Pool의 NiagaraEffect가 비활성화될 때 호출되는 함수입니다.
+	 * NiagaraEffect를 Owner에서 분리하여 Pool에 반환합니다.
+	 *
+	 * @param TargetEffect 비활성화된 이펙트입니다.
+	 */
+	void OnSharedNiagaraEffectDeactivate(APREffect* TargetEffect);
+
+private:
+	/** 설정 값의 PoolSize와 비교하여 더 큰 값을 공유 Pool의 최대 크기로 사용하는 기본 최대 크기입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "PRSharedEffectPool", meta = (AllowPrivateAccess = "true"))
+	int32 DefaultMaxPoolSize;
+
+	/** NiagaraSystem별 공유 Pool입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRSharedEffectPool", meta = (AllowPrivateAccess = "true"))
+	TMap<TObjectPtr<UNiagaraSystem>, FPRSharedNiagaraEffectPool> NiagaraPools;
+
+	/** 공유 Pool의 사용 통계입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRSharedEffectPool", meta = (AllowPrivateAccess = "true"))
+	FPRSharedEffectPoolStats SharedPoolStats;
+
+	/** 모든 공유 Pool에 보관된 NiagaraEffect의 수입니다. */
+	int32 PooledEffectCount;
+};
@@ -100,6 +100,12 @@ public:
 	/** PROwner를 반환하는 함수입니다. */
 	class APRBaseCharacter* GetPROwner() const;
 
+	/** WeaponStat을 반환하는 함수입니다. */
+	FORCEINLINE const FPRWeaponStat& GetWeaponStat() const { return WeaponStat; }
+
+	/** 메인 무기의 외형을 반환하는 함수입니다. */
+	FORCEINLINE UStaticMeshComponent* GetMainWeaponMesh() const { return MainWeaponMesh; }
+
 #pragma region SpawnEffect
 protected:
 	/** 무기의 Spawn 이펙트입니다. */
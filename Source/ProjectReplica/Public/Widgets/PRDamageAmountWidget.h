@@ -30,6 +30,23 @@ public:
 	 */
 	void InitializeDamageAmountWidget(float DamageAmount, bool bIsCritical, EPRElementType ElementType);
 
+	/**
+	 * 표시 중인 대미지를 갱신하고 FadeOut WidgetAnimation을 처음부터 다시 재생하는 함수입니다.
+	 *
+	 * @param DamageAmount 대미지의 양
+	 * @param bIsCritical 일반 대미지인지, 치명타 대미지인지 판별하는 인자
+	 */
+	void UpdateDamageAmountWidget(float DamageAmount, bool bIsCritical);
+
+private:
+	/**
+	 * 대미지의 양과 치명타 이미지를 설정하는 함수입니다.
+	 *
+	 * @param DamageAmount 대미지의 양
+	 * @param bIsCritical 일반 대미지인지, 치명타 대미지인지 판별하는 인자
+	 */
+	void SetDamageAmount(float DamageAmount, bool bIsCritical);
+
 private:
 	/** 대미지를 나타내는 TextBlock입니다. */
 	UPROPERTY(BlueprintReadWrite, Category = "DamageAmount", meta = (AllowPrivateAccess = "true", BindWidget))